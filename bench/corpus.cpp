@@ -0,0 +1,242 @@
+#include "corpus.h"
+
+#include <string>
+#include <vector>
+
+namespace Corpus {
+
+namespace {
+
+    /// @brief splitmix64, so that the corpus does not depend on how the
+    /// standard library implements distributions.
+    class Random {
+    private:
+        std::uint64_t state_;
+
+    public:
+        explicit Random(std::uint64_t seed)
+            : state_(seed)
+        {
+        }
+
+        std::uint64_t next()
+        {
+            std::uint64_t z = (state_ += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+        /// @brief A number in [0, n).
+        std::size_t below(std::size_t n) { return static_cast<std::size_t>(next() % n); }
+
+        template <typename T, std::size_t N>
+        const T& pick(const T (&items)[N])
+        {
+            return items[below(N)];
+        }
+    };
+
+    const char* const kWords[] = {
+        "the", "browser", "parses", "markup", "into", "a", "tree", "of", "nodes",
+        "and", "then", "lays", "out", "boxes", "with", "text", "for", "every",
+        "element", "on", "page", "quickly", "streaming", "bytes",
+    };
+
+    const char* const kInlineTags[] = { "b", "i", "em", "strong", "span", "a", "code" };
+
+    const char* const kAttributeNames[] = {
+        "class", "id", "href", "src", "title", "style", "data-id", "data-role",
+        "aria-label", "x-custom", "onclick", "alt",
+    };
+
+    void append_words(std::string& out, Random& random, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                out += ' ';
+            }
+            out += random.pick(kWords);
+        }
+    }
+
+    void append_value(std::string& out, Random& random)
+    {
+        out += random.pick(kWords);
+        out += '-';
+        out += std::to_string(random.below(1000));
+    }
+
+    void text_heavy(std::string& out, Random& random)
+    {
+        out += "<p>";
+        append_words(out, random, 40 + random.below(80));
+        const char* tag = random.pick(kInlineTags);
+        out += " <";
+        out += tag;
+        out += '>';
+        append_words(out, random, 1 + random.below(5));
+        out += "</";
+        out += tag;
+        out += "> ";
+        append_words(out, random, 20 + random.below(40));
+        out += ".</p>\n";
+    }
+
+    void attribute_heavy(std::string& out, Random& random)
+    {
+        out += "<div";
+        auto count = 4 + random.below(8);
+        for (std::size_t i = 0; i < count; i++) {
+            out += ' ';
+            out += random.pick(kAttributeNames);
+            switch (random.below(4)) {
+            case 0:
+                out += "=\"";
+                append_value(out, random);
+                out += '"';
+                break;
+            case 1:
+                out += "='";
+                append_value(out, random);
+                out += '\'';
+                break;
+            case 2:
+                out += '=';
+                append_value(out, random);
+                break;
+            default:
+                break;
+            }
+        }
+        out += "><img src=\"/i/";
+        append_value(out, random);
+        out += ".png\" alt=''/></div>\n";
+    }
+
+    void deeply_nested(std::string& out, Random& random, std::size_t size)
+    {
+        // Spend about half of the budget opening elements and the rest closing
+        // them, innermost first.
+        std::vector<const char*> open;
+        std::size_t closing_size = 0;
+        while (out.size() + closing_size < size) {
+            const char* tag = random.below(2) ? "div" : "section";
+            out += '<';
+            out += tag;
+            out += '>';
+            open.push_back(tag);
+            closing_size += std::string_view(tag).size() + 3;
+            if (random.below(8) == 0) {
+                append_words(out, random, 1);
+            }
+        }
+        for (auto it = open.rbegin(); it != open.rend(); ++it) {
+            out += "</";
+            out += *it;
+            out += '>';
+        }
+    }
+
+    void malformed(std::string& out, Random& random)
+    {
+        switch (random.below(8)) {
+        case 0:
+            out += "a < b and c<4 ";
+            break;
+        case 1:
+            out += "<div class=\"unterminated>";
+            break;
+        case 2:
+            out += "<p =x a\"b=c d<e>";
+            break;
+        case 3:
+            out += "</>";
+            break;
+        case 4:
+            out += "<!-- not closed ";
+            break;
+        case 5:
+            out += "<?xml version=1?>";
+            break;
+        case 6:
+            out += "<span/x/y/>";
+            break;
+        default:
+            out += "</ 3>";
+            break;
+        }
+        append_words(out, random, 1 + random.below(6));
+        out += '\n';
+    }
+
+    void table_row(std::string& out, Random& random, std::size_t row)
+    {
+        out += "<tr>";
+        for (int column = 0; column < 10; column++) {
+            out += row == 0 ? "<th>" : "<td>";
+            if (column == 0) {
+                out += std::to_string(row);
+            } else {
+                out += random.pick(kWords);
+            }
+            out += row == 0 ? "</th>" : "</td>";
+        }
+        out += "</tr>\n";
+    }
+
+} // namespace
+
+std::string_view name_of(Kind kind)
+{
+    switch (kind) {
+    case Kind::TextHeavy:
+        return "text_heavy";
+    case Kind::AttributeHeavy:
+        return "attribute_heavy";
+    case Kind::DeeplyNested:
+        return "deeply_nested";
+    case Kind::Malformed:
+        return "malformed";
+    case Kind::LargeTable:
+        return "large_table";
+    }
+    return "unknown";
+}
+
+std::string generate(Kind kind, std::size_t size, std::uint64_t seed)
+{
+    Random random(seed ^ static_cast<std::uint64_t>(kind));
+    std::string out;
+    out.reserve(size + 1024);
+    out += "<!DOCTYPE html><html><head><title>corpus</title></head><body>\n";
+
+    if (kind == Kind::DeeplyNested) {
+        deeply_nested(out, random, size);
+    } else if (kind == Kind::LargeTable) {
+        out += "<table>";
+        for (std::size_t row = 0; out.size() < size; row++) {
+            table_row(out, random, row);
+        }
+        out += "</table>";
+    } else {
+        while (out.size() < size) {
+            switch (kind) {
+            case Kind::TextHeavy:
+                text_heavy(out, random);
+                break;
+            case Kind::AttributeHeavy:
+                attribute_heavy(out, random);
+                break;
+            default:
+                malformed(out, random);
+                break;
+            }
+        }
+    }
+
+    out += "\n</body></html>\n";
+    return out;
+}
+
+} // namespace Corpus
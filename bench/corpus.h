@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Corpus {
+
+/// @brief Shapes of synthetic documents, each stressing one part of the
+/// pipeline.
+enum class Kind {
+    /// @brief Long paragraphs with a little inline markup.
+    TextHeavy,
+    /// @brief Many short elements with many attributes, in all quoting styles.
+    AttributeHeavy,
+    /// @brief Thousands of open elements, closed at the very end.
+    DeeplyNested,
+    /// @brief Stray '<', unterminated tags and comments, bad attribute syntax.
+    Malformed,
+    /// @brief A large table of short cells.
+    LargeTable,
+};
+
+constexpr Kind kAllKinds[] = {
+    Kind::TextHeavy,
+    Kind::AttributeHeavy,
+    Kind::DeeplyNested,
+    Kind::Malformed,
+    Kind::LargeTable,
+};
+
+std::string_view name_of(Kind kind);
+
+/// @brief Generates a document of roughly `size` bytes.
+/// The output only depends on the arguments, on every platform.
+std::string generate(Kind kind, std::size_t size, std::uint64_t seed = 1);
+
+} // namespace Corpus
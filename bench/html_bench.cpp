@@ -0,0 +1,511 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "corpus.h"
+#include "dom/document.h"
+#include "dom/element.h"
+#include "dom/traversal.h"
+#include "html/compact_tree_builder.h"
+#include "html/encoding.h"
+#include "html/incremental_tokenizer.h"
+#include "html/parallel_tokenizer.h"
+#include "html/parser.h"
+#include "html/preprocessor.h"
+#include "html/tokenizer.h"
+#include "memory_stats.h"
+#include "util/thread_pool.h"
+
+namespace {
+
+constexpr std::size_t kCorpusSize = 4 * 1024 * 1024;
+
+/// @brief Each corpus is generated once, outside of any timing.
+const std::string& corpus(Corpus::Kind kind)
+{
+    static std::map<Corpus::Kind, std::string> cache;
+    auto it = cache.find(kind);
+    if (it == cache.end()) {
+        it = cache.emplace(kind, Corpus::generate(kind, kCorpusSize)).first;
+    }
+    return it->second;
+}
+
+/// @brief Sink that only counts tokens.
+struct CountingSink {
+    std::size_t tokens = 0;
+
+    void on_start_tag(const TagView&) { tokens++; }
+    void on_end_tag(const TagView&) { tokens++; }
+    void on_text(std::string_view, std::uint32_t) { tokens++; }
+    void on_char(char, std::uint32_t) { tokens++; }
+    void on_eof() { tokens++; }
+};
+
+/// @brief Sets the counters every benchmark reports.
+/// MB/s comes from the bytes processed; tokens/s from the "tokens" rate.
+void report(benchmark::State& state, std::size_t input_size, std::size_t tokens,
+    std::size_t allocations)
+{
+    auto iterations = static_cast<double>(state.iterations());
+    auto megabytes = static_cast<double>(input_size) * iterations / 1e6;
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(input_size) * state.iterations());
+    if (tokens > 0) {
+        state.counters["tokens"] = benchmark::Counter(static_cast<double>(tokens) * iterations,
+            benchmark::Counter::kIsRate);
+    }
+    state.counters["allocs/MB"] = static_cast<double>(allocations) / megabytes;
+    state.counters["peak_rss"] = benchmark::Counter(static_cast<double>(MemoryStats::peak_rss()),
+        benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+}
+
+template <typename Policy>
+void tokenize(benchmark::State& state, Corpus::Kind kind, Engine engine)
+{
+    const auto& input = corpus(kind);
+    std::size_t tokens = 0;
+    auto allocations_before = MemoryStats::allocation_count();
+
+    for (auto _ : state) {
+        BasicTokenizer<Policy> tokenizer(input, TextMode::Run, engine);
+        CountingSink sink;
+        tokenizer.run(sink);
+        tokens = sink.tokens;
+        benchmark::DoNotOptimize(tokens);
+    }
+
+    report(state, input.size(), tokens, MemoryStats::allocation_count() - allocations_before);
+}
+
+void tokenize_parallel(benchmark::State& state, Corpus::Kind kind)
+{
+    // Small chunks so that the corpus keeps every hardware thread busy.
+    constexpr std::size_t kChunkSize = 128 * 1024;
+    const auto& input = corpus(kind);
+    std::size_t tokens = 0;
+    auto allocations_before = MemoryStats::allocation_count();
+
+    for (auto _ : state) {
+        ParallelTokenizer tokenizer(input, 0, kChunkSize);
+        CountingSink sink;
+        tokenizer.run(sink);
+        tokens = sink.tokens;
+        benchmark::DoNotOptimize(tokens);
+    }
+
+    report(state, input.size(), tokens, MemoryStats::allocation_count() - allocations_before);
+}
+
+void tokenize_edit(benchmark::State& state, Corpus::Kind kind)
+{
+    // Types a character into the middle of the corpus and deletes it again.
+    IncrementalTokenizer tokenizer(corpus(kind));
+    auto middle = tokenizer.document().find('<', tokenizer.document().size() / 2) + 1;
+    std::size_t tokenized_bytes = 0;
+
+    for (auto _ : state) {
+        tokenizer.edit(middle, middle, "x");
+        tokenized_bytes += tokenizer.last_tokenized_bytes();
+        tokenizer.edit(middle, middle + 1, "");
+        tokenized_bytes += tokenizer.last_tokenized_bytes();
+        benchmark::DoNotOptimize(tokenized_bytes);
+    }
+
+    state.counters["tokenized_bytes/edit"] = benchmark::Counter(static_cast<double>(tokenized_bytes) / 2,
+        benchmark::Counter::kAvgIterations);
+}
+
+void preprocess(benchmark::State& state, Corpus::Kind kind)
+{
+    const auto& input = corpus(kind);
+    auto allocations_before = MemoryStats::allocation_count();
+
+    for (auto _ : state) {
+        InputPreprocessor preprocessor;
+        auto chunk = preprocessor.process(input, true);
+        benchmark::DoNotOptimize(chunk.text.data());
+    }
+
+    report(state, input.size(), 0, MemoryStats::allocation_count() - allocations_before);
+}
+
+/// @brief The corpus as UTF-16LE, each byte widened to one code unit.
+const std::string& utf16_corpus(Corpus::Kind kind)
+{
+    static std::map<Corpus::Kind, std::string> cache;
+    auto it = cache.find(kind);
+    if (it == cache.end()) {
+        const auto& input = corpus(kind);
+        std::string wide;
+        wide.reserve(input.size() * 2);
+        for (char ch : input) {
+            wide += ch;
+            wide += '\0';
+        }
+        it = cache.emplace(kind, std::move(wide)).first;
+    }
+    return it->second;
+}
+
+void decode_utf16(benchmark::State& state, Corpus::Kind kind)
+{
+    const auto& input = utf16_corpus(kind);
+    auto allocations_before = MemoryStats::allocation_count();
+
+    for (auto _ : state) {
+        TextDecoder decoder(Encoding::Utf16LE);
+        auto text = decoder.decode(input, true);
+        benchmark::DoNotOptimize(text.data());
+    }
+
+    report(state, input.size(), 0, MemoryStats::allocation_count() - allocations_before);
+}
+
+void parse(benchmark::State& state, Corpus::Kind kind)
+{
+    const auto& input = corpus(kind);
+    auto allocations_before = MemoryStats::allocation_count();
+
+    std::size_t dom_bytes = 0;
+    std::size_t source_bytes = 0;
+
+    for (auto _ : state) {
+        auto document = HTMLParser::parse(input);
+        dom_bytes = document->arena().bytes_allocated();
+        // Kept alive by the document for its text nodes to refer to.
+        source_bytes = document->source().size();
+        benchmark::DoNotOptimize(document.get());
+    }
+
+    report(state, input.size(), 0, MemoryStats::allocation_count() - allocations_before);
+    state.counters["dom_bytes/MB"] = static_cast<double>(dom_bytes) / (static_cast<double>(input.size()) / 1e6);
+    state.counters["source_bytes/MB"] = static_cast<double>(source_bytes) / (static_cast<double>(input.size()) / 1e6);
+}
+
+void parse_compact(benchmark::State& state, Corpus::Kind kind)
+{
+    const auto& input = corpus(kind);
+    auto allocations_before = MemoryStats::allocation_count();
+
+    for (auto _ : state) {
+        auto document = CompactTreeBuilder::parse(input);
+        benchmark::DoNotOptimize(document.get());
+    }
+
+    report(state, input.size(), 0, MemoryStats::allocation_count() - allocations_before);
+}
+
+/// @brief A page of nested elements that all have an ID and a couple of
+/// classes, and the keys the lookup benchmarks ask for.
+struct LookupPage {
+    static constexpr std::size_t kElements = 20000;
+    static constexpr std::size_t kClasses = 64;
+
+    std::string html;
+    std::unique_ptr<Document> document;
+    std::vector<std::string> ids;
+    std::vector<std::string> classes;
+
+    static const LookupPage& get()
+    {
+        static const LookupPage page = [] {
+            LookupPage out;
+            auto& html = out.html;
+            for (std::size_t i = 0; i < kElements; i++) {
+                html += "<section><div id=\"e" + std::to_string(i) + "\" class=\"item c"
+                    + std::to_string(i % kClasses) + "\">text</div>";
+                if (i % 8 == 7) {
+                    for (int j = 0; j < 8; j++) {
+                        html += "</section>";
+                    }
+                }
+            }
+            out.document = HTMLParser::parse(html);
+            // Spread over the page, so that scans stop at varying depths.
+            for (std::size_t i = 0; i < 256; i++) {
+                out.ids.push_back("e" + std::to_string((i * 7919) % kElements));
+            }
+            for (std::size_t i = 0; i < 16; i++) {
+                out.classes.push_back("c" + std::to_string(i * 3));
+            }
+            return out;
+        }();
+        return page;
+    }
+};
+
+void lookup_indexed(benchmark::State& state)
+{
+    const auto& page = LookupPage::get();
+    auto& document = *page.document;
+    std::size_t found = 0;
+
+    for (auto _ : state) {
+        for (const auto& id : page.ids) {
+            found += document.get_element_by_id(id) != nullptr;
+        }
+        for (const auto& name : page.classes) {
+            found += document.get_elements_by_class_name(name).length();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.counters["lookups"] = benchmark::Counter(
+        static_cast<double>(page.ids.size() + page.classes.size()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+void lookup_scan(benchmark::State& state)
+{
+    // What every lookup costs without the indexes: a walk with string
+    // compares until the first match, or over the whole tree for classes.
+    const auto& page = LookupPage::get();
+    auto* document = page.document.get();
+    std::size_t found = 0;
+
+    for (auto _ : state) {
+        for (const auto& id : page.ids) {
+            for (auto* node : Traversal::preorder(document)) {
+                if (node->node_type() == Node::Type::ELEMENT_NODE && static_cast<Element*>(node)->id() == id) {
+                    found++;
+                    break;
+                }
+            }
+        }
+        for (const auto& name : page.classes) {
+            for (auto* node : Traversal::preorder(document)) {
+                found += node->node_type() == Node::Type::ELEMENT_NODE && static_cast<Element*>(node)->has_class(name);
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.counters["lookups"] = benchmark::Counter(
+        static_cast<double>(page.ids.size() + page.classes.size()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+void mutate(benchmark::State& state, bool batched)
+{
+    // Takes every indexed element out and puts it back where it was, the
+    // way a sanitizer rewrites a page, then looks one up.
+    auto document = HTMLParser::parse(LookupPage::get().html);
+    std::vector<Element*> elements;
+    for (auto* node : Traversal::preorder(document.get())) {
+        if (node->node_type() == Node::Type::ELEMENT_NODE && !static_cast<Element*>(node)->id().empty()) {
+            elements.push_back(static_cast<Element*>(node));
+        }
+    }
+
+    for (auto _ : state) {
+        {
+            std::unique_ptr<Document::MutationBatch> batch;
+            if (batched) {
+                batch = std::make_unique<Document::MutationBatch>(*document);
+            }
+            for (auto* element : elements) {
+                auto* parent = element->parent_node();
+                auto* next = element->next_sibling();
+                parent->remove_child(element);
+                parent->insert_before(element, next);
+            }
+        }
+        benchmark::DoNotOptimize(document->get_element_by_id("e0"));
+    }
+
+    state.counters["mutations"] = benchmark::Counter(
+        2 * static_cast<double>(elements.size()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+void remove_class(benchmark::State& state, bool read_between)
+{
+    // Detaches every element that shares one class, which must cost the same
+    // per element however many there are, also when the collection is read
+    // after every removal.
+    std::string html;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        html += "<div class=item id=e" + std::to_string(i) + "></div>";
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto document = HTMLParser::parse(html);
+        state.ResumeTiming();
+        auto items = document->get_elements_by_class_name("item");
+        if (read_between) {
+            while (auto* item = items.item(0)) {
+                document->remove_child(item);
+            }
+        } else {
+            while (auto* node = document->first_child()) {
+                document->remove_child(node);
+            }
+        }
+        benchmark::DoNotOptimize(items.length());
+        state.PauseTiming();
+        document.reset();
+        state.ResumeTiming();
+    }
+
+    state.counters["removals"] = benchmark::Counter(
+        static_cast<double>(state.range(0)) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+void insert_class(benchmark::State& state)
+{
+    // Inserts as many elements again in the middle of the ones sharing a
+    // class, reading the collection after each, which must cost the same per
+    // element however many there are.
+    std::string html;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        html += "<div class=item></div>";
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto document = HTMLParser::parse(html);
+        auto* middle = document->first_child();
+        for (std::int64_t i = 0; i < state.range(0) / 2; i++) {
+            middle = middle->next_sibling();
+        }
+        state.ResumeTiming();
+        auto items = document->get_elements_by_class_name("item");
+        for (std::int64_t i = 0; i < state.range(0); i++) {
+            auto* element = document->create_element("div", 1);
+            element->append_attribute("class", "item");
+            document->insert_before(element, middle);
+            benchmark::DoNotOptimize(items.item(0));
+        }
+        benchmark::DoNotOptimize(items.length());
+        state.PauseTiming();
+        document.reset();
+        state.ResumeTiming();
+    }
+
+    state.counters["insertions"] = benchmark::Counter(
+        static_cast<double>(state.range(0)) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+/// @brief Many small documents of every kind, as a crawler sees them.
+const std::vector<std::string>& small_documents()
+{
+    static const std::vector<std::string> documents = [] {
+        constexpr std::size_t kCount = 2000;
+        std::vector<std::string> out;
+        out.reserve(kCount);
+        for (std::size_t i = 0; i < kCount; i++) {
+            auto kind = Corpus::kAllKinds[i % std::size(Corpus::kAllKinds)];
+            // Between 2 and 32 KiB, so that work stealing has something to even out.
+            out.push_back(Corpus::generate(kind, 2048 + (i * 7919) % (30 * 1024), i + 1));
+        }
+        return out;
+    }();
+    return documents;
+}
+
+void parse_batch(benchmark::State& state)
+{
+    const auto& documents = small_documents();
+    std::vector<std::string_view> inputs(documents.begin(), documents.end());
+    std::size_t bytes = 0;
+    for (const auto& document : documents) {
+        bytes += document.size();
+    }
+
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    auto allocations_before = MemoryStats::allocation_count();
+    for (auto _ : state) {
+        auto parsed = HTMLParser::parse_batch(inputs, pool);
+        benchmark::DoNotOptimize(parsed.data());
+    }
+
+    report(state, bytes, 0, MemoryStats::allocation_count() - allocations_before);
+    state.counters["docs"] = benchmark::Counter(
+        static_cast<double>(documents.size()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate);
+}
+
+void register_benchmarks()
+{
+    // Documents per second from one thread up to one per hardware thread.
+    auto* batch = benchmark::RegisterBenchmark("parse/batch", parse_batch)
+                      ->Unit(benchmark::kMillisecond)
+                      ->UseRealTime()
+                      ->ArgName("threads");
+    auto hardware_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned threads = 1; threads < hardware_threads; threads *= 2) {
+        batch->Arg(threads);
+    }
+    batch->Arg(hardware_threads);
+
+    benchmark::RegisterBenchmark("lookup/indexed", lookup_indexed)->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("lookup/scan", lookup_scan)->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("mutate/each", mutate, false)->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark("mutate/batched", mutate, true)->Unit(benchmark::kMillisecond);
+    for (bool read_between : { false, true }) {
+        benchmark::RegisterBenchmark(read_between ? "mutate/remove_and_read" : "mutate/remove_class",
+            remove_class, read_between)
+            ->Unit(benchmark::kMillisecond)
+            ->ArgName("elements")
+            ->RangeMultiplier(2)
+            ->Range(5000, 40000);
+    }
+    benchmark::RegisterBenchmark("mutate/insert_and_read", insert_class)
+        ->Unit(benchmark::kMillisecond)
+        ->ArgName("elements")
+        ->RangeMultiplier(2)
+        ->Range(5000, 40000);
+
+    for (auto kind : Corpus::kAllKinds) {
+        std::string name(Corpus::name_of(kind));
+        benchmark::RegisterBenchmark(("preprocess/" + name).c_str(), preprocess, kind)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("decode/utf16le/" + name).c_str(), decode_utf16, kind)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("tokenize/switch/" + name).c_str(), tokenize<SpecPolicy>,
+            kind, Engine::Switch)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("tokenize/table/" + name).c_str(), tokenize<SpecPolicy>,
+            kind, Engine::Table)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("tokenize/trusted/" + name).c_str(), tokenize<TrustedInput>,
+            kind, Engine::Switch)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("tokenize/parallel/" + name).c_str(), tokenize_parallel, kind)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("tokenize/edit/" + name).c_str(), tokenize_edit, kind)
+            ->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("parse/dom/" + name).c_str(), parse, kind)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::RegisterBenchmark(("parse/compact/" + name).c_str(), parse_compact, kind)
+            ->Unit(benchmark::kMillisecond);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    register_benchmarks();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
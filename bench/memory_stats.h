@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+/// @brief Process-wide memory numbers for benchmark counters.
+///
+/// Linking memory_stats.cpp replaces the global operator new so that every
+/// heap allocation of the benchmark binary is counted.
+namespace MemoryStats {
+
+/// @brief Number of calls to operator new so far.
+std::size_t allocation_count();
+
+/// @brief Peak resident set size of the process in bytes, or 0 when the
+/// platform does not report it.
+std::size_t peak_rss();
+
+} // namespace MemoryStats
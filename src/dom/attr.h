@@ -1,20 +1,38 @@
 #pragma once
 
-#include <string>
+#include "html/atoms.h"
+#include <cstdint>
 #include <string_view>
 
 /// @brief DOM Attr
 ///
 /// https://dom.spec.whatwg.org/#interface-attr
+///
+/// Name and value point into the owner document's arena, or at a static atom
+/// name. Known names are also kept as their atom, so that looking one up is
+/// an integer compare.
 class Attr {
 protected:
-    std::string name_;
-    std::string value_;
+    const char* name_;
+    const char* value_;
+    std::uint32_t name_size_;
+    std::uint32_t value_size_;
+    AttrId id_;
+
+    friend class Element;
 
 public:
-    Attr(std::string_view name, std::string_view value)
-        : name_(std::move(name))
-        , value_(std::move(value))
+    Attr(AttrId id, std::string_view name, std::string_view value)
+        : name_(name.data())
+        , value_(value.data())
+        , name_size_(static_cast<std::uint32_t>(name.size()))
+        , value_size_(static_cast<std::uint32_t>(value.size()))
+        , id_(id)
     {
     }
-};
\ No newline at end of file
+
+    std::string_view name() const { return { name_, name_size_ }; }
+    std::string_view value() const { return { value_, value_size_ }; }
+    /// @brief The atom of the name, `AttrId::Unknown` if it has none.
+    AttrId id() const { return id_; }
+};
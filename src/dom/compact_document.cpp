@@ -0,0 +1,145 @@
+#include "compact_document.h"
+
+#include <cassert>
+
+CompactDocument::CompactDocument()
+{
+    append_node(kNone, Type::DOCUMENT_NODE, TagId::Unknown, {}, 0);
+}
+
+CompactDocument::NodeId CompactDocument::append_node(NodeId parent, Type type,
+    TagId tag_id, Span span, std::uint32_t offset)
+{
+    auto node = size();
+    if (parent != kNone && tree_order_ && !keeps_tree_order(parent)) {
+        tree_order_ = false;
+    }
+
+    types_.push_back(type);
+    parents_.push_back(parent);
+    first_children_.push_back(kNone);
+    last_children_.push_back(kNone);
+    next_siblings_.push_back(kNone);
+    tag_ids_.push_back(tag_id);
+    offsets_.push_back(offset);
+    spans_.push_back(span);
+    if (attribute_begins_.empty()) {
+        attribute_begins_.push_back(0);
+    }
+    attribute_begins_.push_back(static_cast<std::uint32_t>(attributes_.size()));
+
+    if (parent != kNone) {
+        auto last = last_children_[parent];
+        if (last == kNone) {
+            first_children_[parent] = node;
+        } else {
+            next_siblings_[last] = node;
+        }
+        last_children_[parent] = node;
+    }
+
+    return node;
+}
+
+bool CompactDocument::keeps_tree_order(NodeId parent) const
+{
+    // The new node directly follows the last node in preorder exactly when
+    // `parent` is the last node or one of its ancestors.
+    for (auto node = size() - 1; node != kNone; node = parents_[node]) {
+        if (node == parent) {
+            return true;
+        }
+    }
+    return false;
+}
+
+CompactDocument::Span CompactDocument::store(std::string_view s)
+{
+    Span span { static_cast<std::uint32_t>(chars_.size()), static_cast<std::uint32_t>(s.size()) };
+    chars_.append(s);
+    return span;
+}
+
+std::string_view CompactDocument::local_name(NodeId element) const
+{
+    auto id = tag_ids_[element];
+    return id != TagId::Unknown ? Atoms::name_of(id) : view(spans_[element]);
+}
+
+std::string_view CompactDocument::attribute_name(NodeId element, std::uint32_t i) const
+{
+    const auto& attr = attributes_[attribute_begins_[element] + i];
+    return attr.id != AttrId::Unknown ? Atoms::name_of(attr.id) : view(attr.name);
+}
+
+std::string_view CompactDocument::attribute_value(NodeId element, std::uint32_t i) const
+{
+    return view(attributes_[attribute_begins_[element] + i].value);
+}
+
+CompactDocument::NodeId CompactDocument::following(NodeId node) const
+{
+    if (tree_order_) {
+        return node + 1 < size() ? node + 1 : kNone;
+    }
+
+    if (first_children_[node] != kNone) {
+        return first_children_[node];
+    }
+    for (; node != kNone; node = parents_[node]) {
+        if (next_siblings_[node] != kNone) {
+            return next_siblings_[node];
+        }
+    }
+    return kNone;
+}
+
+CompactDocument::NodeId CompactDocument::append_element(NodeId parent,
+    std::string_view local_name, std::uint32_t offset)
+{
+    return append_element(parent, Atoms::lookup_tag(local_name), local_name, offset);
+}
+
+CompactDocument::NodeId CompactDocument::append_element(NodeId parent, TagId id,
+    std::string_view local_name, std::uint32_t offset)
+{
+    Span span = id == TagId::Unknown ? store(local_name) : Span {};
+    return append_node(parent, Type::ELEMENT_NODE, id, span, offset);
+}
+
+void CompactDocument::append_attribute(NodeId element, std::string_view name,
+    std::string_view value)
+{
+    append_attribute(element, Atoms::lookup_attr(name), name, value);
+}
+
+void CompactDocument::append_attribute(NodeId element, AttrId id, std::string_view name,
+    std::string_view value)
+{
+    // Attributes of a node are contiguous, so only the newest node can grow.
+    assert(element == size() - 1);
+    (void)element;
+
+    Span name_span = id == AttrId::Unknown ? store(name) : Span {};
+    attributes_.push_back({ id, name_span, store(value) });
+    attribute_begins_.back()++;
+}
+
+CompactDocument::NodeId CompactDocument::append_text(NodeId parent, std::string_view data,
+    std::uint32_t offset)
+{
+    return append_node(parent, Type::TEXT_NODE, TagId::Unknown, store(data), offset);
+}
+
+void CompactDocument::append_data(NodeId text, std::string_view data)
+{
+    auto& span = spans_[text];
+    if (span.offset + span.length != chars_.size()) {
+        // Something was stored after this node's data: move it to the end.
+        auto offset = static_cast<std::uint32_t>(chars_.size());
+        chars_.append(chars_, span.offset, span.length);
+        span.offset = offset;
+    }
+    chars_.append(data);
+    span.length += static_cast<std::uint32_t>(data.size());
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "html/atoms.h"
+
+/// @brief A DOM stored as parallel arrays indexed by 32-bit node ids.
+///
+/// https://dom.spec.whatwg.org/#concept-node-tree
+///
+/// An alternative to the Document/Node object graph for very large trees.
+/// Each column holds one property of every node, so a walk that only needs
+/// the links or the types touches a few dense arrays instead of one scattered
+/// object per node. Node 0 is the document.
+///
+/// The tree is built by appending only. As long as nodes are appended to the
+/// last node or one of its ancestors, which is what a tree builder does, ids
+/// are in tree order and a preorder walk is a linear scan.
+///
+/// Names and text live in one character buffer: the string_views returned
+/// by the accessors are invalidated by the next append.
+class CompactDocument {
+public:
+    using NodeId = std::uint32_t;
+
+    static constexpr NodeId kDocument = 0;
+    static constexpr NodeId kNone = UINT32_MAX;
+
+    /// @brief https://dom.spec.whatwg.org/#dom-node-nodetype
+    enum class Type : std::uint8_t {
+        ELEMENT_NODE = 1,
+        TEXT_NODE = 3,
+        DOCUMENT_NODE = 9,
+    };
+
+private:
+    /// @brief A range of chars_.
+    struct Span {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    struct Attribute {
+        AttrId id;
+        /// @brief Only used when `id` is unknown.
+        Span name;
+        Span value;
+    };
+
+    std::vector<Type> types_;
+    std::vector<NodeId> parents_;
+    std::vector<NodeId> first_children_;
+    std::vector<NodeId> last_children_;
+    std::vector<NodeId> next_siblings_;
+    std::vector<TagId> tag_ids_;
+    /// @brief Byte offset in the source document where each node starts.
+    std::vector<std::uint32_t> offsets_;
+    /// @brief Text data, or the local name of elements without an atom.
+    std::vector<Span> spans_;
+    /// @brief Node n owns attributes_[attribute_begins_[n], attribute_begins_[n + 1]).
+    std::vector<std::uint32_t> attribute_begins_;
+
+    std::vector<Attribute> attributes_;
+    std::string chars_;
+    bool tree_order_ = true;
+
+    NodeId append_node(NodeId parent, Type type, TagId tag_id, Span span,
+        std::uint32_t offset);
+    Span store(std::string_view s);
+    std::string_view view(Span span) const { return { chars_.data() + span.offset, span.length }; }
+    bool keeps_tree_order(NodeId parent) const;
+
+public:
+    CompactDocument();
+
+    /// @brief Number of nodes, including the document.
+    std::uint32_t size() const { return static_cast<std::uint32_t>(types_.size()); }
+
+    Type node_type(NodeId node) const { return types_[node]; }
+    NodeId parent_node(NodeId node) const { return parents_[node]; }
+    NodeId first_child(NodeId node) const { return first_children_[node]; }
+    NodeId last_child(NodeId node) const { return last_children_[node]; }
+    NodeId next_sibling(NodeId node) const { return next_siblings_[node]; }
+
+    std::uint32_t source_offset(NodeId node) const { return offsets_[node]; }
+    TagId tag_id(NodeId element) const { return tag_ids_[element]; }
+    std::string_view local_name(NodeId element) const;
+    /// @brief https://dom.spec.whatwg.org/#concept-cd-data
+    std::string_view data(NodeId text) const { return view(spans_[text]); }
+
+    std::uint32_t attribute_count(NodeId element) const
+    {
+        return attribute_begins_[element + 1] - attribute_begins_[element];
+    }
+    std::string_view attribute_name(NodeId element, std::uint32_t i) const;
+    std::string_view attribute_value(NodeId element, std::uint32_t i) const;
+
+    /// @brief Whether ids are in tree order, so that preorder is `0, 1, 2...`.
+    bool in_tree_order() const { return tree_order_; }
+
+    /// @brief The node after `node` in preorder, or kNone.
+    /// https://dom.spec.whatwg.org/#concept-tree-following
+    NodeId following(NodeId node) const;
+
+    /// @brief Creates an element and appends it to `parent`.
+    /// `offset` is where it starts in the source document.
+    NodeId append_element(NodeId parent, std::string_view local_name,
+        std::uint32_t offset = 0);
+    /// @brief Like append_element(parent, local_name, offset) for a name
+    /// whose atom is known, such as the tokenizer's. `local_name` is only
+    /// read if `id` is `TagId::Unknown`.
+    NodeId append_element(NodeId parent, TagId id, std::string_view local_name,
+        std::uint32_t offset = 0);
+
+    /// @brief Appends an attribute to `element`, which must be the node
+    /// appended last.
+    void append_attribute(NodeId element, std::string_view name, std::string_view value);
+    /// @brief Like append_attribute(element, name, value) for a name whose
+    /// atom is known. `name` is only read if `id` is `AttrId::Unknown`.
+    void append_attribute(NodeId element, AttrId id, std::string_view name, std::string_view value);
+
+    /// @brief Creates a Text node and appends it to `parent`.
+    NodeId append_text(NodeId parent, std::string_view data,
+        std::uint32_t offset = 0);
+
+    /// @brief Appends to the data of a Text node.
+    void append_data(NodeId text, std::string_view data);
+};
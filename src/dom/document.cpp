@@ -0,0 +1,362 @@
+#include "document.h"
+
+#include <algorithm>
+#include <new>
+#include <optional>
+
+#include "dom/document_fragment.h"
+#include "dom/element.h"
+#include "dom/text.h"
+#include "dom/traversal.h"
+#include "html/atoms.h"
+
+Element* Document::create_element(std::string_view local_name, std::uint32_t attribute_capacity)
+{
+    return create_element(Atoms::lookup_tag(local_name), local_name, attribute_capacity);
+}
+
+Element* Document::create_element(TagId id, std::string_view local_name, std::uint32_t attribute_capacity)
+{
+    // Known names already have static storage.
+    auto name = id != TagId::Unknown ? Atoms::name_of(id) : arena_.copy(local_name);
+    static_assert(sizeof(Element) % alignof(Attr) == 0);
+    auto* storage = arena_.allocate(sizeof(Element) + sizeof(Attr) * attribute_capacity, alignof(Element));
+    return new (storage) Element(this, id, name, attribute_capacity);
+}
+
+Text* Document::create_text_node(std::string_view data)
+{
+    auto* text = arena_.make<Text>(this);
+    text->append_data(data);
+    return text;
+}
+
+DocumentFragment* Document::create_document_fragment()
+{
+    return arena_.make<DocumentFragment>(this);
+}
+
+void Document::connect(Node* first, Node* last)
+{
+    // Parsers append at the end of the document, where the elements go at
+    // the end of every index without looking for their place. The previous last child and its last descendants stop
+    // ending the document, each only once.
+    bool at_end = !last->next_sibling_ && last->parent_->ends_document_;
+    if (at_end) {
+        for (auto* previous = first->previous_sibling_; previous && previous->ends_document_;
+             previous = previous->last_child_) {
+            previous->ends_document_ = false;
+        }
+        for (auto* end = last; end; end = end->last_child_) {
+            end->ends_document_ = true;
+        }
+    }
+
+    for (auto* node = first;; node = node->next_sibling_) {
+        for (auto* descendant : Traversal::preorder(node)) {
+            descendant->connected_ = true;
+            if (descendant->node_type() == Node::Type::ELEMENT_NODE && !defer_indexing(static_cast<Element*>(descendant))) {
+                index_element(static_cast<Element*>(descendant), at_end);
+            }
+        }
+        if (node == last) {
+            break;
+        }
+    }
+}
+
+void Document::disconnect(Node* node)
+{
+    // If the node ends the document, it is a last child, and its previous
+    // sibling and that one's last descendants end it once it is gone.
+    if (node->ends_document_) {
+        for (auto* last = node->previous_sibling_; last; last = last->last_child_) {
+            last->ends_document_ = true;
+        }
+    }
+
+    for (auto* descendant : Traversal::preorder(node)) {
+        descendant->connected_ = false;
+        descendant->ends_document_ = false;
+        if (descendant->node_type() == Node::Type::ELEMENT_NODE && !defer_indexing(static_cast<Element*>(descendant))) {
+            unindex_element(static_cast<Element*>(descendant));
+        }
+    }
+}
+
+bool Document::defer_indexing(const Element* element)
+{
+    if (batch_depth_ == 0) {
+        return false;
+    }
+    if (!indexes_stale_ && (!element->id().empty() || !element->class_list().empty())) {
+        indexes_stale_ = true;
+    }
+    return true;
+}
+
+void Document::index_attribute(Element* element, AttrId id)
+{
+    if (batch_depth_ > 0) {
+        indexes_stale_ = true;
+        return;
+    }
+    // The element may have descendants with the same key after it.
+    bool at_end = !element->first_child_ && element->ends_document_;
+    if (id == AttrId::Id) {
+        if (!element->id().empty()) {
+            add_to_index(ids_, element->id(), element, at_end);
+        }
+        return;
+    }
+    for (auto class_name : element->class_list()) {
+        add_to_index(classes_, class_name, element, at_end);
+    }
+}
+
+void Document::unindex_attribute(Element* element, AttrId id)
+{
+    if (batch_depth_ > 0) {
+        indexes_stale_ = true;
+        return;
+    }
+    if (id == AttrId::Id) {
+        if (!element->id().empty()) {
+            remove_from_index(ids_, element->id(), element);
+        }
+        return;
+    }
+    for (auto class_name : element->class_list()) {
+        remove_from_index(classes_, class_name, element);
+    }
+}
+
+void Document::index_element(Element* element, bool at_end)
+{
+    if (element->attributes().empty()) {
+        return;
+    }
+    auto id = element->id();
+    if (!id.empty()) {
+        add_to_index(ids_, id, element, at_end);
+    }
+    for (auto class_name : element->class_list()) {
+        add_to_index(classes_, class_name, element, at_end);
+    }
+}
+
+void Document::unindex_element(Element* element)
+{
+    if (element->attributes().empty()) {
+        return;
+    }
+    auto id = element->id();
+    if (!id.empty()) {
+        remove_from_index(ids_, id, element);
+    }
+    for (auto class_name : element->class_list()) {
+        remove_from_index(classes_, class_name, element);
+    }
+}
+
+void Document::add_to_index(Index& index, std::string_view key, Element* element, bool at_end)
+{
+    auto& indexed = index[key];
+    auto* previous = at_end || !indexed.last ? indexed.last : preceding_in_index(index, key, indexed, element);
+    auto* next = previous ? links_in(index, key, previous).next : indexed.first;
+    links_in(index, key, element) = { previous, next };
+    (previous ? links_in(index, key, previous).next : indexed.first) = element;
+    (next ? links_in(index, key, next).previous : indexed.last) = element;
+    indexed.size++;
+    index_version_++;
+}
+
+void Document::remove_from_index(Index& index, std::string_view key, Element* element)
+{
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return;
+    }
+    auto& indexed = it->second;
+    auto& links = links_in(index, key, element);
+    if (!links.previous && indexed.first != element) {
+        return;
+    }
+    (links.previous ? links_in(index, key, links.previous).next : indexed.first) = links.next;
+    (links.next ? links_in(index, key, links.next).previous : indexed.last) = links.previous;
+    links = {};
+    if (--indexed.size == 0) {
+        index.erase(it);
+    }
+    index_version_++;
+}
+
+IndexLinks& Document::links_in(const Index& index, std::string_view key, const Element* element) const
+{
+    if (&index == &ids_) {
+        return element->id_links();
+    }
+    auto classes = element->class_list();
+    return element->class_links(std::find(classes.begin(), classes.end(), key) - classes.begin());
+}
+
+namespace {
+
+/// @brief Whether `a` comes before `b` in tree order, two different nodes of
+/// one tree, unless finding out takes more than `steps` steps. Subtracts
+/// the steps taken.
+std::optional<bool> precedes(const Node* a, const Node* b, std::size_t& steps)
+{
+    std::size_t a_depth = 0;
+    std::size_t b_depth = 0;
+    for (auto* node = a->parent_node(); node; node = node->parent_node()) {
+        a_depth++;
+    }
+    for (auto* node = b->parent_node(); node; node = node->parent_node()) {
+        b_depth++;
+    }
+    if (a_depth + b_depth > steps) {
+        return std::nullopt;
+    }
+    steps -= a_depth + b_depth;
+
+    // An ancestor comes before its descendants.
+    bool a_deeper = a_depth > b_depth;
+    for (; a_depth > b_depth; a_depth--) {
+        a = a->parent_node();
+    }
+    for (; b_depth > a_depth; b_depth--) {
+        b = b->parent_node();
+    }
+    if (a == b) {
+        return !a_deeper;
+    }
+    while (a->parent_node() != b->parent_node()) {
+        a = a->parent_node();
+        b = b->parent_node();
+    }
+
+    // Siblings: look both ways from `a`, so that the cost is the distance
+    // between them.
+    auto* after = a->next_sibling();
+    auto* before = a->previous_sibling();
+    for (; steps > 0; steps--) {
+        if (after == b) {
+            return true;
+        }
+        if (before == b) {
+            return false;
+        }
+        after = after ? after->next_sibling() : nullptr;
+        before = before ? before->previous_sibling() : nullptr;
+    }
+    return std::nullopt;
+}
+
+/// @brief The node before `node` in tree order, null for the document.
+Node* preceding(Node* node)
+{
+    auto* previous = node->previous_sibling();
+    if (!previous) {
+        return node->parent_node();
+    }
+    while (previous->last_child()) {
+        previous = previous->last_child();
+    }
+    return previous;
+}
+
+} // namespace
+
+bool Document::indexed_with(const Index& index, std::string_view key, const Node* node) const
+{
+    if (node->node_type() != Node::Type::ELEMENT_NODE || !node->connected_) {
+        return false;
+    }
+    auto* element = static_cast<const Element*>(node);
+    return &index == &ids_ ? element->id() == key : element->has_class(key);
+}
+
+Element* Document::preceding_in_index(const Index& index, std::string_view key, const IndexedElements& indexed, Element* element) const
+{
+    // Look for the nearest element with the key in the tree on both sides,
+    // and for the place in the list from both of its ends by comparing tree
+    // order, with a budget of steps for each that doubles every round, so
+    // that the cost is about that of whichever gets there first: the tree
+    // when the key is common, the list when it is rare. Every other
+    // connected element with the key is already in the list; those of a run
+    // still being connected after `element` are not connected yet.
+    Traversal::PreorderIterator after(element, const_cast<Document*>(this));
+    Node* before = element;
+    auto* first = indexed.first;
+    auto* last = indexed.last;
+    for (std::size_t budget = 8;; budget *= 2) {
+        for (std::size_t i = 0; i < budget && (before || *after); i++) {
+            if (before && (before = preceding(before)) && indexed_with(index, key, before)) {
+                return static_cast<Element*>(before);
+            }
+            if (*after && *++after && indexed_with(index, key, *after)) {
+                return links_in(index, key, static_cast<Element*>(*after)).previous;
+            }
+        }
+
+        for (auto steps = budget;;) {
+            auto order = precedes(last, element, steps);
+            if (!order) {
+                break;
+            }
+            if (*order) {
+                return last;
+            }
+            if (!(last = links_in(index, key, last).previous)) {
+                return nullptr;
+            }
+        }
+        for (auto steps = budget;;) {
+            auto order = precedes(element, first, steps);
+            if (!order) {
+                break;
+            }
+            if (*order) {
+                return links_in(index, key, first).previous;
+            }
+            if (!(first = links_in(index, key, first).next)) {
+                return indexed.last;
+            }
+        }
+    }
+}
+
+const Document::IndexedElements* Document::lookup(Index& index, std::string_view key)
+{
+    update_indexes();
+    auto it = index.find(key);
+    return it != index.end() ? &it->second : nullptr;
+}
+
+Element* Document::get_element_by_id(std::string_view element_id)
+{
+    auto* elements = lookup(ids_, element_id);
+    return elements ? elements->first : nullptr;
+}
+
+HTMLCollection Document::get_elements_by_class_name(std::string_view class_names)
+{
+    return HTMLCollection(this, class_names);
+}
+
+void Document::update_indexes()
+{
+    if (!indexes_stale_) {
+        return;
+    }
+    ids_.clear();
+    classes_.clear();
+    for (auto* node : Traversal::preorder(this)) {
+        if (node->node_type() == Node::Type::ELEMENT_NODE) {
+            index_element(static_cast<Element*>(node), true);
+        }
+    }
+    indexes_stale_ = false;
+    index_version_++;
+}
@@ -1,15 +1,184 @@
 #pragma once
 
+#include "dom/html_collection.h"
 #include "dom/node.h"
+#include "html/atoms.h"
+#include "util/arena.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class DocumentFragment;
+class Element;
+class Text;
+struct IndexLinks;
 
 /// @brief DOM Document
 ///
 /// https://dom.spec.whatwg.org/#interface-document
+///
+/// Owns the storage of every node created through it, and of their names,
+/// attributes and data. Destroying the document frees all of it at once.
+///
+/// Connected elements are indexed by ID and by class as they are attached,
+/// so looking them up takes no walk over the tree. A MutationBatch puts that
+/// off until it closes.
 class Document : public Node {
 protected:
+    Arena arena_;
+    /// @brief The texts the document was given to parse, shared with
+    /// whoever else holds on to them, the current one last. Text nodes refer
+    /// to slices of them, so none is let go before the document.
+    std::vector<std::shared_ptr<const std::string>> sources_;
+
+private:
+    /// @brief The connected elements with one key in tree order, linked
+    /// through their index records. An element goes in at its place in tree
+    /// order and is unlinked on removal, so that the list never needs
+    /// sorting.
+    struct IndexedElements {
+        Element* first = nullptr;
+        Element* last = nullptr;
+        std::size_t size = 0;
+    };
+    /// @brief Keys view attribute values in the arena, which outlives every
+    /// entry. IDs and classes are author strings, unlike tag and attribute
+    /// names, so there are no static atoms for them, and interning them per
+    /// document would cost a second hash lookup per key for no fewer
+    /// compares. Entries go away with their last element.
+    using Index = std::unordered_map<std::string_view, IndexedElements>;
+
+    Index ids_;
+    Index classes_;
+    /// @brief Bumped by every change to the indexes, so that live collections
+    /// know when to look again.
+    std::uint64_t index_version_ = 0;
+    /// @brief How many MutationBatch scopes are open.
+    std::uint32_t batch_depth_ = 0;
+    /// @brief Whether a batch changed something the indexes hold, so that
+    /// they must be built again before they are read.
+    bool indexes_stale_ = false;
+
+    friend class Node;
+    friend class Element;
+    friend class HTMLCollection;
+
+    /// @brief Marks the subtrees of the siblings `first` to `last`, just
+    /// attached to a connected parent, connected and indexes their elements.
+    void connect(Node* first, Node* last);
+    /// @brief Marks the subtree of `node`, about to be removed from its
+    /// connected parent, disconnected and drops its elements from the
+    /// indexes.
+    void disconnect(Node* node);
+    /// @brief Whether changes to the indexes for `element` wait for the
+    /// open batch to close. Marks the indexes stale if it has an ID or a
+    /// class.
+    bool defer_indexing(const Element* element);
+    /// @brief Indexes the ID or the classes of a connected element, after
+    /// they were set.
+    void index_attribute(Element* element, AttrId id);
+    /// @brief Drops the ID or the classes of a connected element from the
+    /// indexes, before they change.
+    void unindex_attribute(Element* element, AttrId id);
+    void index_element(Element* element, bool at_end);
+    void unindex_element(Element* element);
+    void add_to_index(Index& index, std::string_view key, Element* element, bool at_end);
+    void remove_from_index(Index& index, std::string_view key, Element* element);
+    /// @brief The links of `element` in the list of `key` in `index`, its ID
+    /// or one of its classes.
+    IndexLinks& links_in(const Index& index, std::string_view key, const Element* element) const;
+    /// @brief Whether `node` is a connected element with `key`, one of the
+    /// keys of `index`.
+    bool indexed_with(const Index& index, std::string_view key, const Node* node) const;
+    /// @brief The last element in the list of `key` before `element` in tree
+    /// order, or null if there is none.
+    Element* preceding_in_index(const Index& index, std::string_view key, const IndexedElements& indexed, Element* element) const;
+    /// @brief The connected elements with `key` in tree order, or null.
+    const IndexedElements* lookup(Index& index, std::string_view key);
+    /// @brief Builds the indexes again with one walk over the document if a
+    /// batch left them stale, even while it is still open.
+    void update_indexes();
+
 public:
     Document()
-        : Node(Node::Type::DOCUMENT_NODE)
+        : Node(Node::Type::DOCUMENT_NODE, this)
+    {
+        connected_ = true;
+        ends_document_ = true;
+    }
+
+    Arena& arena() { return arena_; }
+
+    /// @brief Defers index maintenance while it is open: nodes attached,
+    /// removed or given other IDs and classes only mark the indexes stale,
+    /// and closing the outermost batch builds them again with one walk and
+    /// invalidates live collections once. Lookups during the batch are still
+    /// correct, but each one after a change pays for that walk.
+    class MutationBatch {
+        Document& document_;
+
+    public:
+        explicit MutationBatch(Document& document)
+            : document_(document)
+        {
+            document_.batch_depth_++;
+        }
+        ~MutationBatch()
+        {
+            if (--document_.batch_depth_ == 0) {
+                document_.update_indexes();
+            }
+        }
+
+        MutationBatch(const MutationBatch&) = delete;
+        MutationBatch& operator=(const MutationBatch&) = delete;
+    };
+
+    /// @brief Makes `source` the current source and keeps it alive for as
+    /// long as the document, so that text taken from it needs no copy. Text
+    /// nodes taken from earlier sources keep referring to them, so those
+    /// stay alive too.
+    void set_source(std::shared_ptr<const std::string> source) { sources_.push_back(std::move(source)); }
+    std::string_view source() const
+    {
+        return !sources_.empty() && sources_.back() ? std::string_view(*sources_.back()) : std::string_view();
+    }
+    /// @brief Whether `text` is a view of source().
+    bool in_source(std::string_view text) const
     {
+        auto source = this->source();
+        auto begin = reinterpret_cast<std::uintptr_t>(source.data());
+        auto data = reinterpret_cast<std::uintptr_t>(text.data());
+        return !source.empty() && data >= begin && data + text.size() <= begin + source.size();
     }
-};
\ No newline at end of file
+
+    /// @brief https://dom.spec.whatwg.org/#dom-document-createelement
+    /// The element gets room for `attribute_capacity` attributes in the same
+    /// allocation, so that adding that many takes no other.
+    Element* create_element(std::string_view local_name, std::uint32_t attribute_capacity = 0);
+    /// @brief Like create_element(local_name, attribute_capacity) for a name
+    /// whose atom is known, such as the tokenizer's. `local_name` is only
+    /// read if `id` is `TagId::Unknown`.
+    Element* create_element(TagId id, std::string_view local_name, std::uint32_t attribute_capacity = 0);
+
+    /// @brief https://dom.spec.whatwg.org/#dom-document-createtextnode
+    /// Data in source() is not copied, see Text.
+    Text* create_text_node(std::string_view data);
+
+    /// @brief https://dom.spec.whatwg.org/#dom-document-createdocumentfragment
+    DocumentFragment* create_document_fragment();
+
+    /// @brief https://dom.spec.whatwg.org/#dom-nonelementparentnode-getelementbyid
+    /// The first connected element in tree order whose ID is `element_id`.
+    Element* get_element_by_id(std::string_view element_id);
+
+    /// @brief https://dom.spec.whatwg.org/#dom-document-getelementsbyclassname
+    /// A live collection of the connected elements that have every class in
+    /// the space-separated `class_names`. It refers to the document, so it
+    /// must not outlive it.
+    HTMLCollection get_elements_by_class_name(std::string_view class_names);
+};
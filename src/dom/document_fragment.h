@@ -0,0 +1,18 @@
+#pragma once
+
+#include "dom/node.h"
+
+/// @brief DOM DocumentFragment
+///
+/// https://dom.spec.whatwg.org/#interface-documentfragment
+///
+/// A parentless container for building a run of nodes off the document.
+/// Inserting it moves its children into place with one splice, and touches
+/// the document's indexes once per inserted subtree.
+class DocumentFragment : public Node {
+public:
+    explicit DocumentFragment(Document* node_document)
+        : Node(Node::Type::DOCUMENT_FRAGMENT_NODE, node_document)
+    {
+    }
+};
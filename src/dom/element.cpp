@@ -0,0 +1,142 @@
+#include "element.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dom/document.h"
+#include "util/char_util.h"
+
+const Attr* Element::attribute(std::string_view name) const
+{
+    // Known names are only ever stored with their atom.
+    auto id = Atoms::lookup_attr(name);
+    if (id != AttrId::Unknown) {
+        return attribute(id);
+    }
+    for (const auto& attr : attributes()) {
+        if (attr.id() == AttrId::Unknown && attr.name() == name) {
+            return &attr;
+        }
+    }
+    return nullptr;
+}
+
+std::optional<std::string_view> Element::get_attribute(std::string_view name) const
+{
+    auto* attr = attribute(name);
+    return attr ? std::optional(attr->value()) : std::nullopt;
+}
+
+std::optional<std::string_view> Element::get_attribute(AttrId id) const
+{
+    auto* attr = attribute(id);
+    return attr ? std::optional(attr->value()) : std::nullopt;
+}
+
+std::string_view Element::id() const
+{
+    auto* attr = attribute(AttrId::Id);
+    return attr ? attr->value() : std::string_view();
+}
+
+std::string_view Element::class_name() const
+{
+    auto* attr = attribute(AttrId::Class);
+    return attr ? attr->value() : std::string_view();
+}
+
+bool Element::has_class(std::string_view name) const
+{
+    auto classes = class_list();
+    return std::find(classes.begin(), classes.end(), name) != classes.end();
+}
+
+void Element::update_index_record()
+{
+    // https://dom.spec.whatwg.org/#concept-ordered-set-parser
+    // Count the tokens first, so that the record takes one allocation.
+    auto value = class_name();
+    std::size_t count = 0;
+    CharUtil::split_on_ascii_whitespace(value, [&](std::string_view) { count++; });
+    if (count == 0 && !has_attribute(AttrId::Id)) {
+        index_record_ = nullptr;
+        return;
+    }
+
+    auto& arena = node_document_->arena();
+    auto* storage = static_cast<std::size_t*>(arena.allocate(
+        sizeof(std::size_t) + sizeof(std::string_view) * count + sizeof(IndexLinks) * (1 + count),
+        alignof(std::string_view)));
+    auto* names = reinterpret_cast<std::string_view*>(storage + 1);
+    std::size_t size = 0;
+    CharUtil::split_on_ascii_whitespace(value, [&](std::string_view token) {
+        if (std::find(names, names + size, token) == names + size) {
+            new (&names[size++]) std::string_view(token);
+        }
+    });
+    *storage = size;
+    auto* links = reinterpret_cast<IndexLinks*>(names + size);
+    links[0] = index_record_ ? id_links() : IndexLinks {};
+    std::fill(links + 1, links + 1 + size, IndexLinks {});
+    index_record_ = storage;
+}
+
+void Element::append_attribute(std::string_view name, std::string_view value)
+{
+    append_attribute(Atoms::lookup_attr(name), name, value);
+}
+
+void Element::append_attribute(AttrId id, std::string_view name, std::string_view value)
+{
+    auto& arena = node_document_->arena();
+
+    if (attribute_count_ == attribute_capacity_) {
+        // The old array stays behind in the arena. Elements created by the
+        // parser get room for all of theirs up front, so this is rare.
+        auto capacity = std::max<std::uint32_t>(4, attribute_capacity_ * 2);
+        auto* attributes = arena.allocate_array<Attr>(capacity);
+        if (attribute_count_ > 0) {
+            std::memcpy(static_cast<void*>(attributes), attributes_,
+                sizeof(Attr) * attribute_count_);
+        }
+        attributes_ = attributes;
+        attribute_capacity_ = capacity;
+    }
+
+    // Only the first of several attributes with the same name counts.
+    bool first = (id != AttrId::Id && id != AttrId::Class) || !attribute(id);
+    auto stored_name = id != AttrId::Unknown ? Atoms::name_of(id) : arena.copy(name);
+    new (&attributes_[attribute_count_++]) Attr(id, stored_name, arena.copy(value));
+
+    if (first && (id == AttrId::Class || (id == AttrId::Id && !index_record_))) {
+        update_index_record();
+    }
+    if (first && connected_ && (id == AttrId::Id || id == AttrId::Class)) {
+        node_document_->index_attribute(this, id);
+    }
+}
+
+void Element::set_attribute(std::string_view name, std::string_view value)
+{
+    // The attribute is in this element's own storage.
+    auto* attr = const_cast<Attr*>(attribute(name));
+    if (!attr) {
+        append_attribute(name, value);
+        return;
+    }
+
+    auto id = attr->id();
+    bool indexed = connected_ && (id == AttrId::Id || id == AttrId::Class);
+    if (indexed) {
+        node_document_->unindex_attribute(this, id);
+    }
+    auto stored_value = node_document_->arena().copy(value);
+    attr->value_ = stored_value.data();
+    attr->value_size_ = static_cast<std::uint32_t>(stored_value.size());
+    if (id == AttrId::Class) {
+        update_index_record();
+    }
+    if (indexed) {
+        node_document_->index_attribute(this, id);
+    }
+}
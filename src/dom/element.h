@@ -2,24 +2,147 @@
 
 #include "dom/attr.h"
 #include "dom/node.h"
-#include <string>
-#include <vector>
+#include "html/atoms.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+class Element;
+
+/// @brief An element's neighbours in one of the document's index lists,
+/// both null while it is not in the list or alone in it.
+struct IndexLinks {
+    Element* previous;
+    Element* next;
+};
 
 /// @brief DOM Element
 ///
 /// https://dom.spec.whatwg.org/#interface-element
 class Element : public Node {
 protected:
+    TagId tag_id_;
     /// @brief local name
     /// A non-empty string.
     /// https://dom.spec.whatwg.org/#concept-element-local-name
-    std::string local_name_;
-    std::vector<Attr> attributes_;
+    std::string_view local_name_;
+    std::uint32_t attribute_count_ = 0;
+    std::uint32_t attribute_capacity_ = 0;
+    /// @brief Attribute list. It starts out in the room allocated right after
+    /// the element, and moves to a larger array in the document's arena if
+    /// more attributes are added than the element was created with room for.
+    Attr* attributes_ = nullptr;
+    /// @brief The classes of the class attribute, split once when it is set,
+    /// and the element's links in the document's index lists: a count, that
+    /// many views of the attribute value, the links for the ID, then the
+    /// links for each class, in the document's arena. Null while the element
+    /// has neither an ID attribute nor a class.
+    std::size_t* index_record_ = nullptr;
+
+    friend class Document;
+
+    /// @brief Allocates the index record again after the class attribute
+    /// changed, or for the first ID attribute. The links for the ID carry
+    /// over.
+    void update_index_record();
+    IndexLinks& id_links() const
+    {
+        return *reinterpret_cast<IndexLinks*>(reinterpret_cast<std::string_view*>(index_record_ + 1) + *index_record_);
+    }
+    /// @brief The links for the `i`th class of class_list().
+    IndexLinks& class_links(std::size_t i) const { return (&id_links())[1 + i]; }
 
 public:
-    Element(std::string_view local_name)
-        : Node(Node::Type::ELEMENT_NODE)
-        , local_name_(std::move(local_name))
+    /// @brief Use Document::create_element(), which keeps `local_name` alive
+    /// and allocates room for `inline_capacity` attributes right after the
+    /// element.
+    Element(Document* node_document, TagId tag_id, std::string_view local_name, std::uint32_t inline_capacity = 0)
+        : Node(Node::Type::ELEMENT_NODE, node_document)
+        , tag_id_(tag_id)
+        , local_name_(local_name)
+        , attribute_capacity_(inline_capacity)
+        , attributes_(inline_capacity > 0 ? reinterpret_cast<Attr*>(this + 1) : nullptr)
+    {
+    }
+
+    std::string_view local_name() const { return local_name_; }
+    /// @brief The atom of the local name, `TagId::Unknown` if it has none.
+    TagId tag_id() const { return tag_id_; }
+
+    /// @brief A view of the attribute list.
+    struct Attributes {
+        const Attr* data;
+        std::uint32_t count;
+
+        const Attr* begin() const { return data; }
+        const Attr* end() const { return data + count; }
+        std::uint32_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        const Attr& operator[](std::uint32_t i) const { return data[i]; }
+    };
+
+    Attributes attributes() const { return { attributes_, attribute_count_ }; }
+
+    /// @brief The first attribute named `name`, or null.
+    /// https://dom.spec.whatwg.org/#concept-element-attributes-get-by-name
+    const Attr* attribute(std::string_view name) const;
+    /// @brief Like attribute(name) for a known name, without comparing
+    /// strings. `id` must not be `AttrId::Unknown`.
+    const Attr* attribute(AttrId id) const
     {
+        for (const auto& attr : attributes()) {
+            if (attr.id() == id) {
+                return &attr;
+            }
+        }
+        return nullptr;
     }
-};
\ No newline at end of file
+
+    /// @brief https://dom.spec.whatwg.org/#dom-element-getattribute
+    std::optional<std::string_view> get_attribute(std::string_view name) const;
+    std::optional<std::string_view> get_attribute(AttrId id) const;
+    /// @brief https://dom.spec.whatwg.org/#dom-element-hasattribute
+    bool has_attribute(std::string_view name) const { return attribute(name) != nullptr; }
+    bool has_attribute(AttrId id) const { return attribute(id) != nullptr; }
+
+    /// @brief https://dom.spec.whatwg.org/#dom-element-id
+    std::string_view id() const;
+    /// @brief https://dom.spec.whatwg.org/#dom-element-classname
+    std::string_view class_name() const;
+
+    /// @brief A view of the class list.
+    struct ClassList {
+        const std::string_view* data;
+        std::size_t count;
+
+        const std::string_view* begin() const { return data; }
+        const std::string_view* end() const { return data + count; }
+        std::size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+    };
+
+    /// @brief The classes of class_name(), each once, in order.
+    /// https://dom.spec.whatwg.org/#dom-element-classlist
+    ClassList class_list() const
+    {
+        if (!index_record_) {
+            return { nullptr, 0 };
+        }
+        return { reinterpret_cast<const std::string_view*>(index_record_ + 1), *index_record_ };
+    }
+    /// @brief Whether `name` is one of the classes in class_list().
+    bool has_class(std::string_view name) const;
+
+    /// @brief https://dom.spec.whatwg.org/#concept-element-attributes-append
+    /// Adding an ID or class to a connected element updates the document's
+    /// indexes.
+    void append_attribute(std::string_view name, std::string_view value);
+    /// @brief Like append_attribute(name, value) for a name whose atom is
+    /// known. `name` is only read if `id` is `AttrId::Unknown`.
+    void append_attribute(AttrId id, std::string_view name, std::string_view value);
+
+    /// @brief https://dom.spec.whatwg.org/#dom-element-setattribute
+    /// Changes the value of the first attribute named `name`, or appends one.
+    void set_attribute(std::string_view name, std::string_view value);
+};
@@ -0,0 +1,91 @@
+#include "html_collection.h"
+
+#include "dom/document.h"
+#include "dom/element.h"
+#include "util/char_util.h"
+
+HTMLCollection::HTMLCollection(Document* document, std::string_view class_names)
+    : document_(document)
+    , version_(document->index_version_ - 1)
+{
+    CharUtil::split_on_ascii_whitespace(class_names, [this](std::string_view name) {
+        classes_.emplace_back(name);
+    });
+}
+
+void HTMLCollection::update()
+{
+    // Changes made in a batch only show in the version once the indexes are
+    // built again.
+    document_->update_indexes();
+    if (version_ == document_->index_version_) {
+        return;
+    }
+    version_ = document_->index_version_;
+    elements_.clear();
+    next_ = nullptr;
+    known_length_ = 0;
+    if (classes_.empty()) {
+        return;
+    }
+
+    // Start from the class with the fewest elements and keep those that have
+    // the other classes too.
+    const Document::IndexedElements* candidates = nullptr;
+    for (std::size_t i = 0; i < classes_.size(); i++) {
+        auto* elements = document_->lookup(document_->classes_, classes_[i]);
+        if (!elements) {
+            return;
+        }
+        if (!candidates || elements->size < candidates->size) {
+            candidates = elements;
+            key_ = i;
+        }
+    }
+    next_ = candidates->first;
+    known_length_ = candidates->size;
+    for (const auto& name : classes_) {
+        if (name != classes_[key_]) {
+            known_length_ = SIZE_MAX;
+        }
+    }
+}
+
+void HTMLCollection::find(std::size_t count)
+{
+    while (next_ && elements_.size() < count) {
+        auto* element = next_;
+        next_ = document_->links_in(document_->classes_, classes_[key_], element).next;
+        bool has_all = true;
+        for (const auto& name : classes_) {
+            has_all = has_all && element->has_class(name);
+        }
+        if (has_all) {
+            elements_.push_back(element);
+        }
+    }
+}
+
+std::size_t HTMLCollection::length()
+{
+    update();
+    if (known_length_ != SIZE_MAX) {
+        return known_length_;
+    }
+    find(SIZE_MAX);
+    return elements_.size();
+}
+
+Element* HTMLCollection::item(std::size_t index)
+{
+    update();
+    find(index + 1);
+    return index < elements_.size() ? elements_[index] : nullptr;
+}
+
+Element* const* HTMLCollection::begin()
+{
+    update();
+    find(SIZE_MAX);
+    return elements_.data();
+}
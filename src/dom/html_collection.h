@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Document;
+class Element;
+
+/// @brief DOM HTMLCollection
+///
+/// https://dom.spec.whatwg.org/#interface-htmlcollection
+///
+/// A live list of the elements with a set of classes: it is brought up to
+/// date from the document's class index whenever the index changed since it
+/// was last read, and only as far as the reads go.
+class HTMLCollection {
+    Document* document_;
+    /// @brief Copies, so that the collection does not depend on the caller's
+    /// string.
+    std::vector<std::string> classes_;
+    /// @brief The elements found so far, in tree order.
+    std::vector<Element*> elements_;
+    /// @brief The class with the fewest elements, whose list is walked.
+    std::size_t key_ = 0;
+    /// @brief The next element of that list to look at, null once the walk
+    /// reached its end.
+    Element* next_ = nullptr;
+    /// @brief How many elements the list has, when all of them belong to the
+    /// collection, or `SIZE_MAX`.
+    std::size_t known_length_ = 0;
+    /// @brief The document's index version the walk started at.
+    std::uint64_t version_;
+
+    void update();
+    /// @brief Walks on until `elements_` has `count` elements or the walk
+    /// ends.
+    void find(std::size_t count);
+
+public:
+    HTMLCollection(Document* document, std::string_view class_names);
+
+    /// @brief https://dom.spec.whatwg.org/#dom-htmlcollection-length
+    std::size_t length();
+    /// @brief https://dom.spec.whatwg.org/#dom-htmlcollection-item
+    /// Null when `index` is out of range.
+    Element* item(std::size_t index);
+
+    /// @brief Iterating does not update the collection, so the document must
+    /// not change meanwhile.
+    Element* const* begin();
+    Element* const* end() { return elements_.data() + elements_.size(); }
+};
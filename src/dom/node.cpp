@@ -1,34 +1,111 @@
 #include "node.h"
 
-Node::~Node()
+#include "dom/document.h"
+
+bool Node::can_insert(const Node* node) const
 {
-    // TODO: avoid stack overflow
-    Node* child = first_child_;
-    while (child) {
-        Node* next = child->next_sibling_;
-        delete child;
-        child = next;
+    if (!node || node->node_document_ != node_document_ || node_type_ == Type::TEXT_NODE
+        || node->node_type_ == Type::DOCUMENT_NODE) {
+        return false;
+    }
+    // Only a node with children can be an ancestor, so the nodes the parser
+    // creates and appends take no walk up the tree.
+    if (node == this) {
+        return false;
     }
+    if (node->first_child_) {
+        for (auto* ancestor = parent_; ancestor; ancestor = ancestor->parent_) {
+            if (ancestor == node) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
-void Node::append_child(std::unique_ptr<Node> node)
+void Node::insert(Node* node, Node* child)
 {
-    if (!node) {
-        return;
+    auto* first = node;
+    auto* last = node;
+    if (node->node_type_ == Type::DOCUMENT_FRAGMENT_NODE) {
+        first = node->first_child_;
+        last = node->last_child_;
+        if (!first) {
+            return;
+        }
+        for (auto* moved = first; moved; moved = moved->next_sibling_) {
+            moved->parent_ = this;
+        }
+        node->first_child_ = nullptr;
+        node->last_child_ = nullptr;
+    } else {
+        node->parent_ = this;
     }
 
-    Node* child = node.release();
+    // One splice for the whole run of nodes.
+    auto* previous = child ? child->previous_sibling_ : last_child_;
+    first->previous_sibling_ = previous;
+    last->next_sibling_ = child;
+    (previous ? previous->next_sibling_ : first_child_) = first;
+    (child ? child->previous_sibling_ : last_child_) = last;
 
-    child->parent_ = this;
+    if (connected_) {
+        node_document_->connect(first, last);
+    }
+}
 
-    if (last_child_) {
-        last_child_->next_sibling_ = child;
-        child->previous_sibling_ = last_child_;
-        last_child_ = child;
-    } else {
-        first_child_ = child;
-        last_child_ = child;
+void Node::remove()
+{
+    if (connected_) {
+        node_document_->disconnect(this);
     }
+    (previous_sibling_ ? previous_sibling_->next_sibling_ : parent_->first_child_) = next_sibling_;
+    (next_sibling_ ? next_sibling_->previous_sibling_ : parent_->last_child_) = previous_sibling_;
+    parent_ = nullptr;
+    previous_sibling_ = nullptr;
+    next_sibling_ = nullptr;
+}
 
-    child->next_sibling_ = nullptr;
-}
\ No newline at end of file
+Node* Node::insert_before(Node* node, Node* child)
+{
+    if (!can_insert(node) || (child && child->parent_ != this)) {
+        return nullptr;
+    }
+    if (child == node) {
+        child = node->next_sibling_;
+    }
+    if (node->parent_) {
+        node->remove();
+    }
+    insert(node, child);
+    return node;
+}
+
+Node* Node::replace_child(Node* node, Node* child)
+{
+    if (!can_insert(node) || !child || child->parent_ != this) {
+        return nullptr;
+    }
+    if (child == node) {
+        return child;
+    }
+    auto* reference = child->next_sibling_;
+    if (reference == node) {
+        reference = node->next_sibling_;
+    }
+    if (node->parent_) {
+        node->remove();
+    }
+    child->remove();
+    insert(node, reference);
+    return child;
+}
+
+Node* Node::remove_child(Node* child)
+{
+    if (!child || child->parent_ != this) {
+        return nullptr;
+    }
+    child->remove();
+    return child;
+}
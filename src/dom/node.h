@@ -1,19 +1,36 @@
 #pragma once
 
-#include <memory>
+#include <cstdint>
+
+class Document;
 
 /// @brief DOM Node
 ///
 /// https://dom.spec.whatwg.org/#node
+///
+/// Nodes live in the arena of their node document and are created through
+/// Document. They are never destroyed one by one: destroying the document
+/// releases them all at once, so no destructor walks the tree. Walks over
+/// a subtree go through dom/traversal.h, which needs no recursion either.
 class Node {
-protected:
+public:
     /// @brief Node Type
     /// https://dom.spec.whatwg.org/#dom-node-nodetype
     enum class Type {
         ELEMENT_NODE = 1,
         TEXT_NODE = 3,
         DOCUMENT_NODE = 9,
-    } node_type_;
+        DOCUMENT_FRAGMENT_NODE = 11,
+    };
+
+protected:
+    Type node_type_;
+    /// @brief Byte offset in the source document where the node starts.
+    /// Turn it into a line and column with a LineIndex over the same input.
+    std::uint32_t source_offset_ = 0;
+    /// @brief Node Document
+    /// https://dom.spec.whatwg.org/#concept-node-document
+    Document* node_document_;
     /// @brief Tree Parent
     /// https://dom.spec.whatwg.org/#concept-tree-parent
     Node* parent_ = nullptr;
@@ -21,28 +38,70 @@ protected:
     Node* last_child_ = nullptr;
     Node* previous_sibling_ = nullptr;
     Node* next_sibling_ = nullptr;
+    // The flags come last, so that subclasses can pack small members in
+    // after them.
+    /// @brief Whether the root of the node's tree is its document, kept up
+    /// to date as subtrees are attached so that it costs no walk to the root.
+    /// https://dom.spec.whatwg.org/#connected
+    bool connected_ = false;
+    /// @brief Whether the node is connected and nothing follows its subtree
+    /// in tree order: it is the document or a last child of such a node.
+    bool ends_document_ = false;
+
+    friend class Document;
+
+    /// @brief https://dom.spec.whatwg.org/#concept-node-ensure-pre-insertion-validity
+    /// Leaves out the checks on the children of a document, which the
+    /// parser does not follow yet, and refuses nodes of other documents,
+    /// whose storage this document does not own.
+    bool can_insert(const Node* node) const;
+    /// @brief https://dom.spec.whatwg.org/#concept-node-insert
+    /// Links `node`, or the children of a fragment, in before `child`.
+    void insert(Node* node, Node* child);
+    /// @brief https://dom.spec.whatwg.org/#concept-node-remove
+    /// Unlinks the node from its parent.
+    void remove();
 
 public:
-    Node(Node::Type type)
+    Node(Node::Type type, Document* node_document)
         : node_type_(type)
+        , node_document_(node_document)
     {
     }
 
-    virtual ~Node();
+    virtual ~Node() = default;
 
     Node(const Node&) = delete;
     Node& operator=(const Node&) = delete;
     Node(Node&&) = delete;
     Node& operator=(Node&&) = delete;
 
+    Type node_type() const { return node_type_; }
+    std::uint32_t source_offset() const { return source_offset_; }
+    void set_source_offset(std::uint32_t offset) { source_offset_ = offset; }
+    Document* owner_document() const { return node_document_; }
+    /// @brief https://dom.spec.whatwg.org/#dom-node-isconnected
+    bool is_connected() const { return connected_; }
     Node* parent_node() const { return parent_; }
     Node* first_child() const { return first_child_; }
     Node* last_child() const { return last_child_; }
     Node* next_sibling() const { return next_sibling_; }
     Node* previous_sibling() const { return previous_sibling_; }
 
-    // void insert_before(std::unique_ptr<Node> node, Node* child);
-    void append_child(std::unique_ptr<Node> node);
-    // void replace_before(std::unique_ptr<Node> node, Node* child);
-    // std::unique_ptr<Node> remove_child(Node* child);
-};
\ No newline at end of file
+    // These take the node out of its current parent first. Where the spec
+    // throws, they change nothing and return null instead. Inserting a
+    // DocumentFragment moves all of its children, leaving it empty. Links
+    // are updated in constant time; connected subtrees also update the
+    // document's indexes, which Document::MutationBatch defers.
+    /// @brief https://dom.spec.whatwg.org/#dom-node-insertbefore
+    /// Inserts at the end when `child` is null. Returns `node`.
+    Node* insert_before(Node* node, Node* child);
+    /// @brief https://dom.spec.whatwg.org/#dom-node-appendchild
+    Node* append_child(Node* node) { return insert_before(node, nullptr); }
+    /// @brief https://dom.spec.whatwg.org/#dom-node-replacechild
+    /// Returns `child`.
+    Node* replace_child(Node* node, Node* child);
+    /// @brief https://dom.spec.whatwg.org/#dom-node-removechild
+    /// Returns `child`, which stays in the document's arena.
+    Node* remove_child(Node* child);
+};
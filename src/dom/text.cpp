@@ -0,0 +1,40 @@
+#include "text.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "dom/document.h"
+
+void Text::append_data(std::string_view data)
+{
+    if (data.empty()) {
+        return;
+    }
+
+    // The slice must stay within the current source, which earlier slices
+    // may not be in.
+    if (capacity_ == 0 && (size_ == 0 || data_ + size_ == data.data())
+        && node_document_->in_source({ size_ == 0 ? data.data() : data_, size_ + data.size() })) {
+        if (size_ == 0) {
+            data_ = data.data();
+        }
+        size_ += data.size();
+        return;
+    }
+
+    if (size_ + data.size() > capacity_) {
+        // Grow geometrically so that a node built from many small pieces
+        // costs linear time; the old buffer stays behind in the arena.
+        auto capacity = std::max(size_ + data.size(), capacity_ * 2);
+        auto* buffer = node_document_->arena().allocate_array<char>(capacity);
+        if (size_ > 0) {
+            std::memcpy(buffer, data_, size_);
+        }
+        data_ = buffer;
+        capacity_ = capacity;
+    }
+
+    // Only arena buffers have a capacity, so this is not the source.
+    std::memcpy(const_cast<char*>(data_) + size_, data.data(), data.size());
+    size_ += data.size();
+}
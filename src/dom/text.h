@@ -1,20 +1,38 @@
 #pragma once
 
 #include "dom/node.h"
-#include <string>
+#include <cstddef>
 #include <string_view>
 
 /// @brief DOM Text
 ///
 /// https://dom.spec.whatwg.org/#interface-text
+///
+/// Text that comes verbatim from the document's source is not copied: the
+/// node refers to a slice of the source until it is changed in a way the
+/// source does not match.
 class Text : public Node {
 protected:
-    std::string data_;
+    /// @brief Data, a slice of one of the document's sources while
+    /// `capacity_` is 0, else a buffer in the document's arena.
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
 
 public:
-    Text(std::string_view data)
-        : Node(Node::Type::TEXT_NODE)
-        , data_(std::move(data))
+    /// @brief Use Document::create_text_node().
+    explicit Text(Document* node_document)
+        : Node(Node::Type::TEXT_NODE, node_document)
     {
     }
-};
\ No newline at end of file
+
+    std::string_view data() const { return { data_, size_ }; }
+    /// @brief Whether the data is a slice of a source of the document rather
+    /// than a copy.
+    bool shares_source() const { return capacity_ == 0 && size_ > 0; }
+
+    /// @brief https://dom.spec.whatwg.org/#concept-cd-append
+    /// Data that directly follows a slice of the source in the source only
+    /// extends the slice. Anything else copies the data to the arena first.
+    void append_data(std::string_view data);
+};
@@ -0,0 +1,174 @@
+#include "traversal.h"
+
+NodeFilter::Result TreeWalker::filter_node(Node* node) const
+{
+    // Let n be node's nodeType attribute value - 1.
+    // If the nth bit (where 0 is the least significant bit) of traverser's
+    // whatToShow is not set, then return FILTER_SKIP.
+    auto n = static_cast<std::uint32_t>(node->node_type()) - 1;
+    if (!(what_to_show_ & (std::uint32_t { 1 } << n))) {
+        return NodeFilter::Result::FILTER_SKIP;
+    }
+
+    // If traverser's filter is null, then return FILTER_ACCEPT.
+    if (!filter_) {
+        return NodeFilter::Result::FILTER_ACCEPT;
+    }
+    return filter_(node);
+}
+
+Node* TreeWalker::parent_node()
+{
+    // https://dom.spec.whatwg.org/#dom-treewalker-parentnode
+    auto* node = current_;
+    while (node && node != root_) {
+        node = node->parent_node();
+        if (node && filter_node(node) == NodeFilter::Result::FILTER_ACCEPT) {
+            current_ = node;
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+Node* TreeWalker::traverse_children(Direction direction)
+{
+    // https://dom.spec.whatwg.org/#concept-traverse-children
+    bool first = direction == Direction::First;
+    auto* node = first ? current_->first_child() : current_->last_child();
+    while (node) {
+        auto result = filter_node(node);
+        if (result == NodeFilter::Result::FILTER_ACCEPT) {
+            current_ = node;
+            return node;
+        }
+
+        if (result == NodeFilter::Result::FILTER_SKIP) {
+            auto* child = first ? node->first_child() : node->last_child();
+            if (child) {
+                node = child;
+                continue;
+            }
+        }
+
+        while (node) {
+            auto* sibling = first ? node->next_sibling() : node->previous_sibling();
+            if (sibling) {
+                node = sibling;
+                break;
+            }
+            auto* parent = node->parent_node();
+            if (!parent || parent == root_ || parent == current_) {
+                return nullptr;
+            }
+            node = parent;
+        }
+    }
+    return nullptr;
+}
+
+Node* TreeWalker::traverse_siblings(Direction direction)
+{
+    // https://dom.spec.whatwg.org/#concept-traverse-siblings
+    bool next = direction == Direction::Next;
+    auto* node = current_;
+    if (node == root_) {
+        return nullptr;
+    }
+
+    while (true) {
+        auto* sibling = next ? node->next_sibling() : node->previous_sibling();
+        while (sibling) {
+            node = sibling;
+            auto result = filter_node(node);
+            if (result == NodeFilter::Result::FILTER_ACCEPT) {
+                current_ = node;
+                return node;
+            }
+            sibling = next ? node->first_child() : node->last_child();
+            if (result == NodeFilter::Result::FILTER_REJECT || !sibling) {
+                sibling = next ? node->next_sibling() : node->previous_sibling();
+            }
+        }
+
+        node = node->parent_node();
+        if (!node || node == root_) {
+            return nullptr;
+        }
+        if (filter_node(node) == NodeFilter::Result::FILTER_ACCEPT) {
+            return nullptr;
+        }
+    }
+}
+
+Node* TreeWalker::previous_node()
+{
+    // https://dom.spec.whatwg.org/#dom-treewalker-previousnode
+    auto* node = current_;
+    while (node != root_) {
+        auto* sibling = node->previous_sibling();
+        while (sibling) {
+            node = sibling;
+            auto result = filter_node(node);
+            while (result != NodeFilter::Result::FILTER_REJECT && node->last_child()) {
+                node = node->last_child();
+                result = filter_node(node);
+            }
+            if (result == NodeFilter::Result::FILTER_ACCEPT) {
+                current_ = node;
+                return node;
+            }
+            sibling = node->previous_sibling();
+        }
+
+        if (node == root_ || !node->parent_node()) {
+            return nullptr;
+        }
+        node = node->parent_node();
+        if (filter_node(node) == NodeFilter::Result::FILTER_ACCEPT) {
+            current_ = node;
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+Node* TreeWalker::next_node()
+{
+    // https://dom.spec.whatwg.org/#dom-treewalker-nextnode
+    auto* node = current_;
+    auto result = NodeFilter::Result::FILTER_ACCEPT;
+    while (true) {
+        while (result != NodeFilter::Result::FILTER_REJECT && node->first_child()) {
+            node = node->first_child();
+            result = filter_node(node);
+            if (result == NodeFilter::Result::FILTER_ACCEPT) {
+                current_ = node;
+                return node;
+            }
+        }
+
+        // Move on to the next node after the subtree just left, if it is
+        // still under the root.
+        Node* sibling = nullptr;
+        for (auto* temporary = node; temporary; temporary = temporary->parent_node()) {
+            if (temporary == root_) {
+                return nullptr;
+            }
+            sibling = temporary->next_sibling();
+            if (sibling) {
+                break;
+            }
+        }
+        if (!sibling) {
+            return nullptr;
+        }
+
+        node = sibling;
+        result = filter_node(node);
+        if (result == NodeFilter::Result::FILTER_ACCEPT) {
+            current_ = node;
+            return node;
+        }
+    }
+}
@@ -0,0 +1,256 @@
+#pragma once
+
+#include "dom/node.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+/// @brief Tree order walks over a node and its descendants.
+///
+/// They follow the parent and sibling links, so they take no stack and no
+/// allocation however deep the tree is. Nodes must not be moved or removed
+/// while a walk is on them or on their descendants.
+namespace Traversal {
+
+/// @brief Preorder: every node before its descendants.
+/// https://dom.spec.whatwg.org/#concept-tree-order
+class PreorderIterator {
+    Node* node_ = nullptr;
+    Node* root_ = nullptr;
+    bool skip_children_ = false;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Node*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Node* const*;
+    using reference = Node* const&;
+
+    PreorderIterator() = default;
+    PreorderIterator(Node* node, Node* root)
+        : node_(node)
+        , root_(root)
+    {
+    }
+
+    reference operator*() const { return node_; }
+
+    /// @brief Makes the next step leave out the descendants of the current
+    /// node, without looking at them.
+    void skip_children() { skip_children_ = true; }
+
+    PreorderIterator& operator++()
+    {
+        if (!skip_children_ && node_->first_child()) {
+            node_ = node_->first_child();
+            return *this;
+        }
+        skip_children_ = false;
+        for (auto* node = node_; node != root_; node = node->parent_node()) {
+            if (node->next_sibling()) {
+                node_ = node->next_sibling();
+                return *this;
+            }
+        }
+        node_ = nullptr;
+        return *this;
+    }
+
+    PreorderIterator operator++(int)
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(const PreorderIterator& a, const PreorderIterator& b) { return a.node_ == b.node_; }
+    friend bool operator!=(const PreorderIterator& a, const PreorderIterator& b) { return a.node_ != b.node_; }
+};
+
+/// @brief Postorder: every node after its descendants, so a node can be
+/// dropped once it has been visited.
+class PostorderIterator {
+    Node* node_ = nullptr;
+    Node* root_ = nullptr;
+
+    static Node* first_leaf(Node* node)
+    {
+        while (node->first_child()) {
+            node = node->first_child();
+        }
+        return node;
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Node*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Node* const*;
+    using reference = Node* const&;
+
+    PostorderIterator() = default;
+    /// @brief Starts at the first node in postorder under `root`.
+    explicit PostorderIterator(Node* root)
+        : node_(root ? first_leaf(root) : nullptr)
+        , root_(root)
+    {
+    }
+
+    reference operator*() const { return node_; }
+
+    PostorderIterator& operator++()
+    {
+        if (node_ == root_) {
+            node_ = nullptr;
+        } else if (node_->next_sibling()) {
+            node_ = first_leaf(node_->next_sibling());
+        } else {
+            node_ = node_->parent_node();
+        }
+        return *this;
+    }
+
+    PostorderIterator operator++(int)
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    friend bool operator==(const PostorderIterator& a, const PostorderIterator& b) { return a.node_ == b.node_; }
+    friend bool operator!=(const PostorderIterator& a, const PostorderIterator& b) { return a.node_ != b.node_; }
+};
+
+template <typename Iterator>
+struct Range {
+    Iterator first;
+
+    Iterator begin() const { return first; }
+    Iterator end() const { return {}; }
+};
+
+/// @brief `root` and its descendants in tree order.
+inline Range<PreorderIterator> preorder(Node* root) { return { { root, root } }; }
+
+/// @brief `root` and its descendants, children before their parent.
+inline Range<PostorderIterator> postorder(Node* root) { return { PostorderIterator(root) }; }
+
+} // namespace Traversal
+
+/// @brief NodeFilter
+///
+/// https://dom.spec.whatwg.org/#interface-nodefilter
+struct NodeFilter {
+    enum class Result {
+        FILTER_ACCEPT = 1,
+        /// @brief Leaves out the node and its descendants.
+        FILTER_REJECT = 2,
+        /// @brief Leaves out the node but not its descendants.
+        FILTER_SKIP = 3,
+    };
+
+    /// @brief Bits of `what_to_show`, bit n - 1 for node type n.
+    static constexpr std::uint32_t SHOW_ALL = 0xFFFFFFFF;
+    static constexpr std::uint32_t SHOW_ELEMENT = 0x1;
+    static constexpr std::uint32_t SHOW_TEXT = 0x4;
+    static constexpr std::uint32_t SHOW_DOCUMENT = 0x100;
+    static constexpr std::uint32_t SHOW_DOCUMENT_FRAGMENT = 0x400;
+};
+
+/// @brief DOM TreeWalker
+///
+/// https://dom.spec.whatwg.org/#interface-treewalker
+///
+/// Moves a current node around the tree under `root`, only stopping at nodes
+/// whose type is in `what_to_show` and that `filter` accepts. Rejecting a
+/// node passes over its whole subtree without looking at it.
+class TreeWalker {
+public:
+    using Filter = std::function<NodeFilter::Result(Node*)>;
+
+private:
+    Node* root_;
+    std::uint32_t what_to_show_;
+    Filter filter_;
+    Node* current_;
+
+    /// @brief https://dom.spec.whatwg.org/#concept-node-filter
+    NodeFilter::Result filter_node(Node* node) const;
+    enum class Direction {
+        First,
+        Last,
+        Next,
+        Previous,
+    };
+    Node* traverse_children(Direction direction);
+    Node* traverse_siblings(Direction direction);
+
+public:
+    explicit TreeWalker(Node* root, std::uint32_t what_to_show = NodeFilter::SHOW_ALL, Filter filter = {})
+        : root_(root)
+        , what_to_show_(what_to_show)
+        , filter_(std::move(filter))
+        , current_(root)
+    {
+    }
+
+    Node* root() const { return root_; }
+    std::uint32_t what_to_show() const { return what_to_show_; }
+    Node* current_node() const { return current_; }
+    void set_current_node(Node* node) { current_ = node; }
+
+    // Each of these moves the current node to the node it returns, and
+    // leaves it where it is when it returns null.
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-parentnode
+    Node* parent_node();
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-firstchild
+    Node* first_child() { return traverse_children(Direction::First); }
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-lastchild
+    Node* last_child() { return traverse_children(Direction::Last); }
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-previoussibling
+    Node* previous_sibling() { return traverse_siblings(Direction::Previous); }
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-nextsibling
+    Node* next_sibling() { return traverse_siblings(Direction::Next); }
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-previousnode
+    Node* previous_node();
+    /// @brief https://dom.spec.whatwg.org/#dom-treewalker-nextnode
+    Node* next_node();
+
+    /// @brief Walks on with next_node().
+    class Iterator {
+        TreeWalker* walker_ = nullptr;
+        Node* node_ = nullptr;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Node*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Node* const*;
+        using reference = Node* const&;
+
+        Iterator() = default;
+        Iterator(TreeWalker* walker, Node* node)
+            : walker_(walker)
+            , node_(node)
+        {
+        }
+
+        reference operator*() const { return node_; }
+        Iterator& operator++()
+        {
+            node_ = walker_->next_node();
+            return *this;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.node_ != b.node_; }
+    };
+
+    /// @brief The nodes that next_node() reaches from the current node, so
+    /// a new walker ranges over the shown and accepted descendants of its
+    /// root in tree order.
+    Iterator begin() { return { this, next_node() }; }
+    Iterator end() { return {}; }
+};
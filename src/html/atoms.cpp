@@ -0,0 +1,20 @@
+#include "atoms.h"
+
+#include <string_view>
+
+static_assert(Atoms::detail::kTagHash.finds_every_key());
+static_assert(Atoms::detail::kAttrHash.finds_every_key());
+
+std::string_view AtomInterner::intern(std::string_view name)
+{
+    auto it = names_.find(name);
+    if (it != names_.end()) {
+        return *it;
+    }
+
+    // std::deque never moves its elements, and the strings' own buffers stay
+    // put as well, so views into storage_ remain valid as it grows.
+    const auto& stored = storage_.emplace_back(name);
+    names_.insert(stored);
+    return stored;
+}
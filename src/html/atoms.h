@@ -0,0 +1,550 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+// Known HTML tag names, in the form X(identifier, "name").
+// https://html.spec.whatwg.org/multipage/indices.html#elements-3
+#define EVEN_HTML_TAG_NAMES(X) \
+    X(A, "a") \
+    X(Abbr, "abbr") \
+    X(Acronym, "acronym") \
+    X(Address, "address") \
+    X(Applet, "applet") \
+    X(Area, "area") \
+    X(Article, "article") \
+    X(Aside, "aside") \
+    X(Audio, "audio") \
+    X(B, "b") \
+    X(Base, "base") \
+    X(Basefont, "basefont") \
+    X(Bdi, "bdi") \
+    X(Bdo, "bdo") \
+    X(Bgsound, "bgsound") \
+    X(Big, "big") \
+    X(Blink, "blink") \
+    X(Blockquote, "blockquote") \
+    X(Body, "body") \
+    X(Br, "br") \
+    X(Button, "button") \
+    X(Canvas, "canvas") \
+    X(Caption, "caption") \
+    X(Center, "center") \
+    X(Cite, "cite") \
+    X(Code, "code") \
+    X(Col, "col") \
+    X(Colgroup, "colgroup") \
+    X(Data, "data") \
+    X(Datalist, "datalist") \
+    X(Dd, "dd") \
+    X(Del, "del") \
+    X(Details, "details") \
+    X(Dfn, "dfn") \
+    X(Dialog, "dialog") \
+    X(Dir, "dir") \
+    X(Div, "div") \
+    X(Dl, "dl") \
+    X(Dt, "dt") \
+    X(Em, "em") \
+    X(Embed, "embed") \
+    X(Fieldset, "fieldset") \
+    X(Figcaption, "figcaption") \
+    X(Figure, "figure") \
+    X(Font, "font") \
+    X(Footer, "footer") \
+    X(Form, "form") \
+    X(Frame, "frame") \
+    X(Frameset, "frameset") \
+    X(H1, "h1") \
+    X(H2, "h2") \
+    X(H3, "h3") \
+    X(H4, "h4") \
+    X(H5, "h5") \
+    X(H6, "h6") \
+    X(Head, "head") \
+    X(Header, "header") \
+    X(Hgroup, "hgroup") \
+    X(Hr, "hr") \
+    X(Html, "html") \
+    X(I, "i") \
+    X(Iframe, "iframe") \
+    X(Image, "image") \
+    X(Img, "img") \
+    X(Input, "input") \
+    X(Ins, "ins") \
+    X(Isindex, "isindex") \
+    X(Kbd, "kbd") \
+    X(Keygen, "keygen") \
+    X(Label, "label") \
+    X(Legend, "legend") \
+    X(Li, "li") \
+    X(Link, "link") \
+    X(Listing, "listing") \
+    X(Main, "main") \
+    X(Map, "map") \
+    X(Mark, "mark") \
+    X(Marquee, "marquee") \
+    X(Math, "math") \
+    X(Menu, "menu") \
+    X(Meta, "meta") \
+    X(Meter, "meter") \
+    X(Nav, "nav") \
+    X(Nobr, "nobr") \
+    X(Noembed, "noembed") \
+    X(Noframes, "noframes") \
+    X(Noscript, "noscript") \
+    X(Object, "object") \
+    X(Ol, "ol") \
+    X(Optgroup, "optgroup") \
+    X(Option, "option") \
+    X(Output, "output") \
+    X(P, "p") \
+    X(Param, "param") \
+    X(Picture, "picture") \
+    X(Plaintext, "plaintext") \
+    X(Pre, "pre") \
+    X(Progress, "progress") \
+    X(Q, "q") \
+    X(Rb, "rb") \
+    X(Rp, "rp") \
+    X(Rt, "rt") \
+    X(Rtc, "rtc") \
+    X(Ruby, "ruby") \
+    X(S, "s") \
+    X(Samp, "samp") \
+    X(Script, "script") \
+    X(Search, "search") \
+    X(Section, "section") \
+    X(Select, "select") \
+    X(Slot, "slot") \
+    X(Small, "small") \
+    X(Source, "source") \
+    X(Span, "span") \
+    X(Strike, "strike") \
+    X(Strong, "strong") \
+    X(Style, "style") \
+    X(Sub, "sub") \
+    X(Summary, "summary") \
+    X(Sup, "sup") \
+    X(Svg, "svg") \
+    X(Table, "table") \
+    X(Tbody, "tbody") \
+    X(Td, "td") \
+    X(Template, "template") \
+    X(Textarea, "textarea") \
+    X(Tfoot, "tfoot") \
+    X(Th, "th") \
+    X(Thead, "thead") \
+    X(Time, "time") \
+    X(Title, "title") \
+    X(Tr, "tr") \
+    X(Track, "track") \
+    X(Tt, "tt") \
+    X(U, "u") \
+    X(Ul, "ul") \
+    X(Var, "var") \
+    X(Video, "video") \
+    X(Wbr, "wbr") \
+    X(Xmp, "xmp")
+
+// Known HTML attribute names, in the form X(identifier, "name").
+// https://html.spec.whatwg.org/multipage/indices.html#attributes-3
+#define EVEN_HTML_ATTRIBUTE_NAMES(X) \
+    X(Abbr, "abbr") \
+    X(Accept, "accept") \
+    X(AcceptCharset, "accept-charset") \
+    X(Accesskey, "accesskey") \
+    X(Action, "action") \
+    X(Align, "align") \
+    X(Alink, "alink") \
+    X(Allow, "allow") \
+    X(Allowfullscreen, "allowfullscreen") \
+    X(Alt, "alt") \
+    X(AriaChecked, "aria-checked") \
+    X(AriaControls, "aria-controls") \
+    X(AriaCurrent, "aria-current") \
+    X(AriaDescribedby, "aria-describedby") \
+    X(AriaDisabled, "aria-disabled") \
+    X(AriaExpanded, "aria-expanded") \
+    X(AriaHaspopup, "aria-haspopup") \
+    X(AriaHidden, "aria-hidden") \
+    X(AriaLabel, "aria-label") \
+    X(AriaLabelledby, "aria-labelledby") \
+    X(AriaLive, "aria-live") \
+    X(AriaSelected, "aria-selected") \
+    X(As, "as") \
+    X(Async, "async") \
+    X(Autocapitalize, "autocapitalize") \
+    X(Autocomplete, "autocomplete") \
+    X(Autofocus, "autofocus") \
+    X(Autoplay, "autoplay") \
+    X(Background, "background") \
+    X(Bgcolor, "bgcolor") \
+    X(Border, "border") \
+    X(Cellpadding, "cellpadding") \
+    X(Cellspacing, "cellspacing") \
+    X(Charset, "charset") \
+    X(Checked, "checked") \
+    X(Cite, "cite") \
+    X(Class, "class") \
+    X(Clear, "clear") \
+    X(Color, "color") \
+    X(Cols, "cols") \
+    X(Colspan, "colspan") \
+    X(Content, "content") \
+    X(Contenteditable, "contenteditable") \
+    X(Controls, "controls") \
+    X(Coords, "coords") \
+    X(Crossorigin, "crossorigin") \
+    X(Data, "data") \
+    X(Datetime, "datetime") \
+    X(Decoding, "decoding") \
+    X(Default, "default") \
+    X(Defer, "defer") \
+    X(Dir, "dir") \
+    X(Dirname, "dirname") \
+    X(Disabled, "disabled") \
+    X(Download, "download") \
+    X(Draggable, "draggable") \
+    X(Enctype, "enctype") \
+    X(Enterkeyhint, "enterkeyhint") \
+    X(Face, "face") \
+    X(Fetchpriority, "fetchpriority") \
+    X(For, "for") \
+    X(Form, "form") \
+    X(Formaction, "formaction") \
+    X(Formenctype, "formenctype") \
+    X(Formmethod, "formmethod") \
+    X(Formnovalidate, "formnovalidate") \
+    X(Formtarget, "formtarget") \
+    X(Frameborder, "frameborder") \
+    X(Headers, "headers") \
+    X(Height, "height") \
+    X(Hidden, "hidden") \
+    X(High, "high") \
+    X(Href, "href") \
+    X(Hreflang, "hreflang") \
+    X(Hspace, "hspace") \
+    X(HttpEquiv, "http-equiv") \
+    X(Id, "id") \
+    X(Inert, "inert") \
+    X(Inputmode, "inputmode") \
+    X(Integrity, "integrity") \
+    X(Is, "is") \
+    X(Ismap, "ismap") \
+    X(Itemid, "itemid") \
+    X(Itemprop, "itemprop") \
+    X(Itemref, "itemref") \
+    X(Itemscope, "itemscope") \
+    X(Itemtype, "itemtype") \
+    X(Kind, "kind") \
+    X(Label, "label") \
+    X(Lang, "lang") \
+    X(Language, "language") \
+    X(Link, "link") \
+    X(List, "list") \
+    X(Loading, "loading") \
+    X(Loop, "loop") \
+    X(Low, "low") \
+    X(Marginheight, "marginheight") \
+    X(Marginwidth, "marginwidth") \
+    X(Max, "max") \
+    X(Maxlength, "maxlength") \
+    X(Media, "media") \
+    X(Method, "method") \
+    X(Min, "min") \
+    X(Minlength, "minlength") \
+    X(Multiple, "multiple") \
+    X(Muted, "muted") \
+    X(Name, "name") \
+    X(Nomodule, "nomodule") \
+    X(Nonce, "nonce") \
+    X(Noshade, "noshade") \
+    X(Novalidate, "novalidate") \
+    X(Nowrap, "nowrap") \
+    X(Onblur, "onblur") \
+    X(Onchange, "onchange") \
+    X(Onclick, "onclick") \
+    X(Onerror, "onerror") \
+    X(Onfocus, "onfocus") \
+    X(Oninput, "oninput") \
+    X(Onkeydown, "onkeydown") \
+    X(Onkeyup, "onkeyup") \
+    X(Onload, "onload") \
+    X(Onmousedown, "onmousedown") \
+    X(Onmouseout, "onmouseout") \
+    X(Onmouseover, "onmouseover") \
+    X(Onmouseup, "onmouseup") \
+    X(Onsubmit, "onsubmit") \
+    X(Open, "open") \
+    X(Optimum, "optimum") \
+    X(Pattern, "pattern") \
+    X(Ping, "ping") \
+    X(Placeholder, "placeholder") \
+    X(Playsinline, "playsinline") \
+    X(Popover, "popover") \
+    X(Poster, "poster") \
+    X(Preload, "preload") \
+    X(Property, "property") \
+    X(Readonly, "readonly") \
+    X(Referrerpolicy, "referrerpolicy") \
+    X(Rel, "rel") \
+    X(Required, "required") \
+    X(Rev, "rev") \
+    X(Reversed, "reversed") \
+    X(Role, "role") \
+    X(Rows, "rows") \
+    X(Rowspan, "rowspan") \
+    X(Rules, "rules") \
+    X(Sandbox, "sandbox") \
+    X(Scope, "scope") \
+    X(Scrolling, "scrolling") \
+    X(Selected, "selected") \
+    X(Shape, "shape") \
+    X(Size, "size") \
+    X(Sizes, "sizes") \
+    X(Slot, "slot") \
+    X(Span, "span") \
+    X(Spellcheck, "spellcheck") \
+    X(Src, "src") \
+    X(Srcdoc, "srcdoc") \
+    X(Srclang, "srclang") \
+    X(Srcset, "srcset") \
+    X(Start, "start") \
+    X(Step, "step") \
+    X(Style, "style") \
+    X(Summary, "summary") \
+    X(Tabindex, "tabindex") \
+    X(Target, "target") \
+    X(Text, "text") \
+    X(Title, "title") \
+    X(Translate, "translate") \
+    X(Type, "type") \
+    X(Usemap, "usemap") \
+    X(Valign, "valign") \
+    X(Value, "value") \
+    X(Version, "version") \
+    X(Vlink, "vlink") \
+    X(Vspace, "vspace") \
+    X(Width, "width") \
+    X(Wrap, "wrap") \
+    X(Xmlns, "xmlns")
+
+/// @brief Atom of a known tag name.
+/// `Unknown` stands for every name that is not in the table.
+enum class TagId : std::uint16_t {
+    Unknown = 0,
+#define X(id, name) id,
+    EVEN_HTML_TAG_NAMES(X)
+#undef X
+};
+
+/// @brief Atom of a known attribute name.
+/// `Unknown` stands for every name that is not in the table.
+enum class AttrId : std::uint16_t {
+    Unknown = 0,
+#define X(id, name) id,
+    EVEN_HTML_ATTRIBUTE_NAMES(X)
+#undef X
+};
+
+namespace Atoms {
+
+namespace detail {
+
+    /// @brief FNV-1a, seeded, with a final avalanche so that the low bits used
+    /// for table indices depend on every input byte.
+    constexpr std::uint32_t hash(std::string_view s, std::uint32_t seed)
+    {
+        std::uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+        for (char c : s) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 16777619u;
+        }
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        return h;
+    }
+
+    constexpr std::size_t next_pow2(std::size_t n)
+    {
+        std::size_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    /// @brief Minimal-probe perfect hash over a fixed key set ("hash and
+    /// displace"): keys are split into buckets by one hash, and every bucket
+    /// gets its own seed under which all of its keys land in free slots.
+    /// A lookup is two hashes, one slot read and one string compare.
+    ///
+    /// Index 0 of `keys` is the empty placeholder for `Unknown` and is not
+    /// inserted.
+    template <std::size_t N>
+    class PerfectHash {
+    public:
+        static constexpr std::size_t kBuckets = next_pow2(N / 4 + 1);
+        static constexpr std::size_t kSlots = next_pow2(N + N / 2);
+
+    private:
+        const std::array<std::string_view, N>& keys_;
+        std::array<std::uint16_t, kBuckets> seeds_ {};
+        // Key index per slot, 0 when the slot is empty.
+        std::array<std::uint16_t, kSlots> slots_ {};
+
+        static constexpr std::size_t bucket_of(std::string_view key)
+        {
+            return hash(key, 0) >> 8 & (kBuckets - 1);
+        }
+
+        static constexpr std::size_t slot_of(std::string_view key,
+            std::uint32_t seed)
+        {
+            return hash(key, seed) & (kSlots - 1);
+        }
+
+    public:
+        constexpr explicit PerfectHash(const std::array<std::string_view, N>& keys)
+            : keys_(keys)
+        {
+            // Group the key indices by bucket (a counting sort), so that trying
+            // a seed for one bucket only rehashes that bucket's keys.
+            std::array<std::size_t, kBuckets + 1> starts {};
+            std::array<std::size_t, N> buckets {};
+            for (std::size_t i = 1; i < N; i++) {
+                buckets[i] = bucket_of(keys[i]);
+                starts[buckets[i] + 1]++;
+            }
+            for (std::size_t b = 0; b < kBuckets; b++) {
+                starts[b + 1] += starts[b];
+            }
+            std::array<std::size_t, N> members {};
+            std::array<std::size_t, kBuckets> fill {};
+            for (std::size_t i = 1; i < N; i++) {
+                members[starts[buckets[i]] + fill[buckets[i]]++] = i;
+            }
+
+            // Place the fullest buckets first while the table is still empty.
+            std::array<bool, kBuckets> placed {};
+            for (std::size_t round = 0; round < kBuckets; round++) {
+                std::size_t bucket = kBuckets;
+                for (std::size_t b = 0; b < kBuckets; b++) {
+                    if (!placed[b] && (bucket == kBuckets || fill[b] > fill[bucket])) {
+                        bucket = b;
+                    }
+                }
+                placed[bucket] = true;
+                if (fill[bucket] == 0) {
+                    break;
+                }
+
+                auto first = starts[bucket];
+                auto last = starts[bucket + 1];
+                for (std::uint32_t seed = 1;; seed++) {
+                    if (seed > UINT16_MAX) {
+                        throw "no perfect hash seed found";
+                    }
+
+                    bool fits = true;
+                    for (auto m = first; m < last && fits; m++) {
+                        auto slot = slot_of(keys[members[m]], seed);
+                        fits = slots_[slot] == 0;
+                        for (auto other = first; other < m && fits; other++) {
+                            fits = slot_of(keys[members[other]], seed) != slot;
+                        }
+                    }
+                    if (!fits) {
+                        continue;
+                    }
+
+                    seeds_[bucket] = static_cast<std::uint16_t>(seed);
+                    for (auto m = first; m < last; m++) {
+                        slots_[slot_of(keys[members[m]], seed)] = static_cast<std::uint16_t>(members[m]);
+                    }
+                    break;
+                }
+            }
+        }
+
+        /// @return The index of `key` in the key set, or 0 when absent.
+        constexpr std::uint16_t find(std::string_view key) const
+        {
+            auto index = slots_[slot_of(key, seeds_[bucket_of(key)])];
+            return index != 0 && keys_[index] == key ? index : 0;
+        }
+
+        constexpr bool finds_every_key() const
+        {
+            for (std::size_t i = 1; i < N; i++) {
+                if (find(keys_[i]) != i) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    inline constexpr std::array kTagNames {
+        std::string_view(),
+#define X(id, name) std::string_view(name),
+        EVEN_HTML_TAG_NAMES(X)
+#undef X
+    };
+
+    inline constexpr std::array kAttrNames {
+        std::string_view(),
+#define X(id, name) std::string_view(name),
+        EVEN_HTML_ATTRIBUTE_NAMES(X)
+#undef X
+    };
+
+    inline constexpr PerfectHash<kTagNames.size()> kTagHash { kTagNames };
+    inline constexpr PerfectHash<kAttrNames.size()> kAttrHash { kAttrNames };
+
+} // namespace detail
+
+/// @brief Looks up an already lowercased tag name.
+constexpr TagId lookup_tag(std::string_view name)
+{
+    return static_cast<TagId>(detail::kTagHash.find(name));
+}
+
+/// @brief Looks up an already lowercased attribute name.
+constexpr AttrId lookup_attr(std::string_view name)
+{
+    return static_cast<AttrId>(detail::kAttrHash.find(name));
+}
+
+/// @return The name of a known tag, or the empty string for `Unknown`.
+constexpr std::string_view name_of(TagId id)
+{
+    return detail::kTagNames[static_cast<std::size_t>(id)];
+}
+
+/// @return The name of a known attribute, or the empty string for `Unknown`.
+constexpr std::string_view name_of(AttrId id)
+{
+    return detail::kAttrNames[static_cast<std::size_t>(id)];
+}
+
+} // namespace Atoms
+
+/// @brief Keeps one copy of every name that is not in the atom tables.
+/// Views returned by intern() stay valid for the lifetime of the interner.
+class AtomInterner {
+private:
+    std::deque<std::string> storage_;
+    std::unordered_set<std::string_view> names_;
+
+public:
+    std::string_view intern(std::string_view name);
+    std::size_t size() const { return names_.size(); }
+};
@@ -0,0 +1,76 @@
+#include "compact_tree_builder.h"
+
+#include "parser.h"
+#include "preprocessor.h"
+#include "tokenizer.h"
+
+CompactTreeBuilder::CompactTreeBuilder(CompactDocument& document)
+    : document_(document)
+    , open_elements_ { CompactDocument::kDocument }
+    , done_(false)
+{
+}
+
+std::unique_ptr<CompactDocument> CompactTreeBuilder::parse(std::string_view input)
+{
+    auto document = std::make_unique<CompactDocument>();
+    CompactTreeBuilder builder(*document);
+    InputPreprocessor preprocessor;
+    Tokenizer tokenizer(preprocessor.process(input, true).text);
+    tokenizer.run(builder);
+    return document;
+}
+
+void CompactTreeBuilder::insert_text(std::string_view data, std::uint32_t offset)
+{
+    auto parent = current_node();
+    auto last = document_.last_child(parent);
+    if (last != CompactDocument::kNone
+        && document_.node_type(last) == CompactDocument::Type::TEXT_NODE) {
+        document_.append_data(last, data);
+        return;
+    }
+
+    document_.append_text(parent, data, offset);
+}
+
+void CompactTreeBuilder::on_start_tag(const TagView& tag)
+{
+    // The tokenizer already looked the names up.
+    auto element = document_.append_element(current_node(), tag.id, tag.name, tag.offset);
+    for (const auto& attr : tag.attributes) {
+        document_.append_attribute(element, attr.id, attr.name, attr.value);
+    }
+
+    if (!tag.self_closing && !is_void_element(tag.id)) {
+        open_elements_.push_back(element);
+    }
+}
+
+void CompactTreeBuilder::on_end_tag(const TagView& tag)
+{
+    for (auto i = open_elements_.size(); i-- > 1;) {
+        auto element = open_elements_[i];
+        if (document_.tag_id(element) == tag.id
+            && (tag.id != TagId::Unknown || document_.local_name(element) == tag.name)) {
+            open_elements_.resize(i);
+            return;
+        }
+    }
+}
+
+void CompactTreeBuilder::on_text(std::string_view text, std::uint32_t offset)
+{
+    insert_text(text, offset);
+}
+
+void CompactTreeBuilder::on_char(char ch, std::uint32_t offset)
+{
+    insert_text(std::string_view(&ch, 1), offset);
+}
+
+void CompactTreeBuilder::on_eof()
+{
+    open_elements_.resize(1);
+    done_ = true;
+}
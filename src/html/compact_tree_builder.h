@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "../dom/compact_document.h"
+#include "token.h"
+
+/// @brief Builds a CompactDocument from tokens.
+///
+/// A tokenizer sink with the same tree construction rules as HTMLParser, so
+/// both produce the same tree for the same input. It only ever appends to the
+/// current node, so the result is in tree order.
+class CompactTreeBuilder {
+private:
+    using NodeId = CompactDocument::NodeId;
+
+    CompactDocument& document_;
+    /// @brief https://html.spec.whatwg.org/multipage/parsing.html#stack-of-open-elements
+    /// The document itself sits at the bottom.
+    std::vector<NodeId> open_elements_;
+    bool done_;
+
+    NodeId current_node() const { return open_elements_.back(); }
+    void insert_text(std::string_view data, std::uint32_t offset);
+
+public:
+    explicit CompactTreeBuilder(CompactDocument& document);
+
+    /// @brief Parses a complete document, preprocessing it first.
+    static std::unique_ptr<CompactDocument> parse(std::string_view input);
+
+    /// @brief Whether the end-of-file token has been seen.
+    bool done() const { return done_; }
+
+    void on_start_tag(const TagView& tag);
+    void on_end_tag(const TagView& tag);
+    void on_text(std::string_view text, std::uint32_t offset);
+    void on_char(char ch, std::uint32_t offset);
+    void on_eof();
+};
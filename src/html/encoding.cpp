@@ -0,0 +1,605 @@
+#include "encoding.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../util/char_util.h"
+#include "../util/simd_scan.h"
+#include "preprocessor.h"
+
+namespace {
+
+struct EncodingLabel {
+    std::string_view label;
+    Encoding encoding;
+};
+
+// https://encoding.spec.whatwg.org/#names-and-labels, sorted by label.
+constexpr EncodingLabel kLabels[] = {
+    { "ansi_x3.4-1968", Encoding::Windows1252 },
+    { "ascii", Encoding::Windows1252 },
+    { "cp1252", Encoding::Windows1252 },
+    { "cp819", Encoding::Windows1252 },
+    { "csisolatin1", Encoding::Windows1252 },
+    { "csunicode", Encoding::Utf16LE },
+    { "ibm819", Encoding::Windows1252 },
+    { "iso-10646-ucs-2", Encoding::Utf16LE },
+    { "iso-8859-1", Encoding::Windows1252 },
+    { "iso-ir-100", Encoding::Windows1252 },
+    { "iso8859-1", Encoding::Windows1252 },
+    { "iso88591", Encoding::Windows1252 },
+    { "iso_8859-1", Encoding::Windows1252 },
+    { "iso_8859-1:1987", Encoding::Windows1252 },
+    { "l1", Encoding::Windows1252 },
+    { "latin1", Encoding::Windows1252 },
+    { "ucs-2", Encoding::Utf16LE },
+    { "unicode", Encoding::Utf16LE },
+    { "unicode-1-1-utf-8", Encoding::Utf8 },
+    { "unicode11utf8", Encoding::Utf8 },
+    { "unicode20utf8", Encoding::Utf8 },
+    { "unicodefeff", Encoding::Utf16LE },
+    { "unicodefffe", Encoding::Utf16BE },
+    { "us-ascii", Encoding::Windows1252 },
+    { "utf-16", Encoding::Utf16LE },
+    { "utf-16be", Encoding::Utf16BE },
+    { "utf-16le", Encoding::Utf16LE },
+    { "utf-8", Encoding::Utf8 },
+    { "utf8", Encoding::Utf8 },
+    { "windows-1252", Encoding::Windows1252 },
+    { "x-cp1252", Encoding::Windows1252 },
+    { "x-unicode20utf8", Encoding::Utf8 },
+};
+
+constexpr bool labels_are_sorted()
+{
+    for (std::size_t i = 1; i < std::size(kLabels); i++) {
+        if (!(kLabels[i - 1].label < kLabels[i].label)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(labels_are_sorted(), "kLabels must be sorted for binary search");
+
+constexpr std::string_view kUtf8Bom = "\xEF\xBB\xBF";
+constexpr std::string_view kUtf16BEBom = "\xFE\xFF";
+constexpr std::string_view kUtf16LEBom = "\xFF\xFE";
+
+constexpr std::size_t kPrescanLength = 1024;
+
+/// @brief Byte cursor for the prescan, which never reads past its end.
+struct PrescanInput {
+    std::string_view bytes;
+    std::size_t pos = 0;
+
+    bool at_end() const { return pos >= bytes.size(); }
+    char current() const { return bytes[pos]; }
+
+    bool starts_with(std::string_view s) const
+    {
+        return bytes.substr(pos, s.size()) == s;
+    }
+
+    bool starts_with_ignoring_case(std::string_view s) const
+    {
+        if (bytes.size() - pos < s.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < s.size(); i++) {
+            if (CharUtil::to_ascii_lower(bytes[pos + i]) != s[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+bool is_prescan_whitespace(char c)
+{
+    return c == '\t' || c == '\n' || c == '\f' || c == '\r' || c == ' ';
+}
+
+struct PrescanAttribute {
+    std::string name;
+    std::string value;
+};
+
+/// @brief https://html.spec.whatwg.org/multipage/parsing.html#concept-get-attributes-when-sniffing
+std::optional<PrescanAttribute> get_attribute(PrescanInput& in)
+{
+    // If the byte at position is one of 0x09 (HT), 0x0A (LF), 0x0C (FF), 0x0D
+    // (CR), 0x20 (SP), or 0x2F (/) then advance position to the next byte and
+    // redo this step.
+    while (!in.at_end() && (is_prescan_whitespace(in.current()) || in.current() == '/')) {
+        in.pos++;
+    }
+    // If the byte at position is 0x3E (>), then abort the get an attribute
+    // algorithm. There isn't one.
+    if (in.at_end() || in.current() == '>') {
+        return std::nullopt;
+    }
+
+    PrescanAttribute attr;
+
+    // Attribute name
+    while (true) {
+        if (in.at_end()) {
+            return std::nullopt;
+        }
+        auto c = in.current();
+        if (c == '=' && !attr.name.empty()) {
+            // Advance position to the next byte and jump to the step below
+            // labeled value.
+            in.pos++;
+            break;
+        }
+        if (is_prescan_whitespace(c)) {
+            // Jump to the step below labeled spaces.
+            while (!in.at_end() && is_prescan_whitespace(in.current())) {
+                in.pos++;
+            }
+            // If the byte at position is not 0x3D (=), abort the get an
+            // attribute algorithm. The attribute's name is the value of
+            // attribute name, its value is the empty string.
+            if (in.at_end() || in.current() != '=') {
+                return attr;
+            }
+            in.pos++;
+            break;
+        }
+        if (c == '/' || c == '>') {
+            return attr;
+        }
+        attr.name.push_back(CharUtil::to_ascii_lower(c));
+        in.pos++;
+    }
+
+    // Value
+    while (!in.at_end() && is_prescan_whitespace(in.current())) {
+        in.pos++;
+    }
+    if (in.at_end()) {
+        return std::nullopt;
+    }
+    auto c = in.current();
+    if (c == '"' || c == '\'') {
+        // Let b be the value of the byte at position. Loop: advance position to
+        // the next byte. If the value of the byte at position is the value of
+        // b, then advance position to the next byte and abort.
+        auto quote = c;
+        while (true) {
+            in.pos++;
+            if (in.at_end()) {
+                return std::nullopt;
+            }
+            if (in.current() == quote) {
+                in.pos++;
+                return attr;
+            }
+            attr.value.push_back(CharUtil::to_ascii_lower(in.current()));
+        }
+    }
+    if (c == '>') {
+        return attr;
+    }
+    attr.value.push_back(CharUtil::to_ascii_lower(c));
+    while (true) {
+        in.pos++;
+        if (in.at_end()) {
+            return std::nullopt;
+        }
+        c = in.current();
+        if (is_prescan_whitespace(c) || c == '>') {
+            return attr;
+        }
+        attr.value.push_back(CharUtil::to_ascii_lower(c));
+    }
+}
+
+/// @brief https://html.spec.whatwg.org/multipage/urls-and-fetching.html#algorithm-for-extracting-a-character-encoding-from-a-meta-element
+std::optional<std::string_view> extract_charset(std::string_view s)
+{
+    std::size_t pos = 0;
+    while (true) {
+        // Loop: Find the first seven characters in s after position that are
+        // an ASCII case-insensitive match for the word "charset". If no such
+        // match is found, return nothing. (`s` is already lowercase.)
+        pos = s.find("charset", pos);
+        if (pos == std::string_view::npos) {
+            return std::nullopt;
+        }
+        pos += 7;
+
+        // Skip any ASCII whitespace that immediately follow the word "charset".
+        while (pos < s.size() && is_prescan_whitespace(s[pos])) {
+            pos++;
+        }
+        // If the next character is not a U+003D EQUALS SIGN (=), then move
+        // position to point just before that next character, and jump back to
+        // the step labeled loop.
+        if (pos < s.size() && s[pos] == '=') {
+            break;
+        }
+    }
+
+    pos++;
+    while (pos < s.size() && is_prescan_whitespace(s[pos])) {
+        pos++;
+    }
+    if (pos == s.size()) {
+        return std::nullopt;
+    }
+    if (s[pos] == '"' || s[pos] == '\'') {
+        auto end = s.find(s[pos], pos + 1);
+        if (end == std::string_view::npos) {
+            return std::nullopt;
+        }
+        return s.substr(pos + 1, end - pos - 1);
+    }
+    auto end = pos;
+    while (end < s.size() && !is_prescan_whitespace(s[end]) && s[end] != ';') {
+        end++;
+    }
+    return s.substr(pos, end - pos);
+}
+
+/// @brief The part of the prescan that handles a `<meta`, with `in` after it.
+std::optional<Encoding> prescan_meta(PrescanInput& in)
+{
+    bool got_pragma = false;
+    std::optional<bool> need_pragma;
+    std::optional<Encoding> charset;
+    // Only the three attributes below matter for the "already in the list"
+    // check.
+    bool seen_http_equiv = false;
+    bool seen_content = false;
+    bool seen_charset = false;
+
+    while (auto attr = get_attribute(in)) {
+        if (attr->name == "http-equiv") {
+            if (std::exchange(seen_http_equiv, true)) {
+                continue;
+            }
+            if (attr->value == "content-type") {
+                got_pragma = true;
+            }
+        } else if (attr->name == "content") {
+            if (std::exchange(seen_content, true)) {
+                continue;
+            }
+            auto label = extract_charset(attr->value);
+            if (label && !charset) {
+                if (auto encoding = encoding_for_label(*label)) {
+                    charset = encoding;
+                    need_pragma = true;
+                }
+            }
+        } else if (attr->name == "charset") {
+            if (std::exchange(seen_charset, true)) {
+                continue;
+            }
+            charset = encoding_for_label(attr->value);
+            need_pragma = false;
+        }
+    }
+
+    // Processing: If need pragma is null, or true but got pragma is false, or
+    // charset is failure, then jump to the step below labeled next byte.
+    if (!need_pragma || (*need_pragma && !got_pragma) || !charset) {
+        return std::nullopt;
+    }
+    // If charset is UTF-16BE/LE, then set charset to UTF-8.
+    if (*charset == Encoding::Utf16BE || *charset == Encoding::Utf16LE) {
+        return Encoding::Utf8;
+    }
+    return charset;
+}
+
+} // namespace
+
+std::string_view name_of(Encoding encoding)
+{
+    switch (encoding) {
+    case Encoding::Utf8:
+        return "UTF-8";
+    case Encoding::Utf16BE:
+        return "UTF-16BE";
+    case Encoding::Utf16LE:
+        return "UTF-16LE";
+    case Encoding::Windows1252:
+        return "windows-1252";
+    }
+    return "";
+}
+
+std::optional<Encoding> encoding_for_label(std::string_view label)
+{
+    // Remove any leading and trailing ASCII whitespace from label.
+    while (!label.empty() && is_prescan_whitespace(label.front())) {
+        label.remove_prefix(1);
+    }
+    while (!label.empty() && is_prescan_whitespace(label.back())) {
+        label.remove_suffix(1);
+    }
+
+    std::string lower(label);
+    for (auto& c : lower) {
+        c = CharUtil::to_ascii_lower(c);
+    }
+
+    auto it = std::lower_bound(std::begin(kLabels), std::end(kLabels), lower,
+        [](const EncodingLabel& entry, const std::string& key) { return entry.label < key; });
+    if (it == std::end(kLabels) || it->label != lower) {
+        return std::nullopt;
+    }
+    return it->encoding;
+}
+
+std::optional<Encoding> prescan_for_encoding(std::string_view input)
+{
+    PrescanInput in { input.substr(0, kPrescanLength) };
+
+    while (!in.at_end()) {
+        if (in.starts_with("<!--")) {
+            // Advance the position pointer so that it points at the first 0x3E
+            // byte which is preceded by two 0x2D bytes (i.e. at the end of an
+            // ASCII '-->' sequence) and comes after the 0x3C byte that was
+            // found.
+            auto end = in.bytes.find("-->", in.pos + 2);
+            if (end == std::string_view::npos) {
+                return std::nullopt;
+            }
+            in.pos = end + 3;
+            continue;
+        }
+
+        if (in.starts_with_ignoring_case("<meta") && in.pos + 5 < in.bytes.size()
+            && (is_prescan_whitespace(in.bytes[in.pos + 5]) || in.bytes[in.pos + 5] == '/')) {
+            // Advance the position pointer so that it points at the next 0x09,
+            // 0x0A, 0x0C, 0x0D, 0x20, or 0x2F byte (the one in sequence of
+            // characters matched above).
+            in.pos += 5;
+            if (auto encoding = prescan_meta(in)) {
+                return encoding;
+            }
+        } else if (in.pos + 1 < in.bytes.size() && in.current() == '<'
+            && (CharUtil::is_ascii_alpha(in.bytes[in.pos + 1])
+                || (in.bytes[in.pos + 1] == '/' && in.pos + 2 < in.bytes.size()
+                    && CharUtil::is_ascii_alpha(in.bytes[in.pos + 2])))) {
+            // A sequence of bytes starting with a 0x3C byte (<), optionally a
+            // 0x2F byte (/), and finally a byte in the range 0x41-0x5A or
+            // 0x61-0x7A (A-Z or a-z): advance the position pointer so that it
+            // points at the next 0x09, 0x0A, 0x0C, 0x0D, 0x20, or 0x3E byte,
+            // then repeatedly get an attribute until no further attributes can
+            // be found.
+            while (!in.at_end() && !is_prescan_whitespace(in.current()) && in.current() != '>') {
+                in.pos++;
+            }
+            while (get_attribute(in)) {
+            }
+        } else if (in.starts_with("<!") || in.starts_with("</") || in.starts_with("<?")) {
+            // Advance the position pointer so that it points at the first 0x3E
+            // byte which comes after the 0x3C byte that was found.
+            auto end = in.bytes.find('>', in.pos + 1);
+            if (end == std::string_view::npos) {
+                return std::nullopt;
+            }
+            in.pos = end;
+        }
+
+        // Next byte: Move position so it points at the next byte in the input
+        // byte stream, and return to the step above labeled loop.
+        in.pos++;
+    }
+
+    return std::nullopt;
+}
+
+EncodingSniffResult sniff_encoding(std::string_view prefix,
+    std::optional<Encoding> hint, Encoding fallback)
+{
+    // If the result of BOM sniffing is an encoding, return that encoding with
+    // confidence certain.
+    if (prefix.substr(0, 3) == kUtf8Bom) {
+        return { Encoding::Utf8, EncodingConfidence::Certain };
+    }
+    if (prefix.substr(0, 2) == kUtf16BEBom) {
+        return { Encoding::Utf16BE, EncodingConfidence::Certain };
+    }
+    if (prefix.substr(0, 2) == kUtf16LEBom) {
+        return { Encoding::Utf16LE, EncodingConfidence::Certain };
+    }
+
+    // If the transport layer specifies a character encoding, and it is
+    // supported, return that encoding with the confidence certain.
+    if (hint) {
+        return { *hint, EncodingConfidence::Certain };
+    }
+
+    // Optionally prescan the byte stream to determine its encoding.
+    if (auto encoding = prescan_for_encoding(prefix)) {
+        return { *encoding, EncodingConfidence::Tentative };
+    }
+
+    // The user agent may attempt to autodetect the character encoding from
+    // applying frequency analysis or other algorithms to the data stream.
+    // Text that is valid UTF-8 and not ASCII is almost never anything else.
+    auto window = prefix.substr(0, kPrescanLength);
+    auto ascii = SimdScan::ascii_prefix(window);
+    if (ascii < window.size()) {
+        auto valid = ascii + InputPreprocessor::valid_utf8_prefix(window.substr(ascii));
+        // The window may end in the middle of a character.
+        bool cut = window.size() < prefix.size() && window.size() - valid < 4;
+        if (valid == window.size() || cut) {
+            return { Encoding::Utf8, EncodingConfidence::Tentative };
+        }
+    }
+
+    return { fallback, EncodingConfidence::Tentative };
+}
+
+TextDecoder::TextDecoder(Encoding encoding)
+    : encoding_(encoding)
+    , at_start_(true)
+{
+}
+
+std::string_view TextDecoder::decode(std::string_view chunk, bool last)
+{
+    auto input = strip_bom(chunk, last);
+
+    switch (encoding_) {
+    case Encoding::Utf8:
+        return input;
+    case Encoding::Windows1252:
+        if (SimdScan::ascii_prefix(input) == input.size()) {
+            return input;
+        }
+        decode_windows_1252(input);
+        return out_;
+    case Encoding::Utf16BE:
+    case Encoding::Utf16LE:
+        decode_utf16(input, last);
+        return out_;
+    }
+    return input;
+}
+
+std::string_view TextDecoder::strip_bom(std::string_view chunk, bool last)
+{
+    if (!at_start_) {
+        return chunk;
+    }
+
+    std::string_view bom;
+    switch (encoding_) {
+    case Encoding::Utf8:
+        bom = kUtf8Bom;
+        break;
+    case Encoding::Utf16BE:
+        bom = kUtf16BEBom;
+        break;
+    case Encoding::Utf16LE:
+        bom = kUtf16LEBom;
+        break;
+    case Encoding::Windows1252:
+        at_start_ = false;
+        return chunk;
+    }
+
+    if (bom_prefix_.empty() && chunk.size() >= bom.size()) {
+        at_start_ = false;
+        return chunk.substr(0, bom.size()) == bom ? chunk.substr(bom.size()) : chunk;
+    }
+
+    // Too short to tell yet, so gather the first bytes.
+    bom_prefix_.append(chunk);
+    if (!last && bom_prefix_.size() < bom.size() && bom.substr(0, bom_prefix_.size()) == bom_prefix_) {
+        return {};
+    }
+    at_start_ = false;
+    std::string_view gathered = bom_prefix_;
+    return gathered.substr(0, bom.size()) == bom ? gathered.substr(bom.size()) : gathered;
+}
+
+void TextDecoder::append_code_point(std::uint32_t code_point)
+{
+    char bytes[4];
+    out_.append(bytes, CharUtil::encode_utf8(code_point, bytes));
+}
+
+void TextDecoder::decode_windows_1252(std::string_view chunk)
+{
+    // https://encoding.spec.whatwg.org/#single-byte-decoder
+    out_.clear();
+    std::size_t pos = 0;
+    while (pos < chunk.size()) {
+        auto ascii = SimdScan::ascii_prefix(chunk.substr(pos));
+        out_.append(chunk.substr(pos, ascii));
+        pos += ascii;
+
+        for (; pos < chunk.size(); pos++) {
+            auto byte = static_cast<unsigned char>(chunk[pos]);
+            if (byte < 0x80) {
+                break;
+            }
+            append_code_point(byte < 0xA0 ? CharUtil::kWindows1252HighControls[byte - 0x80] : byte);
+        }
+    }
+}
+
+void TextDecoder::decode_utf16(std::string_view chunk, bool last)
+{
+    // https://encoding.spec.whatwg.org/#shared-utf-16-decoder
+    const bool big_endian = encoding_ == Encoding::Utf16BE;
+
+    // A code unit takes at most three bytes of UTF-8, and so does a lone
+    // surrogate's U+FFFD, so this never reallocates below.
+    out_.resize((chunk.size() / 2 + 2) * 3 + 3);
+    char* out = out_.data();
+    std::size_t written = 0;
+    auto emit = [&](std::uint32_t code_point) {
+        written += CharUtil::encode_utf8(code_point, out + written);
+    };
+    auto unit_of = [big_endian](char first, char second) {
+        auto a = static_cast<std::uint16_t>(static_cast<unsigned char>(first));
+        auto b = static_cast<std::uint16_t>(static_cast<unsigned char>(second));
+        return static_cast<std::uint16_t>(big_endian ? (a << 8) | b : (b << 8) | a);
+    };
+    auto handle = [&](std::uint16_t unit) {
+        if (lead_surrogate_) {
+            auto lead = *lead_surrogate_;
+            lead_surrogate_.reset();
+            if (unit >= 0xDC00 && unit <= 0xDFFF) {
+                emit(0x10000 + ((static_cast<std::uint32_t>(lead) - 0xD800) << 10) + (unit - 0xDC00));
+                return;
+            }
+            // Restore the code unit to the queue and return an error.
+            emit(0xFFFD);
+        }
+        if (unit >= 0xD800 && unit <= 0xDBFF) {
+            lead_surrogate_ = unit;
+        } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+            emit(0xFFFD);
+        } else {
+            emit(unit);
+        }
+    };
+
+    std::size_t pos = 0;
+    if (lead_byte_ && !chunk.empty()) {
+        handle(unit_of(static_cast<char>(*lead_byte_), chunk[0]));
+        lead_byte_.reset();
+        pos = 1;
+    }
+
+    while (pos + 2 <= chunk.size()) {
+        auto unit = unit_of(chunk[pos], chunk[pos + 1]);
+        if (unit < 0x80 && !lead_surrogate_) {
+            auto narrowed = SimdScan::narrow_ascii_utf16(chunk.substr(pos), big_endian, out + written);
+            written += narrowed;
+            pos += 2 * narrowed;
+            continue;
+        }
+        handle(unit);
+        pos += 2;
+    }
+
+    if (pos < chunk.size()) {
+        lead_byte_ = static_cast<std::uint8_t>(chunk[pos]);
+    }
+    if (last && (lead_byte_ || lead_surrogate_)) {
+        // If byte is end-of-queue and either UTF-16 lead byte or UTF-16 lead
+        // surrogate is non-null, set UTF-16 lead byte and UTF-16 lead
+        // surrogate to null, and return error.
+        lead_byte_.reset();
+        lead_surrogate_.reset();
+        emit(0xFFFD);
+    }
+    out_.resize(written);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/// @brief The character encodings documents are decoded from.
+/// https://encoding.spec.whatwg.org/#names-and-labels
+///
+/// Only the ones our input actually comes in. ISO-8859-1 and US-ASCII are
+/// labels of windows-1252, as the Encoding Standard has it.
+enum class Encoding : std::uint8_t {
+    Utf8,
+    Utf16BE,
+    Utf16LE,
+    Windows1252,
+};
+
+/// @brief The encoding's name, e.g. "windows-1252".
+std::string_view name_of(Encoding encoding);
+
+/// @brief https://encoding.spec.whatwg.org/#concept-encoding-get
+/// @return Nothing for labels of encodings that are not supported.
+std::optional<Encoding> encoding_for_label(std::string_view label);
+
+/// @brief https://html.spec.whatwg.org/multipage/parsing.html#concept-encoding-confidence
+enum class EncodingConfidence : std::uint8_t {
+    Tentative,
+    Certain,
+};
+
+struct EncodingSniffResult {
+    Encoding encoding;
+    EncodingConfidence confidence;
+};
+
+/// @brief https://html.spec.whatwg.org/multipage/parsing.html#prescan-a-byte-stream-to-determine-its-encoding
+/// Looks for a `<meta charset>` or `<meta http-equiv=content-type>` in the
+/// first 1024 bytes of `input`.
+std::optional<Encoding> prescan_for_encoding(std::string_view input);
+
+/// @brief https://html.spec.whatwg.org/multipage/parsing.html#encoding-sniffing-algorithm
+///
+/// `prefix` is the start of the document, ideally its first 1024 bytes. In
+/// order, the encoding is the one given by a byte order mark, `hint` (e.g.
+/// from the Content-Type header), a `<meta>` found by the prescan, UTF-8 when
+/// the prefix is valid UTF-8 but not ASCII, and otherwise `fallback`.
+EncodingSniffResult sniff_encoding(std::string_view prefix,
+    std::optional<Encoding> hint = std::nullopt,
+    Encoding fallback = Encoding::Windows1252);
+
+/// @brief Transcodes a document to UTF-8, chunk by chunk.
+/// https://encoding.spec.whatwg.org/#decode
+///
+/// A byte order mark for the decoder's encoding at the start of the stream is
+/// removed. UTF-8 and chunks of windows-1252 that are pure ASCII are returned
+/// without copying; the runs of ASCII in the others are converted with the
+/// SimdScan kernels and only the remaining characters one at a time. Invalid
+/// UTF-16 becomes U+FFFD; invalid UTF-8 is left to InputPreprocessor.
+class TextDecoder {
+public:
+    explicit TextDecoder(Encoding encoding);
+
+    Encoding encoding() const { return encoding_; }
+
+    /// @brief Decodes the next chunk. A code unit or surrogate pair cut off
+    /// at the end of the chunk is held back until the next one, unless `last`
+    /// is set. The result views either `chunk` or the decoder's buffer and is
+    /// valid until the next call.
+    std::string_view decode(std::string_view chunk, bool last = false);
+
+private:
+    std::string_view strip_bom(std::string_view chunk, bool last);
+    void decode_windows_1252(std::string_view chunk);
+    void decode_utf16(std::string_view chunk, bool last);
+    void append_code_point(std::uint32_t code_point);
+
+    Encoding encoding_;
+    std::string out_;
+    /// @brief Bytes at the start of the stream that may still turn out to be
+    /// a byte order mark.
+    std::string bom_prefix_;
+    bool at_start_;
+    // UTF-16 state: an odd byte left over from the last chunk, and a lead
+    // surrogate waiting for its trail.
+    std::optional<std::uint8_t> lead_byte_;
+    std::optional<std::uint16_t> lead_surrogate_;
+};
@@ -0,0 +1,161 @@
+#include "entities.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "entity_list.h"
+
+namespace Entities {
+
+namespace {
+
+    struct Entity {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    constexpr Entity kEntities[] = {
+#define EVEN_X(name, value) { name, value },
+        EVEN_HTML_ENTITIES(EVEN_X)
+#undef EVEN_X
+    };
+
+    constexpr std::size_t kEntityCount = sizeof(kEntities) / sizeof(kEntities[0]);
+
+    /// @brief A trie node. The children of a node are stored next to each
+    /// other, sorted by character, so a lookup is a binary search per byte.
+    struct TrieNode {
+        char ch = 0;
+        std::uint8_t child_count = 0;
+        std::uint16_t first_child = 0;
+        /// @brief Index in kEntities of the name ending here, or -1.
+        std::int16_t entity = -1;
+    };
+
+    /// @brief Nodes are the distinct prefixes of the names, the empty one
+    /// included. Names are sorted, so each name adds the characters it does
+    /// not share with the previous one.
+    constexpr std::size_t count_nodes()
+    {
+        std::size_t nodes = 1;
+        std::string_view previous;
+        for (const auto& entity : kEntities) {
+            std::size_t common = 0;
+            while (common < previous.size() && common < entity.name.size()
+                && previous[common] == entity.name[common]) {
+                common++;
+            }
+            nodes += entity.name.size() - common;
+            previous = entity.name;
+        }
+        return nodes;
+    }
+
+    constexpr std::size_t kNodeCount = count_nodes();
+
+    using Trie = std::array<TrieNode, kNodeCount>;
+
+    /// @brief Lays the trie out breadth first. Every node covers the range
+    /// of names that start with its prefix; its children split that range by
+    /// the next character.
+    constexpr Trie make_trie()
+    {
+        struct Range {
+            std::size_t lo = 0;
+            std::size_t hi = 0;
+        };
+
+        Trie trie {};
+        std::array<Range, kNodeCount> ranges {};
+        ranges[0] = { 0, kEntityCount };
+        std::size_t size = 1;
+
+        // Node n's prefix has the length of its depth, which is tracked per
+        // level of the breadth-first order.
+        std::size_t depth = 0;
+        std::size_t level_end = 1;
+        for (std::size_t node = 0; node < size; node++) {
+            if (node == level_end) {
+                depth++;
+                level_end = size;
+            }
+
+            auto [lo, hi] = ranges[node];
+            if (kEntities[lo].name.size() == depth) {
+                trie[node].entity = static_cast<std::int16_t>(lo);
+                lo++;
+            }
+
+            trie[node].first_child = static_cast<std::uint16_t>(size);
+            while (lo < hi) {
+                char ch = kEntities[lo].name[depth];
+                auto end = lo;
+                while (end < hi && kEntities[end].name[depth] == ch) {
+                    end++;
+                }
+                trie[size].ch = ch;
+                ranges[size] = { lo, end };
+                size++;
+                trie[node].child_count++;
+                lo = end;
+            }
+        }
+        return trie;
+    }
+
+    constexpr Trie kTrie = make_trie();
+
+    constexpr bool is_sorted()
+    {
+        for (std::size_t i = 1; i < kEntityCount; i++) {
+            if (!(kEntities[i - 1].name < kEntities[i].name)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(is_sorted(), "entity_list.h must be sorted bytewise");
+    static_assert(kEntityCount == 2231);
+    static_assert(kNodeCount < UINT16_MAX);
+
+    const TrieNode* find_child(const TrieNode& node, char ch)
+    {
+        const auto* lo = &kTrie[node.first_child];
+        const auto* hi = lo + node.child_count;
+        while (lo < hi) {
+            const auto* mid = lo + (hi - lo) / 2;
+            if (static_cast<unsigned char>(mid->ch) < static_cast<unsigned char>(ch)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo != &kTrie[node.first_child] + node.child_count && lo->ch == ch ? lo : nullptr;
+    }
+
+} // namespace
+
+Match match(std::string_view input)
+{
+    Match result;
+    const auto* node = &kTrie[0];
+    std::size_t i = 0;
+    for (; i < input.size(); i++) {
+        node = find_child(*node, input[i]);
+        if (!node) {
+            return result;
+        }
+        if (node->entity >= 0) {
+            result.length = i + 1;
+            result.value = kEntities[node->entity].value;
+        }
+    }
+
+    result.truncated = node->child_count > 0;
+    return result;
+}
+
+} // namespace Entities
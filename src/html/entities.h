@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+/// @brief Named character references.
+/// https://html.spec.whatwg.org/multipage/named-characters.html
+namespace Entities {
+
+/// @brief Result of match().
+struct Match {
+    /// @brief Length of the longest matching name, 0 if none matched.
+    std::size_t length = 0;
+    /// @brief UTF-8 value of that name, with static storage.
+    std::string_view value;
+    /// @brief Whether the input ran out while a longer name could still
+    /// match, so that more input could change the result.
+    bool truncated = false;
+};
+
+/// @brief Finds the longest entity name that `input` starts with, walking a
+/// trie of all names built at compile time. Costs O(name length) and never
+/// allocates. `input` starts after the '&'.
+Match match(std::string_view input);
+
+/// @brief Length of the longest entity name.
+constexpr std::size_t kMaxNameLength = 32;
+
+} // namespace Entities
@@ -0,0 +1,2242 @@
+#pragma once
+
+// Generated from the WHATWG named character references table,
+// https://html.spec.whatwg.org/multipage/named-characters.html
+// (the same 2231 entries as https://html.spec.whatwg.org/entities.json).
+//
+// X(name, value): `name` without the leading '&', sorted bytewise; names
+// without a trailing ';' are the legacy ones that also match without it.
+// `value` is UTF-8.
+
+#define EVEN_HTML_ENTITIES(X) \
+    X("AElig", "\xC3\x86") \
+    X("AElig;", "\xC3\x86") \
+    X("AMP", "\x26") \
+    X("AMP;", "\x26") \
+    X("Aacute", "\xC3\x81") \
+    X("Aacute;", "\xC3\x81") \
+    X("Abreve;", "\xC4\x82") \
+    X("Acirc", "\xC3\x82") \
+    X("Acirc;", "\xC3\x82") \
+    X("Acy;", "\xD0\x90") \
+    X("Afr;", "\xF0\x9D\x94\x84") \
+    X("Agrave", "\xC3\x80") \
+    X("Agrave;", "\xC3\x80") \
+    X("Alpha;", "\xCE\x91") \
+    X("Amacr;", "\xC4\x80") \
+    X("And;", "\xE2\xA9\x93") \
+    X("Aogon;", "\xC4\x84") \
+    X("Aopf;", "\xF0\x9D\x94\xB8") \
+    X("ApplyFunction;", "\xE2\x81\xA1") \
+    X("Aring", "\xC3\x85") \
+    X("Aring;", "\xC3\x85") \
+    X("Ascr;", "\xF0\x9D\x92\x9C") \
+    X("Assign;", "\xE2\x89\x94") \
+    X("Atilde", "\xC3\x83") \
+    X("Atilde;", "\xC3\x83") \
+    X("Auml", "\xC3\x84") \
+    X("Auml;", "\xC3\x84") \
+    X("Backslash;", "\xE2\x88\x96") \
+    X("Barv;", "\xE2\xAB\xA7") \
+    X("Barwed;", "\xE2\x8C\x86") \
+    X("Bcy;", "\xD0\x91") \
+    X("Because;", "\xE2\x88\xB5") \
+    X("Bernoullis;", "\xE2\x84\xAC") \
+    X("Beta;", "\xCE\x92") \
+    X("Bfr;", "\xF0\x9D\x94\x85") \
+    X("Bopf;", "\xF0\x9D\x94\xB9") \
+    X("Breve;", "\xCB\x98") \
+    X("Bscr;", "\xE2\x84\xAC") \
+    X("Bumpeq;", "\xE2\x89\x8E") \
+    X("CHcy;", "\xD0\xA7") \
+    X("COPY", "\xC2\xA9") \
+    X("COPY;", "\xC2\xA9") \
+    X("Cacute;", "\xC4\x86") \
+    X("Cap;", "\xE2\x8B\x92") \
+    X("CapitalDifferentialD;", "\xE2\x85\x85") \
+    X("Cayleys;", "\xE2\x84\xAD") \
+    X("Ccaron;", "\xC4\x8C") \
+    X("Ccedil", "\xC3\x87") \
+    X("Ccedil;", "\xC3\x87") \
+    X("Ccirc;", "\xC4\x88") \
+    X("Cconint;", "\xE2\x88\xB0") \
+    X("Cdot;", "\xC4\x8A") \
+    X("Cedilla;", "\xC2\xB8") \
+    X("CenterDot;", "\xC2\xB7") \
+    X("Cfr;", "\xE2\x84\xAD") \
+    X("Chi;", "\xCE\xA7") \
+    X("CircleDot;", "\xE2\x8A\x99") \
+    X("CircleMinus;", "\xE2\x8A\x96") \
+    X("CirclePlus;", "\xE2\x8A\x95") \
+    X("CircleTimes;", "\xE2\x8A\x97") \
+    X("ClockwiseContourIntegral;", "\xE2\x88\xB2") \
+    X("CloseCurlyDoubleQuote;", "\xE2\x80\x9D") \
+    X("CloseCurlyQuote;", "\xE2\x80\x99") \
+    X("Colon;", "\xE2\x88\xB7") \
+    X("Colone;", "\xE2\xA9\xB4") \
+    X("Congruent;", "\xE2\x89\xA1") \
+    X("Conint;", "\xE2\x88\xAF") \
+    X("ContourIntegral;", "\xE2\x88\xAE") \
+    X("Copf;", "\xE2\x84\x82") \
+    X("Coproduct;", "\xE2\x88\x90") \
+    X("CounterClockwiseContourIntegral;", "\xE2\x88\xB3") \
+    X("Cross;", "\xE2\xA8\xAF") \
+    X("Cscr;", "\xF0\x9D\x92\x9E") \
+    X("Cup;", "\xE2\x8B\x93") \
+    X("CupCap;", "\xE2\x89\x8D") \
+    X("DD;", "\xE2\x85\x85") \
+    X("DDotrahd;", "\xE2\xA4\x91") \
+    X("DJcy;", "\xD0\x82") \
+    X("DScy;", "\xD0\x85") \
+    X("DZcy;", "\xD0\x8F") \
+    X("Dagger;", "\xE2\x80\xA1") \
+    X("Darr;", "\xE2\x86\xA1") \
+    X("Dashv;", "\xE2\xAB\xA4") \
+    X("Dcaron;", "\xC4\x8E") \
+    X("Dcy;", "\xD0\x94") \
+    X("Del;", "\xE2\x88\x87") \
+    X("Delta;", "\xCE\x94") \
+    X("Dfr;", "\xF0\x9D\x94\x87") \
+    X("DiacriticalAcute;", "\xC2\xB4") \
+    X("DiacriticalDot;", "\xCB\x99") \
+    X("DiacriticalDoubleAcute;", "\xCB\x9D") \
+    X("DiacriticalGrave;", "\x60") \
+    X("DiacriticalTilde;", "\xCB\x9C") \
+    X("Diamond;", "\xE2\x8B\x84") \
+    X("DifferentialD;", "\xE2\x85\x86") \
+    X("Dopf;", "\xF0\x9D\x94\xBB") \
+    X("Dot;", "\xC2\xA8") \
+    X("DotDot;", "\xE2\x83\x9C") \
+    X("DotEqual;", "\xE2\x89\x90") \
+    X("DoubleContourIntegral;", "\xE2\x88\xAF") \
+    X("DoubleDot;", "\xC2\xA8") \
+    X("DoubleDownArrow;", "\xE2\x87\x93") \
+    X("DoubleLeftArrow;", "\xE2\x87\x90") \
+    X("DoubleLeftRightArrow;", "\xE2\x87\x94") \
+    X("DoubleLeftTee;", "\xE2\xAB\xA4") \
+    X("DoubleLongLeftArrow;", "\xE2\x9F\xB8") \
+    X("DoubleLongLeftRightArrow;", "\xE2\x9F\xBA") \
+    X("DoubleLongRightArrow;", "\xE2\x9F\xB9") \
+    X("DoubleRightArrow;", "\xE2\x87\x92") \
+    X("DoubleRightTee;", "\xE2\x8A\xA8") \
+    X("DoubleUpArrow;", "\xE2\x87\x91") \
+    X("DoubleUpDownArrow;", "\xE2\x87\x95") \
+    X("DoubleVerticalBar;", "\xE2\x88\xA5") \
+    X("DownArrow;", "\xE2\x86\x93") \
+    X("DownArrowBar;", "\xE2\xA4\x93") \
+    X("DownArrowUpArrow;", "\xE2\x87\xB5") \
+    X("DownBreve;", "\xCC\x91") \
+    X("DownLeftRightVector;", "\xE2\xA5\x90") \
+    X("DownLeftTeeVector;", "\xE2\xA5\x9E") \
+    X("DownLeftVector;", "\xE2\x86\xBD") \
+    X("DownLeftVectorBar;", "\xE2\xA5\x96") \
+    X("DownRightTeeVector;", "\xE2\xA5\x9F") \
+    X("DownRightVector;", "\xE2\x87\x81") \
+    X("DownRightVectorBar;", "\xE2\xA5\x97") \
+    X("DownTee;", "\xE2\x8A\xA4") \
+    X("DownTeeArrow;", "\xE2\x86\xA7") \
+    X("Downarrow;", "\xE2\x87\x93") \
+    X("Dscr;", "\xF0\x9D\x92\x9F") \
+    X("Dstrok;", "\xC4\x90") \
+    X("ENG;", "\xC5\x8A") \
+    X("ETH", "\xC3\x90") \
+    X("ETH;", "\xC3\x90") \
+    X("Eacute", "\xC3\x89") \
+    X("Eacute;", "\xC3\x89") \
+    X("Ecaron;", "\xC4\x9A") \
+    X("Ecirc", "\xC3\x8A") \
+    X("Ecirc;", "\xC3\x8A") \
+    X("Ecy;", "\xD0\xAD") \
+    X("Edot;", "\xC4\x96") \
+    X("Efr;", "\xF0\x9D\x94\x88") \
+    X("Egrave", "\xC3\x88") \
+    X("Egrave;", "\xC3\x88") \
+    X("Element;", "\xE2\x88\x88") \
+    X("Emacr;", "\xC4\x92") \
+    X("EmptySmallSquare;", "\xE2\x97\xBB") \
+    X("EmptyVerySmallSquare;", "\xE2\x96\xAB") \
+    X("Eogon;", "\xC4\x98") \
+    X("Eopf;", "\xF0\x9D\x94\xBC") \
+    X("Epsilon;", "\xCE\x95") \
+    X("Equal;", "\xE2\xA9\xB5") \
+    X("EqualTilde;", "\xE2\x89\x82") \
+    X("Equilibrium;", "\xE2\x87\x8C") \
+    X("Escr;", "\xE2\x84\xB0") \
+    X("Esim;", "\xE2\xA9\xB3") \
+    X("Eta;", "\xCE\x97") \
+    X("Euml", "\xC3\x8B") \
+    X("Euml;", "\xC3\x8B") \
+    X("Exists;", "\xE2\x88\x83") \
+    X("ExponentialE;", "\xE2\x85\x87") \
+    X("Fcy;", "\xD0\xA4") \
+    X("Ffr;", "\xF0\x9D\x94\x89") \
+    X("FilledSmallSquare;", "\xE2\x97\xBC") \
+    X("FilledVerySmallSquare;", "\xE2\x96\xAA") \
+    X("Fopf;", "\xF0\x9D\x94\xBD") \
+    X("ForAll;", "\xE2\x88\x80") \
+    X("Fouriertrf;", "\xE2\x84\xB1") \
+    X("Fscr;", "\xE2\x84\xB1") \
+    X("GJcy;", "\xD0\x83") \
+    X("GT", "\x3E") \
+    X("GT;", "\x3E") \
+    X("Gamma;", "\xCE\x93") \
+    X("Gammad;", "\xCF\x9C") \
+    X("Gbreve;", "\xC4\x9E") \
+    X("Gcedil;", "\xC4\xA2") \
+    X("Gcirc;", "\xC4\x9C") \
+    X("Gcy;", "\xD0\x93") \
+    X("Gdot;", "\xC4\xA0") \
+    X("Gfr;", "\xF0\x9D\x94\x8A") \
+    X("Gg;", "\xE2\x8B\x99") \
+    X("Gopf;", "\xF0\x9D\x94\xBE") \
+    X("GreaterEqual;", "\xE2\x89\xA5") \
+    X("GreaterEqualLess;", "\xE2\x8B\x9B") \
+    X("GreaterFullEqual;", "\xE2\x89\xA7") \
+    X("GreaterGreater;", "\xE2\xAA\xA2") \
+    X("GreaterLess;", "\xE2\x89\xB7") \
+    X("GreaterSlantEqual;", "\xE2\xA9\xBE") \
+    X("GreaterTilde;", "\xE2\x89\xB3") \
+    X("Gscr;", "\xF0\x9D\x92\xA2") \
+    X("Gt;", "\xE2\x89\xAB") \
+    X("HARDcy;", "\xD0\xAA") \
+    X("Hacek;", "\xCB\x87") \
+    X("Hat;", "\x5E") \
+    X("Hcirc;", "\xC4\xA4") \
+    X("Hfr;", "\xE2\x84\x8C") \
+    X("HilbertSpace;", "\xE2\x84\x8B") \
+    X("Hopf;", "\xE2\x84\x8D") \
+    X("HorizontalLine;", "\xE2\x94\x80") \
+    X("Hscr;", "\xE2\x84\x8B") \
+    X("Hstrok;", "\xC4\xA6") \
+    X("HumpDownHump;", "\xE2\x89\x8E") \
+    X("HumpEqual;", "\xE2\x89\x8F") \
+    X("IEcy;", "\xD0\x95") \
+    X("IJlig;", "\xC4\xB2") \
+    X("IOcy;", "\xD0\x81") \
+    X("Iacute", "\xC3\x8D") \
+    X("Iacute;", "\xC3\x8D") \
+    X("Icirc", "\xC3\x8E") \
+    X("Icirc;", "\xC3\x8E") \
+    X("Icy;", "\xD0\x98") \
+    X("Idot;", "\xC4\xB0") \
+    X("Ifr;", "\xE2\x84\x91") \
+    X("Igrave", "\xC3\x8C") \
+    X("Igrave;", "\xC3\x8C") \
+    X("Im;", "\xE2\x84\x91") \
+    X("Imacr;", "\xC4\xAA") \
+    X("ImaginaryI;", "\xE2\x85\x88") \
+    X("Implies;", "\xE2\x87\x92") \
+    X("Int;", "\xE2\x88\xAC") \
+    X("Integral;", "\xE2\x88\xAB") \
+    X("Intersection;", "\xE2\x8B\x82") \
+    X("InvisibleComma;", "\xE2\x81\xA3") \
+    X("InvisibleTimes;", "\xE2\x81\xA2") \
+    X("Iogon;", "\xC4\xAE") \
+    X("Iopf;", "\xF0\x9D\x95\x80") \
+    X("Iota;", "\xCE\x99") \
+    X("Iscr;", "\xE2\x84\x90") \
+    X("Itilde;", "\xC4\xA8") \
+    X("Iukcy;", "\xD0\x86") \
+    X("Iuml", "\xC3\x8F") \
+    X("Iuml;", "\xC3\x8F") \
+    X("Jcirc;", "\xC4\xB4") \
+    X("Jcy;", "\xD0\x99") \
+    X("Jfr;", "\xF0\x9D\x94\x8D") \
+    X("Jopf;", "\xF0\x9D\x95\x81") \
+    X("Jscr;", "\xF0\x9D\x92\xA5") \
+    X("Jsercy;", "\xD0\x88") \
+    X("Jukcy;", "\xD0\x84") \
+    X("KHcy;", "\xD0\xA5") \
+    X("KJcy;", "\xD0\x8C") \
+    X("Kappa;", "\xCE\x9A") \
+    X("Kcedil;", "\xC4\xB6") \
+    X("Kcy;", "\xD0\x9A") \
+    X("Kfr;", "\xF0\x9D\x94\x8E") \
+    X("Kopf;", "\xF0\x9D\x95\x82") \
+    X("Kscr;", "\xF0\x9D\x92\xA6") \
+    X("LJcy;", "\xD0\x89") \
+    X("LT", "\x3C") \
+    X("LT;", "\x3C") \
+    X("Lacute;", "\xC4\xB9") \
+    X("Lambda;", "\xCE\x9B") \
+    X("Lang;", "\xE2\x9F\xAA") \
+    X("Laplacetrf;", "\xE2\x84\x92") \
+    X("Larr;", "\xE2\x86\x9E") \
+    X("Lcaron;", "\xC4\xBD") \
+    X("Lcedil;", "\xC4\xBB") \
+    X("Lcy;", "\xD0\x9B") \
+    X("LeftAngleBracket;", "\xE2\x9F\xA8") \
+    X("LeftArrow;", "\xE2\x86\x90") \
+    X("LeftArrowBar;", "\xE2\x87\xA4") \
+    X("LeftArrowRightArrow;", "\xE2\x87\x86") \
+    X("LeftCeiling;", "\xE2\x8C\x88") \
+    X("LeftDoubleBracket;", "\xE2\x9F\xA6") \
+    X("LeftDownTeeVector;", "\xE2\xA5\xA1") \
+    X("LeftDownVector;", "\xE2\x87\x83") \
+    X("LeftDownVectorBar;", "\xE2\xA5\x99") \
+    X("LeftFloor;", "\xE2\x8C\x8A") \
+    X("LeftRightArrow;", "\xE2\x86\x94") \
+    X("LeftRightVector;", "\xE2\xA5\x8E") \
+    X("LeftTee;", "\xE2\x8A\xA3") \
+    X("LeftTeeArrow;", "\xE2\x86\xA4") \
+    X("LeftTeeVector;", "\xE2\xA5\x9A") \
+    X("LeftTriangle;", "\xE2\x8A\xB2") \
+    X("LeftTriangleBar;", "\xE2\xA7\x8F") \
+    X("LeftTriangleEqual;", "\xE2\x8A\xB4") \
+    X("LeftUpDownVector;", "\xE2\xA5\x91") \
+    X("LeftUpTeeVector;", "\xE2\xA5\xA0") \
+    X("LeftUpVector;", "\xE2\x86\xBF") \
+    X("LeftUpVectorBar;", "\xE2\xA5\x98") \
+    X("LeftVector;", "\xE2\x86\xBC") \
+    X("LeftVectorBar;", "\xE2\xA5\x92") \
+    X("Leftarrow;", "\xE2\x87\x90") \
+    X("Leftrightarrow;", "\xE2\x87\x94") \
+    X("LessEqualGreater;", "\xE2\x8B\x9A") \
+    X("LessFullEqual;", "\xE2\x89\xA6") \
+    X("LessGreater;", "\xE2\x89\xB6") \
+    X("LessLess;", "\xE2\xAA\xA1") \
+    X("LessSlantEqual;", "\xE2\xA9\xBD") \
+    X("LessTilde;", "\xE2\x89\xB2") \
+    X("Lfr;", "\xF0\x9D\x94\x8F") \
+    X("Ll;", "\xE2\x8B\x98") \
+    X("Lleftarrow;", "\xE2\x87\x9A") \
+    X("Lmidot;", "\xC4\xBF") \
+    X("LongLeftArrow;", "\xE2\x9F\xB5") \
+    X("LongLeftRightArrow;", "\xE2\x9F\xB7") \
+    X("LongRightArrow;", "\xE2\x9F\xB6") \
+    X("Longleftarrow;", "\xE2\x9F\xB8") \
+    X("Longleftrightarrow;", "\xE2\x9F\xBA") \
+    X("Longrightarrow;", "\xE2\x9F\xB9") \
+    X("Lopf;", "\xF0\x9D\x95\x83") \
+    X("LowerLeftArrow;", "\xE2\x86\x99") \
+    X("LowerRightArrow;", "\xE2\x86\x98") \
+    X("Lscr;", "\xE2\x84\x92") \
+    X("Lsh;", "\xE2\x86\xB0") \
+    X("Lstrok;", "\xC5\x81") \
+    X("Lt;", "\xE2\x89\xAA") \
+    X("Map;", "\xE2\xA4\x85") \
+    X("Mcy;", "\xD0\x9C") \
+    X("MediumSpace;", "\xE2\x81\x9F") \
+    X("Mellintrf;", "\xE2\x84\xB3") \
+    X("Mfr;", "\xF0\x9D\x94\x90") \
+    X("MinusPlus;", "\xE2\x88\x93") \
+    X("Mopf;", "\xF0\x9D\x95\x84") \
+    X("Mscr;", "\xE2\x84\xB3") \
+    X("Mu;", "\xCE\x9C") \
+    X("NJcy;", "\xD0\x8A") \
+    X("Nacute;", "\xC5\x83") \
+    X("Ncaron;", "\xC5\x87") \
+    X("Ncedil;", "\xC5\x85") \
+    X("Ncy;", "\xD0\x9D") \
+    X("NegativeMediumSpace;", "\xE2\x80\x8B") \
+    X("NegativeThickSpace;", "\xE2\x80\x8B") \
+    X("NegativeThinSpace;", "\xE2\x80\x8B") \
+    X("NegativeVeryThinSpace;", "\xE2\x80\x8B") \
+    X("NestedGreaterGreater;", "\xE2\x89\xAB") \
+    X("NestedLessLess;", "\xE2\x89\xAA") \
+    X("NewLine;", "\x0A") \
+    X("Nfr;", "\xF0\x9D\x94\x91") \
+    X("NoBreak;", "\xE2\x81\xA0") \
+    X("NonBreakingSpace;", "\xC2\xA0") \
+    X("Nopf;", "\xE2\x84\x95") \
+    X("Not;", "\xE2\xAB\xAC") \
+    X("NotCongruent;", "\xE2\x89\xA2") \
+    X("NotCupCap;", "\xE2\x89\xAD") \
+    X("NotDoubleVerticalBar;", "\xE2\x88\xA6") \
+    X("NotElement;", "\xE2\x88\x89") \
+    X("NotEqual;", "\xE2\x89\xA0") \
+    X("NotEqualTilde;", "\xE2\x89\x82\xCC\xB8") \
+    X("NotExists;", "\xE2\x88\x84") \
+    X("NotGreater;", "\xE2\x89\xAF") \
+    X("NotGreaterEqual;", "\xE2\x89\xB1") \
+    X("NotGreaterFullEqual;", "\xE2\x89\xA7\xCC\xB8") \
+    X("NotGreaterGreater;", "\xE2\x89\xAB\xCC\xB8") \
+    X("NotGreaterLess;", "\xE2\x89\xB9") \
+    X("NotGreaterSlantEqual;", "\xE2\xA9\xBE\xCC\xB8") \
+    X("NotGreaterTilde;", "\xE2\x89\xB5") \
+    X("NotHumpDownHump;", "\xE2\x89\x8E\xCC\xB8") \
+    X("NotHumpEqual;", "\xE2\x89\x8F\xCC\xB8") \
+    X("NotLeftTriangle;", "\xE2\x8B\xAA") \
+    X("NotLeftTriangleBar;", "\xE2\xA7\x8F\xCC\xB8") \
+    X("NotLeftTriangleEqual;", "\xE2\x8B\xAC") \
+    X("NotLess;", "\xE2\x89\xAE") \
+    X("NotLessEqual;", "\xE2\x89\xB0") \
+    X("NotLessGreater;", "\xE2\x89\xB8") \
+    X("NotLessLess;", "\xE2\x89\xAA\xCC\xB8") \
+    X("NotLessSlantEqual;", "\xE2\xA9\xBD\xCC\xB8") \
+    X("NotLessTilde;", "\xE2\x89\xB4") \
+    X("NotNestedGreaterGreater;", "\xE2\xAA\xA2\xCC\xB8") \
+    X("NotNestedLessLess;", "\xE2\xAA\xA1\xCC\xB8") \
+    X("NotPrecedes;", "\xE2\x8A\x80") \
+    X("NotPrecedesEqual;", "\xE2\xAA\xAF\xCC\xB8") \
+    X("NotPrecedesSlantEqual;", "\xE2\x8B\xA0") \
+    X("NotReverseElement;", "\xE2\x88\x8C") \
+    X("NotRightTriangle;", "\xE2\x8B\xAB") \
+    X("NotRightTriangleBar;", "\xE2\xA7\x90\xCC\xB8") \
+    X("NotRightTriangleEqual;", "\xE2\x8B\xAD") \
+    X("NotSquareSubset;", "\xE2\x8A\x8F\xCC\xB8") \
+    X("NotSquareSubsetEqual;", "\xE2\x8B\xA2") \
+    X("NotSquareSuperset;", "\xE2\x8A\x90\xCC\xB8") \
+    X("NotSquareSupersetEqual;", "\xE2\x8B\xA3") \
+    X("NotSubset;", "\xE2\x8A\x82\xE2\x83\x92") \
+    X("NotSubsetEqual;", "\xE2\x8A\x88") \
+    X("NotSucceeds;", "\xE2\x8A\x81") \
+    X("NotSucceedsEqual;", "\xE2\xAA\xB0\xCC\xB8") \
+    X("NotSucceedsSlantEqual;", "\xE2\x8B\xA1") \
+    X("NotSucceedsTilde;", "\xE2\x89\xBF\xCC\xB8") \
+    X("NotSuperset;", "\xE2\x8A\x83\xE2\x83\x92") \
+    X("NotSupersetEqual;", "\xE2\x8A\x89") \
+    X("NotTilde;", "\xE2\x89\x81") \
+    X("NotTildeEqual;", "\xE2\x89\x84") \
+    X("NotTildeFullEqual;", "\xE2\x89\x87") \
+    X("NotTildeTilde;", "\xE2\x89\x89") \
+    X("NotVerticalBar;", "\xE2\x88\xA4") \
+    X("Nscr;", "\xF0\x9D\x92\xA9") \
+    X("Ntilde", "\xC3\x91") \
+    X("Ntilde;", "\xC3\x91") \
+    X("Nu;", "\xCE\x9D") \
+    X("OElig;", "\xC5\x92") \
+    X("Oacute", "\xC3\x93") \
+    X("Oacute;", "\xC3\x93") \
+    X("Ocirc", "\xC3\x94") \
+    X("Ocirc;", "\xC3\x94") \
+    X("Ocy;", "\xD0\x9E") \
+    X("Odblac;", "\xC5\x90") \
+    X("Ofr;", "\xF0\x9D\x94\x92") \
+    X("Ograve", "\xC3\x92") \
+    X("Ograve;", "\xC3\x92") \
+    X("Omacr;", "\xC5\x8C") \
+    X("Omega;", "\xCE\xA9") \
+    X("Omicron;", "\xCE\x9F") \
+    X("Oopf;", "\xF0\x9D\x95\x86") \
+    X("OpenCurlyDoubleQuote;", "\xE2\x80\x9C") \
+    X("OpenCurlyQuote;", "\xE2\x80\x98") \
+    X("Or;", "\xE2\xA9\x94") \
+    X("Oscr;", "\xF0\x9D\x92\xAA") \
+    X("Oslash", "\xC3\x98") \
+    X("Oslash;", "\xC3\x98") \
+    X("Otilde", "\xC3\x95") \
+    X("Otilde;", "\xC3\x95") \
+    X("Otimes;", "\xE2\xA8\xB7") \
+    X("Ouml", "\xC3\x96") \
+    X("Ouml;", "\xC3\x96") \
+    X("OverBar;", "\xE2\x80\xBE") \
+    X("OverBrace;", "\xE2\x8F\x9E") \
+    X("OverBracket;", "\xE2\x8E\xB4") \
+    X("OverParenthesis;", "\xE2\x8F\x9C") \
+    X("PartialD;", "\xE2\x88\x82") \
+    X("Pcy;", "\xD0\x9F") \
+    X("Pfr;", "\xF0\x9D\x94\x93") \
+    X("Phi;", "\xCE\xA6") \
+    X("Pi;", "\xCE\xA0") \
+    X("PlusMinus;", "\xC2\xB1") \
+    X("Poincareplane;", "\xE2\x84\x8C") \
+    X("Popf;", "\xE2\x84\x99") \
+    X("Pr;", "\xE2\xAA\xBB") \
+    X("Precedes;", "\xE2\x89\xBA") \
+    X("PrecedesEqual;", "\xE2\xAA\xAF") \
+    X("PrecedesSlantEqual;", "\xE2\x89\xBC") \
+    X("PrecedesTilde;", "\xE2\x89\xBE") \
+    X("Prime;", "\xE2\x80\xB3") \
+    X("Product;", "\xE2\x88\x8F") \
+    X("Proportion;", "\xE2\x88\xB7") \
+    X("Proportional;", "\xE2\x88\x9D") \
+    X("Pscr;", "\xF0\x9D\x92\xAB") \
+    X("Psi;", "\xCE\xA8") \
+    X("QUOT", "\x22") \
+    X("QUOT;", "\x22") \
+    X("Qfr;", "\xF0\x9D\x94\x94") \
+    X("Qopf;", "\xE2\x84\x9A") \
+    X("Qscr;", "\xF0\x9D\x92\xAC") \
+    X("RBarr;", "\xE2\xA4\x90") \
+    X("REG", "\xC2\xAE") \
+    X("REG;", "\xC2\xAE") \
+    X("Racute;", "\xC5\x94") \
+    X("Rang;", "\xE2\x9F\xAB") \
+    X("Rarr;", "\xE2\x86\xA0") \
+    X("Rarrtl;", "\xE2\xA4\x96") \
+    X("Rcaron;", "\xC5\x98") \
+    X("Rcedil;", "\xC5\x96") \
+    X("Rcy;", "\xD0\xA0") \
+    X("Re;", "\xE2\x84\x9C") \
+    X("ReverseElement;", "\xE2\x88\x8B") \
+    X("ReverseEquilibrium;", "\xE2\x87\x8B") \
+    X("ReverseUpEquilibrium;", "\xE2\xA5\xAF") \
+    X("Rfr;", "\xE2\x84\x9C") \
+    X("Rho;", "\xCE\xA1") \
+    X("RightAngleBracket;", "\xE2\x9F\xA9") \
+    X("RightArrow;", "\xE2\x86\x92") \
+    X("RightArrowBar;", "\xE2\x87\xA5") \
+    X("RightArrowLeftArrow;", "\xE2\x87\x84") \
+    X("RightCeiling;", "\xE2\x8C\x89") \
+    X("RightDoubleBracket;", "\xE2\x9F\xA7") \
+    X("RightDownTeeVector;", "\xE2\xA5\x9D") \
+    X("RightDownVector;", "\xE2\x87\x82") \
+    X("RightDownVectorBar;", "\xE2\xA5\x95") \
+    X("RightFloor;", "\xE2\x8C\x8B") \
+    X("RightTee;", "\xE2\x8A\xA2") \
+    X("RightTeeArrow;", "\xE2\x86\xA6") \
+    X("RightTeeVector;", "\xE2\xA5\x9B") \
+    X("RightTriangle;", "\xE2\x8A\xB3") \
+    X("RightTriangleBar;", "\xE2\xA7\x90") \
+    X("RightTriangleEqual;", "\xE2\x8A\xB5") \
+    X("RightUpDownVector;", "\xE2\xA5\x8F") \
+    X("RightUpTeeVector;", "\xE2\xA5\x9C") \
+    X("RightUpVector;", "\xE2\x86\xBE") \
+    X("RightUpVectorBar;", "\xE2\xA5\x94") \
+    X("RightVector;", "\xE2\x87\x80") \
+    X("RightVectorBar;", "\xE2\xA5\x93") \
+    X("Rightarrow;", "\xE2\x87\x92") \
+    X("Ropf;", "\xE2\x84\x9D") \
+    X("RoundImplies;", "\xE2\xA5\xB0") \
+    X("Rrightarrow;", "\xE2\x87\x9B") \
+    X("Rscr;", "\xE2\x84\x9B") \
+    X("Rsh;", "\xE2\x86\xB1") \
+    X("RuleDelayed;", "\xE2\xA7\xB4") \
+    X("SHCHcy;", "\xD0\xA9") \
+    X("SHcy;", "\xD0\xA8") \
+    X("SOFTcy;", "\xD0\xAC") \
+    X("Sacute;", "\xC5\x9A") \
+    X("Sc;", "\xE2\xAA\xBC") \
+    X("Scaron;", "\xC5\xA0") \
+    X("Scedil;", "\xC5\x9E") \
+    X("Scirc;", "\xC5\x9C") \
+    X("Scy;", "\xD0\xA1") \
+    X("Sfr;", "\xF0\x9D\x94\x96") \
+    X("ShortDownArrow;", "\xE2\x86\x93") \
+    X("ShortLeftArrow;", "\xE2\x86\x90") \
+    X("ShortRightArrow;", "\xE2\x86\x92") \
+    X("ShortUpArrow;", "\xE2\x86\x91") \
+    X("Sigma;", "\xCE\xA3") \
+    X("SmallCircle;", "\xE2\x88\x98") \
+    X("Sopf;", "\xF0\x9D\x95\x8A") \
+    X("Sqrt;", "\xE2\x88\x9A") \
+    X("Square;", "\xE2\x96\xA1") \
+    X("SquareIntersection;", "\xE2\x8A\x93") \
+    X("SquareSubset;", "\xE2\x8A\x8F") \
+    X("SquareSubsetEqual;", "\xE2\x8A\x91") \
+    X("SquareSuperset;", "\xE2\x8A\x90") \
+    X("SquareSupersetEqual;", "\xE2\x8A\x92") \
+    X("SquareUnion;", "\xE2\x8A\x94") \
+    X("Sscr;", "\xF0\x9D\x92\xAE") \
+    X("Star;", "\xE2\x8B\x86") \
+    X("Sub;", "\xE2\x8B\x90") \
+    X("Subset;", "\xE2\x8B\x90") \
+    X("SubsetEqual;", "\xE2\x8A\x86") \
+    X("Succeeds;", "\xE2\x89\xBB") \
+    X("SucceedsEqual;", "\xE2\xAA\xB0") \
+    X("SucceedsSlantEqual;", "\xE2\x89\xBD") \
+    X("SucceedsTilde;", "\xE2\x89\xBF") \
+    X("SuchThat;", "\xE2\x88\x8B") \
+    X("Sum;", "\xE2\x88\x91") \
+    X("Sup;", "\xE2\x8B\x91") \
+    X("Superset;", "\xE2\x8A\x83") \
+    X("SupersetEqual;", "\xE2\x8A\x87") \
+    X("Supset;", "\xE2\x8B\x91") \
+    X("THORN", "\xC3\x9E") \
+    X("THORN;", "\xC3\x9E") \
+    X("TRADE;", "\xE2\x84\xA2") \
+    X("TSHcy;", "\xD0\x8B") \
+    X("TScy;", "\xD0\xA6") \
+    X("Tab;", "\x09") \
+    X("Tau;", "\xCE\xA4") \
+    X("Tcaron;", "\xC5\xA4") \
+    X("Tcedil;", "\xC5\xA2") \
+    X("Tcy;", "\xD0\xA2") \
+    X("Tfr;", "\xF0\x9D\x94\x97") \
+    X("Therefore;", "\xE2\x88\xB4") \
+    X("Theta;", "\xCE\x98") \
+    X("ThickSpace;", "\xE2\x81\x9F\xE2\x80\x8A") \
+    X("ThinSpace;", "\xE2\x80\x89") \
+    X("Tilde;", "\xE2\x88\xBC") \
+    X("TildeEqual;", "\xE2\x89\x83") \
+    X("TildeFullEqual;", "\xE2\x89\x85") \
+    X("TildeTilde;", "\xE2\x89\x88") \
+    X("Topf;", "\xF0\x9D\x95\x8B") \
+    X("TripleDot;", "\xE2\x83\x9B") \
+    X("Tscr;", "\xF0\x9D\x92\xAF") \
+    X("Tstrok;", "\xC5\xA6") \
+    X("Uacute", "\xC3\x9A") \
+    X("Uacute;", "\xC3\x9A") \
+    X("Uarr;", "\xE2\x86\x9F") \
+    X("Uarrocir;", "\xE2\xA5\x89") \
+    X("Ubrcy;", "\xD0\x8E") \
+    X("Ubreve;", "\xC5\xAC") \
+    X("Ucirc", "\xC3\x9B") \
+    X("Ucirc;", "\xC3\x9B") \
+    X("Ucy;", "\xD0\xA3") \
+    X("Udblac;", "\xC5\xB0") \
+    X("Ufr;", "\xF0\x9D\x94\x98") \
+    X("Ugrave", "\xC3\x99") \
+    X("Ugrave;", "\xC3\x99") \
+    X("Umacr;", "\xC5\xAA") \
+    X("UnderBar;", "\x5F") \
+    X("UnderBrace;", "\xE2\x8F\x9F") \
+    X("UnderBracket;", "\xE2\x8E\xB5") \
+    X("UnderParenthesis;", "\xE2\x8F\x9D") \
+    X("Union;", "\xE2\x8B\x83") \
+    X("UnionPlus;", "\xE2\x8A\x8E") \
+    X("Uogon;", "\xC5\xB2") \
+    X("Uopf;", "\xF0\x9D\x95\x8C") \
+    X("UpArrow;", "\xE2\x86\x91") \
+    X("UpArrowBar;", "\xE2\xA4\x92") \
+    X("UpArrowDownArrow;", "\xE2\x87\x85") \
+    X("UpDownArrow;", "\xE2\x86\x95") \
+    X("UpEquilibrium;", "\xE2\xA5\xAE") \
+    X("UpTee;", "\xE2\x8A\xA5") \
+    X("UpTeeArrow;", "\xE2\x86\xA5") \
+    X("Uparrow;", "\xE2\x87\x91") \
+    X("Updownarrow;", "\xE2\x87\x95") \
+    X("UpperLeftArrow;", "\xE2\x86\x96") \
+    X("UpperRightArrow;", "\xE2\x86\x97") \
+    X("Upsi;", "\xCF\x92") \
+    X("Upsilon;", "\xCE\xA5") \
+    X("Uring;", "\xC5\xAE") \
+    X("Uscr;", "\xF0\x9D\x92\xB0") \
+    X("Utilde;", "\xC5\xA8") \
+    X("Uuml", "\xC3\x9C") \
+    X("Uuml;", "\xC3\x9C") \
+    X("VDash;", "\xE2\x8A\xAB") \
+    X("Vbar;", "\xE2\xAB\xAB") \
+    X("Vcy;", "\xD0\x92") \
+    X("Vdash;", "\xE2\x8A\xA9") \
+    X("Vdashl;", "\xE2\xAB\xA6") \
+    X("Vee;", "\xE2\x8B\x81") \
+    X("Verbar;", "\xE2\x80\x96") \
+    X("Vert;", "\xE2\x80\x96") \
+    X("VerticalBar;", "\xE2\x88\xA3") \
+    X("VerticalLine;", "\x7C") \
+    X("VerticalSeparator;", "\xE2\x9D\x98") \
+    X("VerticalTilde;", "\xE2\x89\x80") \
+    X("VeryThinSpace;", "\xE2\x80\x8A") \
+    X("Vfr;", "\xF0\x9D\x94\x99") \
+    X("Vopf;", "\xF0\x9D\x95\x8D") \
+    X("Vscr;", "\xF0\x9D\x92\xB1") \
+    X("Vvdash;", "\xE2\x8A\xAA") \
+    X("Wcirc;", "\xC5\xB4") \
+    X("Wedge;", "\xE2\x8B\x80") \
+    X("Wfr;", "\xF0\x9D\x94\x9A") \
+    X("Wopf;", "\xF0\x9D\x95\x8E") \
+    X("Wscr;", "\xF0\x9D\x92\xB2") \
+    X("Xfr;", "\xF0\x9D\x94\x9B") \
+    X("Xi;", "\xCE\x9E") \
+    X("Xopf;", "\xF0\x9D\x95\x8F") \
+    X("Xscr;", "\xF0\x9D\x92\xB3") \
+    X("YAcy;", "\xD0\xAF") \
+    X("YIcy;", "\xD0\x87") \
+    X("YUcy;", "\xD0\xAE") \
+    X("Yacute", "\xC3\x9D") \
+    X("Yacute;", "\xC3\x9D") \
+    X("Ycirc;", "\xC5\xB6") \
+    X("Ycy;", "\xD0\xAB") \
+    X("Yfr;", "\xF0\x9D\x94\x9C") \
+    X("Yopf;", "\xF0\x9D\x95\x90") \
+    X("Yscr;", "\xF0\x9D\x92\xB4") \
+    X("Yuml;", "\xC5\xB8") \
+    X("ZHcy;", "\xD0\x96") \
+    X("Zacute;", "\xC5\xB9") \
+    X("Zcaron;", "\xC5\xBD") \
+    X("Zcy;", "\xD0\x97") \
+    X("Zdot;", "\xC5\xBB") \
+    X("ZeroWidthSpace;", "\xE2\x80\x8B") \
+    X("Zeta;", "\xCE\x96") \
+    X("Zfr;", "\xE2\x84\xA8") \
+    X("Zopf;", "\xE2\x84\xA4") \
+    X("Zscr;", "\xF0\x9D\x92\xB5") \
+    X("aacute", "\xC3\xA1") \
+    X("aacute;", "\xC3\xA1") \
+    X("abreve;", "\xC4\x83") \
+    X("ac;", "\xE2\x88\xBE") \
+    X("acE;", "\xE2\x88\xBE\xCC\xB3") \
+    X("acd;", "\xE2\x88\xBF") \
+    X("acirc", "\xC3\xA2") \
+    X("acirc;", "\xC3\xA2") \
+    X("acute", "\xC2\xB4") \
+    X("acute;", "\xC2\xB4") \
+    X("acy;", "\xD0\xB0") \
+    X("aelig", "\xC3\xA6") \
+    X("aelig;", "\xC3\xA6") \
+    X("af;", "\xE2\x81\xA1") \
+    X("afr;", "\xF0\x9D\x94\x9E") \
+    X("agrave", "\xC3\xA0") \
+    X("agrave;", "\xC3\xA0") \
+    X("alefsym;", "\xE2\x84\xB5") \
+    X("aleph;", "\xE2\x84\xB5") \
+    X("alpha;", "\xCE\xB1") \
+    X("amacr;", "\xC4\x81") \
+    X("amalg;", "\xE2\xA8\xBF") \
+    X("amp", "\x26") \
+    X("amp;", "\x26") \
+    X("and;", "\xE2\x88\xA7") \
+    X("andand;", "\xE2\xA9\x95") \
+    X("andd;", "\xE2\xA9\x9C") \
+    X("andslope;", "\xE2\xA9\x98") \
+    X("andv;", "\xE2\xA9\x9A") \
+    X("ang;", "\xE2\x88\xA0") \
+    X("ange;", "\xE2\xA6\xA4") \
+    X("angle;", "\xE2\x88\xA0") \
+    X("angmsd;", "\xE2\x88\xA1") \
+    X("angmsdaa;", "\xE2\xA6\xA8") \
+    X("angmsdab;", "\xE2\xA6\xA9") \
+    X("angmsdac;", "\xE2\xA6\xAA") \
+    X("angmsdad;", "\xE2\xA6\xAB") \
+    X("angmsdae;", "\xE2\xA6\xAC") \
+    X("angmsdaf;", "\xE2\xA6\xAD") \
+    X("angmsdag;", "\xE2\xA6\xAE") \
+    X("angmsdah;", "\xE2\xA6\xAF") \
+    X("angrt;", "\xE2\x88\x9F") \
+    X("angrtvb;", "\xE2\x8A\xBE") \
+    X("angrtvbd;", "\xE2\xA6\x9D") \
+    X("angsph;", "\xE2\x88\xA2") \
+    X("angst;", "\xC3\x85") \
+    X("angzarr;", "\xE2\x8D\xBC") \
+    X("aogon;", "\xC4\x85") \
+    X("aopf;", "\xF0\x9D\x95\x92") \
+    X("ap;", "\xE2\x89\x88") \
+    X("apE;", "\xE2\xA9\xB0") \
+    X("apacir;", "\xE2\xA9\xAF") \
+    X("ape;", "\xE2\x89\x8A") \
+    X("apid;", "\xE2\x89\x8B") \
+    X("apos;", "\x27") \
+    X("approx;", "\xE2\x89\x88") \
+    X("approxeq;", "\xE2\x89\x8A") \
+    X("aring", "\xC3\xA5") \
+    X("aring;", "\xC3\xA5") \
+    X("ascr;", "\xF0\x9D\x92\xB6") \
+    X("ast;", "\x2A") \
+    X("asymp;", "\xE2\x89\x88") \
+    X("asympeq;", "\xE2\x89\x8D") \
+    X("atilde", "\xC3\xA3") \
+    X("atilde;", "\xC3\xA3") \
+    X("auml", "\xC3\xA4") \
+    X("auml;", "\xC3\xA4") \
+    X("awconint;", "\xE2\x88\xB3") \
+    X("awint;", "\xE2\xA8\x91") \
+    X("bNot;", "\xE2\xAB\xAD") \
+    X("backcong;", "\xE2\x89\x8C") \
+    X("backepsilon;", "\xCF\xB6") \
+    X("backprime;", "\xE2\x80\xB5") \
+    X("backsim;", "\xE2\x88\xBD") \
+    X("backsimeq;", "\xE2\x8B\x8D") \
+    X("barvee;", "\xE2\x8A\xBD") \
+    X("barwed;", "\xE2\x8C\x85") \
+    X("barwedge;", "\xE2\x8C\x85") \
+    X("bbrk;", "\xE2\x8E\xB5") \
+    X("bbrktbrk;", "\xE2\x8E\xB6") \
+    X("bcong;", "\xE2\x89\x8C") \
+    X("bcy;", "\xD0\xB1") \
+    X("bdquo;", "\xE2\x80\x9E") \
+    X("becaus;", "\xE2\x88\xB5") \
+    X("because;", "\xE2\x88\xB5") \
+    X("bemptyv;", "\xE2\xA6\xB0") \
+    X("bepsi;", "\xCF\xB6") \
+    X("bernou;", "\xE2\x84\xAC") \
+    X("beta;", "\xCE\xB2") \
+    X("beth;", "\xE2\x84\xB6") \
+    X("between;", "\xE2\x89\xAC") \
+    X("bfr;", "\xF0\x9D\x94\x9F") \
+    X("bigcap;", "\xE2\x8B\x82") \
+    X("bigcirc;", "\xE2\x97\xAF") \
+    X("bigcup;", "\xE2\x8B\x83") \
+    X("bigodot;", "\xE2\xA8\x80") \
+    X("bigoplus;", "\xE2\xA8\x81") \
+    X("bigotimes;", "\xE2\xA8\x82") \
+    X("bigsqcup;", "\xE2\xA8\x86") \
+    X("bigstar;", "\xE2\x98\x85") \
+    X("bigtriangledown;", "\xE2\x96\xBD") \
+    X("bigtriangleup;", "\xE2\x96\xB3") \
+    X("biguplus;", "\xE2\xA8\x84") \
+    X("bigvee;", "\xE2\x8B\x81") \
+    X("bigwedge;", "\xE2\x8B\x80") \
+    X("bkarow;", "\xE2\xA4\x8D") \
+    X("blacklozenge;", "\xE2\xA7\xAB") \
+    X("blacksquare;", "\xE2\x96\xAA") \
+    X("blacktriangle;", "\xE2\x96\xB4") \
+    X("blacktriangledown;", "\xE2\x96\xBE") \
+    X("blacktriangleleft;", "\xE2\x97\x82") \
+    X("blacktriangleright;", "\xE2\x96\xB8") \
+    X("blank;", "\xE2\x90\xA3") \
+    X("blk12;", "\xE2\x96\x92") \
+    X("blk14;", "\xE2\x96\x91") \
+    X("blk34;", "\xE2\x96\x93") \
+    X("block;", "\xE2\x96\x88") \
+    X("bne;", "\x3D\xE2\x83\xA5") \
+    X("bnequiv;", "\xE2\x89\xA1\xE2\x83\xA5") \
+    X("bnot;", "\xE2\x8C\x90") \
+    X("bopf;", "\xF0\x9D\x95\x93") \
+    X("bot;", "\xE2\x8A\xA5") \
+    X("bottom;", "\xE2\x8A\xA5") \
+    X("bowtie;", "\xE2\x8B\x88") \
+    X("boxDL;", "\xE2\x95\x97") \
+    X("boxDR;", "\xE2\x95\x94") \
+    X("boxDl;", "\xE2\x95\x96") \
+    X("boxDr;", "\xE2\x95\x93") \
+    X("boxH;", "\xE2\x95\x90") \
+    X("boxHD;", "\xE2\x95\xA6") \
+    X("boxHU;", "\xE2\x95\xA9") \
+    X("boxHd;", "\xE2\x95\xA4") \
+    X("boxHu;", "\xE2\x95\xA7") \
+    X("boxUL;", "\xE2\x95\x9D") \
+    X("boxUR;", "\xE2\x95\x9A") \
+    X("boxUl;", "\xE2\x95\x9C") \
+    X("boxUr;", "\xE2\x95\x99") \
+    X("boxV;", "\xE2\x95\x91") \
+    X("boxVH;", "\xE2\x95\xAC") \
+    X("boxVL;", "\xE2\x95\xA3") \
+    X("boxVR;", "\xE2\x95\xA0") \
+    X("boxVh;", "\xE2\x95\xAB") \
+    X("boxVl;", "\xE2\x95\xA2") \
+    X("boxVr;", "\xE2\x95\x9F") \
+    X("boxbox;", "\xE2\xA7\x89") \
+    X("boxdL;", "\xE2\x95\x95") \
+    X("boxdR;", "\xE2\x95\x92") \
+    X("boxdl;", "\xE2\x94\x90") \
+    X("boxdr;", "\xE2\x94\x8C") \
+    X("boxh;", "\xE2\x94\x80") \
+    X("boxhD;", "\xE2\x95\xA5") \
+    X("boxhU;", "\xE2\x95\xA8") \
+    X("boxhd;", "\xE2\x94\xAC") \
+    X("boxhu;", "\xE2\x94\xB4") \
+    X("boxminus;", "\xE2\x8A\x9F") \
+    X("boxplus;", "\xE2\x8A\x9E") \
+    X("boxtimes;", "\xE2\x8A\xA0") \
+    X("boxuL;", "\xE2\x95\x9B") \
+    X("boxuR;", "\xE2\x95\x98") \
+    X("boxul;", "\xE2\x94\x98") \
+    X("boxur;", "\xE2\x94\x94") \
+    X("boxv;", "\xE2\x94\x82") \
+    X("boxvH;", "\xE2\x95\xAA") \
+    X("boxvL;", "\xE2\x95\xA1") \
+    X("boxvR;", "\xE2\x95\x9E") \
+    X("boxvh;", "\xE2\x94\xBC") \
+    X("boxvl;", "\xE2\x94\xA4") \
+    X("boxvr;", "\xE2\x94\x9C") \
+    X("bprime;", "\xE2\x80\xB5") \
+    X("breve;", "\xCB\x98") \
+    X("brvbar", "\xC2\xA6") \
+    X("brvbar;", "\xC2\xA6") \
+    X("bscr;", "\xF0\x9D\x92\xB7") \
+    X("bsemi;", "\xE2\x81\x8F") \
+    X("bsim;", "\xE2\x88\xBD") \
+    X("bsime;", "\xE2\x8B\x8D") \
+    X("bsol;", "\x5C") \
+    X("bsolb;", "\xE2\xA7\x85") \
+    X("bsolhsub;", "\xE2\x9F\x88") \
+    X("bull;", "\xE2\x80\xA2") \
+    X("bullet;", "\xE2\x80\xA2") \
+    X("bump;", "\xE2\x89\x8E") \
+    X("bumpE;", "\xE2\xAA\xAE") \
+    X("bumpe;", "\xE2\x89\x8F") \
+    X("bumpeq;", "\xE2\x89\x8F") \
+    X("cacute;", "\xC4\x87") \
+    X("cap;", "\xE2\x88\xA9") \
+    X("capand;", "\xE2\xA9\x84") \
+    X("capbrcup;", "\xE2\xA9\x89") \
+    X("capcap;", "\xE2\xA9\x8B") \
+    X("capcup;", "\xE2\xA9\x87") \
+    X("capdot;", "\xE2\xA9\x80") \
+    X("caps;", "\xE2\x88\xA9\xEF\xB8\x80") \
+    X("caret;", "\xE2\x81\x81") \
+    X("caron;", "\xCB\x87") \
+    X("ccaps;", "\xE2\xA9\x8D") \
+    X("ccaron;", "\xC4\x8D") \
+    X("ccedil", "\xC3\xA7") \
+    X("ccedil;", "\xC3\xA7") \
+    X("ccirc;", "\xC4\x89") \
+    X("ccups;", "\xE2\xA9\x8C") \
+    X("ccupssm;", "\xE2\xA9\x90") \
+    X("cdot;", "\xC4\x8B") \
+    X("cedil", "\xC2\xB8") \
+    X("cedil;", "\xC2\xB8") \
+    X("cemptyv;", "\xE2\xA6\xB2") \
+    X("cent", "\xC2\xA2") \
+    X("cent;", "\xC2\xA2") \
+    X("centerdot;", "\xC2\xB7") \
+    X("cfr;", "\xF0\x9D\x94\xA0") \
+    X("chcy;", "\xD1\x87") \
+    X("check;", "\xE2\x9C\x93") \
+    X("checkmark;", "\xE2\x9C\x93") \
+    X("chi;", "\xCF\x87") \
+    X("cir;", "\xE2\x97\x8B") \
+    X("cirE;", "\xE2\xA7\x83") \
+    X("circ;", "\xCB\x86") \
+    X("circeq;", "\xE2\x89\x97") \
+    X("circlearrowleft;", "\xE2\x86\xBA") \
+    X("circlearrowright;", "\xE2\x86\xBB") \
+    X("circledR;", "\xC2\xAE") \
+    X("circledS;", "\xE2\x93\x88") \
+    X("circledast;", "\xE2\x8A\x9B") \
+    X("circledcirc;", "\xE2\x8A\x9A") \
+    X("circleddash;", "\xE2\x8A\x9D") \
+    X("cire;", "\xE2\x89\x97") \
+    X("cirfnint;", "\xE2\xA8\x90") \
+    X("cirmid;", "\xE2\xAB\xAF") \
+    X("cirscir;", "\xE2\xA7\x82") \
+    X("clubs;", "\xE2\x99\xA3") \
+    X("clubsuit;", "\xE2\x99\xA3") \
+    X("colon;", "\x3A") \
+    X("colone;", "\xE2\x89\x94") \
+    X("coloneq;", "\xE2\x89\x94") \
+    X("comma;", "\x2C") \
+    X("commat;", "\x40") \
+    X("comp;", "\xE2\x88\x81") \
+    X("compfn;", "\xE2\x88\x98") \
+    X("complement;", "\xE2\x88\x81") \
+    X("complexes;", "\xE2\x84\x82") \
+    X("cong;", "\xE2\x89\x85") \
+    X("congdot;", "\xE2\xA9\xAD") \
+    X("conint;", "\xE2\x88\xAE") \
+    X("copf;", "\xF0\x9D\x95\x94") \
+    X("coprod;", "\xE2\x88\x90") \
+    X("copy", "\xC2\xA9") \
+    X("copy;", "\xC2\xA9") \
+    X("copysr;", "\xE2\x84\x97") \
+    X("crarr;", "\xE2\x86\xB5") \
+    X("cross;", "\xE2\x9C\x97") \
+    X("cscr;", "\xF0\x9D\x92\xB8") \
+    X("csub;", "\xE2\xAB\x8F") \
+    X("csube;", "\xE2\xAB\x91") \
+    X("csup;", "\xE2\xAB\x90") \
+    X("csupe;", "\xE2\xAB\x92") \
+    X("ctdot;", "\xE2\x8B\xAF") \
+    X("cudarrl;", "\xE2\xA4\xB8") \
+    X("cudarrr;", "\xE2\xA4\xB5") \
+    X("cuepr;", "\xE2\x8B\x9E") \
+    X("cuesc;", "\xE2\x8B\x9F") \
+    X("cularr;", "\xE2\x86\xB6") \
+    X("cularrp;", "\xE2\xA4\xBD") \
+    X("cup;", "\xE2\x88\xAA") \
+    X("cupbrcap;", "\xE2\xA9\x88") \
+    X("cupcap;", "\xE2\xA9\x86") \
+    X("cupcup;", "\xE2\xA9\x8A") \
+    X("cupdot;", "\xE2\x8A\x8D") \
+    X("cupor;", "\xE2\xA9\x85") \
+    X("cups;", "\xE2\x88\xAA\xEF\xB8\x80") \
+    X("curarr;", "\xE2\x86\xB7") \
+    X("curarrm;", "\xE2\xA4\xBC") \
+    X("curlyeqprec;", "\xE2\x8B\x9E") \
+    X("curlyeqsucc;", "\xE2\x8B\x9F") \
+    X("curlyvee;", "\xE2\x8B\x8E") \
+    X("curlywedge;", "\xE2\x8B\x8F") \
+    X("curren", "\xC2\xA4") \
+    X("curren;", "\xC2\xA4") \
+    X("curvearrowleft;", "\xE2\x86\xB6") \
+    X("curvearrowright;", "\xE2\x86\xB7") \
+    X("cuvee;", "\xE2\x8B\x8E") \
+    X("cuwed;", "\xE2\x8B\x8F") \
+    X("cwconint;", "\xE2\x88\xB2") \
+    X("cwint;", "\xE2\x88\xB1") \
+    X("cylcty;", "\xE2\x8C\xAD") \
+    X("dArr;", "\xE2\x87\x93") \
+    X("dHar;", "\xE2\xA5\xA5") \
+    X("dagger;", "\xE2\x80\xA0") \
+    X("daleth;", "\xE2\x84\xB8") \
+    X("darr;", "\xE2\x86\x93") \
+    X("dash;", "\xE2\x80\x90") \
+    X("dashv;", "\xE2\x8A\xA3") \
+    X("dbkarow;", "\xE2\xA4\x8F") \
+    X("dblac;", "\xCB\x9D") \
+    X("dcaron;", "\xC4\x8F") \
+    X("dcy;", "\xD0\xB4") \
+    X("dd;", "\xE2\x85\x86") \
+    X("ddagger;", "\xE2\x80\xA1") \
+    X("ddarr;", "\xE2\x87\x8A") \
+    X("ddotseq;", "\xE2\xA9\xB7") \
+    X("deg", "\xC2\xB0") \
+    X("deg;", "\xC2\xB0") \
+    X("delta;", "\xCE\xB4") \
+    X("demptyv;", "\xE2\xA6\xB1") \
+    X("dfisht;", "\xE2\xA5\xBF") \
+    X("dfr;", "\xF0\x9D\x94\xA1") \
+    X("dharl;", "\xE2\x87\x83") \
+    X("dharr;", "\xE2\x87\x82") \
+    X("diam;", "\xE2\x8B\x84") \
+    X("diamond;", "\xE2\x8B\x84") \
+    X("diamondsuit;", "\xE2\x99\xA6") \
+    X("diams;", "\xE2\x99\xA6") \
+    X("die;", "\xC2\xA8") \
+    X("digamma;", "\xCF\x9D") \
+    X("disin;", "\xE2\x8B\xB2") \
+    X("div;", "\xC3\xB7") \
+    X("divide", "\xC3\xB7") \
+    X("divide;", "\xC3\xB7") \
+    X("divideontimes;", "\xE2\x8B\x87") \
+    X("divonx;", "\xE2\x8B\x87") \
+    X("djcy;", "\xD1\x92") \
+    X("dlcorn;", "\xE2\x8C\x9E") \
+    X("dlcrop;", "\xE2\x8C\x8D") \
+    X("dollar;", "\x24") \
+    X("dopf;", "\xF0\x9D\x95\x95") \
+    X("dot;", "\xCB\x99") \
+    X("doteq;", "\xE2\x89\x90") \
+    X("doteqdot;", "\xE2\x89\x91") \
+    X("dotminus;", "\xE2\x88\xB8") \
+    X("dotplus;", "\xE2\x88\x94") \
+    X("dotsquare;", "\xE2\x8A\xA1") \
+    X("doublebarwedge;", "\xE2\x8C\x86") \
+    X("downarrow;", "\xE2\x86\x93") \
+    X("downdownarrows;", "\xE2\x87\x8A") \
+    X("downharpoonleft;", "\xE2\x87\x83") \
+    X("downharpoonright;", "\xE2\x87\x82") \
+    X("drbkarow;", "\xE2\xA4\x90") \
+    X("drcorn;", "\xE2\x8C\x9F") \
+    X("drcrop;", "\xE2\x8C\x8C") \
+    X("dscr;", "\xF0\x9D\x92\xB9") \
+    X("dscy;", "\xD1\x95") \
+    X("dsol;", "\xE2\xA7\xB6") \
+    X("dstrok;", "\xC4\x91") \
+    X("dtdot;", "\xE2\x8B\xB1") \
+    X("dtri;", "\xE2\x96\xBF") \
+    X("dtrif;", "\xE2\x96\xBE") \
+    X("duarr;", "\xE2\x87\xB5") \
+    X("duhar;", "\xE2\xA5\xAF") \
+    X("dwangle;", "\xE2\xA6\xA6") \
+    X("dzcy;", "\xD1\x9F") \
+    X("dzigrarr;", "\xE2\x9F\xBF") \
+    X("eDDot;", "\xE2\xA9\xB7") \
+    X("eDot;", "\xE2\x89\x91") \
+    X("eacute", "\xC3\xA9") \
+    X("eacute;", "\xC3\xA9") \
+    X("easter;", "\xE2\xA9\xAE") \
+    X("ecaron;", "\xC4\x9B") \
+    X("ecir;", "\xE2\x89\x96") \
+    X("ecirc", "\xC3\xAA") \
+    X("ecirc;", "\xC3\xAA") \
+    X("ecolon;", "\xE2\x89\x95") \
+    X("ecy;", "\xD1\x8D") \
+    X("edot;", "\xC4\x97") \
+    X("ee;", "\xE2\x85\x87") \
+    X("efDot;", "\xE2\x89\x92") \
+    X("efr;", "\xF0\x9D\x94\xA2") \
+    X("eg;", "\xE2\xAA\x9A") \
+    X("egrave", "\xC3\xA8") \
+    X("egrave;", "\xC3\xA8") \
+    X("egs;", "\xE2\xAA\x96") \
+    X("egsdot;", "\xE2\xAA\x98") \
+    X("el;", "\xE2\xAA\x99") \
+    X("elinters;", "\xE2\x8F\xA7") \
+    X("ell;", "\xE2\x84\x93") \
+    X("els;", "\xE2\xAA\x95") \
+    X("elsdot;", "\xE2\xAA\x97") \
+    X("emacr;", "\xC4\x93") \
+    X("empty;", "\xE2\x88\x85") \
+    X("emptyset;", "\xE2\x88\x85") \
+    X("emptyv;", "\xE2\x88\x85") \
+    X("emsp13;", "\xE2\x80\x84") \
+    X("emsp14;", "\xE2\x80\x85") \
+    X("emsp;", "\xE2\x80\x83") \
+    X("eng;", "\xC5\x8B") \
+    X("ensp;", "\xE2\x80\x82") \
+    X("eogon;", "\xC4\x99") \
+    X("eopf;", "\xF0\x9D\x95\x96") \
+    X("epar;", "\xE2\x8B\x95") \
+    X("eparsl;", "\xE2\xA7\xA3") \
+    X("eplus;", "\xE2\xA9\xB1") \
+    X("epsi;", "\xCE\xB5") \
+    X("epsilon;", "\xCE\xB5") \
+    X("epsiv;", "\xCF\xB5") \
+    X("eqcirc;", "\xE2\x89\x96") \
+    X("eqcolon;", "\xE2\x89\x95") \
+    X("eqsim;", "\xE2\x89\x82") \
+    X("eqslantgtr;", "\xE2\xAA\x96") \
+    X("eqslantless;", "\xE2\xAA\x95") \
+    X("equals;", "\x3D") \
+    X("equest;", "\xE2\x89\x9F") \
+    X("equiv;", "\xE2\x89\xA1") \
+    X("equivDD;", "\xE2\xA9\xB8") \
+    X("eqvparsl;", "\xE2\xA7\xA5") \
+    X("erDot;", "\xE2\x89\x93") \
+    X("erarr;", "\xE2\xA5\xB1") \
+    X("escr;", "\xE2\x84\xAF") \
+    X("esdot;", "\xE2\x89\x90") \
+    X("esim;", "\xE2\x89\x82") \
+    X("eta;", "\xCE\xB7") \
+    X("eth", "\xC3\xB0") \
+    X("eth;", "\xC3\xB0") \
+    X("euml", "\xC3\xAB") \
+    X("euml;", "\xC3\xAB") \
+    X("euro;", "\xE2\x82\xAC") \
+    X("excl;", "\x21") \
+    X("exist;", "\xE2\x88\x83") \
+    X("expectation;", "\xE2\x84\xB0") \
+    X("exponentiale;", "\xE2\x85\x87") \
+    X("fallingdotseq;", "\xE2\x89\x92") \
+    X("fcy;", "\xD1\x84") \
+    X("female;", "\xE2\x99\x80") \
+    X("ffilig;", "\xEF\xAC\x83") \
+    X("fflig;", "\xEF\xAC\x80") \
+    X("ffllig;", "\xEF\xAC\x84") \
+    X("ffr;", "\xF0\x9D\x94\xA3") \
+    X("filig;", "\xEF\xAC\x81") \
+    X("fjlig;", "\x66\x6A") \
+    X("flat;", "\xE2\x99\xAD") \
+    X("fllig;", "\xEF\xAC\x82") \
+    X("fltns;", "\xE2\x96\xB1") \
+    X("fnof;", "\xC6\x92") \
+    X("fopf;", "\xF0\x9D\x95\x97") \
+    X("forall;", "\xE2\x88\x80") \
+    X("fork;", "\xE2\x8B\x94") \
+    X("forkv;", "\xE2\xAB\x99") \
+    X("fpartint;", "\xE2\xA8\x8D") \
+    X("frac12", "\xC2\xBD") \
+    X("frac12;", "\xC2\xBD") \
+    X("frac13;", "\xE2\x85\x93") \
+    X("frac14", "\xC2\xBC") \
+    X("frac14;", "\xC2\xBC") \
+    X("frac15;", "\xE2\x85\x95") \
+    X("frac16;", "\xE2\x85\x99") \
+    X("frac18;", "\xE2\x85\x9B") \
+    X("frac23;", "\xE2\x85\x94") \
+    X("frac25;", "\xE2\x85\x96") \
+    X("frac34", "\xC2\xBE") \
+    X("frac34;", "\xC2\xBE") \
+    X("frac35;", "\xE2\x85\x97") \
+    X("frac38;", "\xE2\x85\x9C") \
+    X("frac45;", "\xE2\x85\x98") \
+    X("frac56;", "\xE2\x85\x9A") \
+    X("frac58;", "\xE2\x85\x9D") \
+    X("frac78;", "\xE2\x85\x9E") \
+    X("frasl;", "\xE2\x81\x84") \
+    X("frown;", "\xE2\x8C\xA2") \
+    X("fscr;", "\xF0\x9D\x92\xBB") \
+    X("gE;", "\xE2\x89\xA7") \
+    X("gEl;", "\xE2\xAA\x8C") \
+    X("gacute;", "\xC7\xB5") \
+    X("gamma;", "\xCE\xB3") \
+    X("gammad;", "\xCF\x9D") \
+    X("gap;", "\xE2\xAA\x86") \
+    X("gbreve;", "\xC4\x9F") \
+    X("gcirc;", "\xC4\x9D") \
+    X("gcy;", "\xD0\xB3") \
+    X("gdot;", "\xC4\xA1") \
+    X("ge;", "\xE2\x89\xA5") \
+    X("gel;", "\xE2\x8B\x9B") \
+    X("geq;", "\xE2\x89\xA5") \
+    X("geqq;", "\xE2\x89\xA7") \
+    X("geqslant;", "\xE2\xA9\xBE") \
+    X("ges;", "\xE2\xA9\xBE") \
+    X("gescc;", "\xE2\xAA\xA9") \
+    X("gesdot;", "\xE2\xAA\x80") \
+    X("gesdoto;", "\xE2\xAA\x82") \
+    X("gesdotol;", "\xE2\xAA\x84") \
+    X("gesl;", "\xE2\x8B\x9B\xEF\xB8\x80") \
+    X("gesles;", "\xE2\xAA\x94") \
+    X("gfr;", "\xF0\x9D\x94\xA4") \
+    X("gg;", "\xE2\x89\xAB") \
+    X("ggg;", "\xE2\x8B\x99") \
+    X("gimel;", "\xE2\x84\xB7") \
+    X("gjcy;", "\xD1\x93") \
+    X("gl;", "\xE2\x89\xB7") \
+    X("glE;", "\xE2\xAA\x92") \
+    X("gla;", "\xE2\xAA\xA5") \
+    X("glj;", "\xE2\xAA\xA4") \
+    X("gnE;", "\xE2\x89\xA9") \
+    X("gnap;", "\xE2\xAA\x8A") \
+    X("gnapprox;", "\xE2\xAA\x8A") \
+    X("gne;", "\xE2\xAA\x88") \
+    X("gneq;", "\xE2\xAA\x88") \
+    X("gneqq;", "\xE2\x89\xA9") \
+    X("gnsim;", "\xE2\x8B\xA7") \
+    X("gopf;", "\xF0\x9D\x95\x98") \
+    X("grave;", "\x60") \
+    X("gscr;", "\xE2\x84\x8A") \
+    X("gsim;", "\xE2\x89\xB3") \
+    X("gsime;", "\xE2\xAA\x8E") \
+    X("gsiml;", "\xE2\xAA\x90") \
+    X("gt", "\x3E") \
+    X("gt;", "\x3E") \
+    X("gtcc;", "\xE2\xAA\xA7") \
+    X("gtcir;", "\xE2\xA9\xBA") \
+    X("gtdot;", "\xE2\x8B\x97") \
+    X("gtlPar;", "\xE2\xA6\x95") \
+    X("gtquest;", "\xE2\xA9\xBC") \
+    X("gtrapprox;", "\xE2\xAA\x86") \
+    X("gtrarr;", "\xE2\xA5\xB8") \
+    X("gtrdot;", "\xE2\x8B\x97") \
+    X("gtreqless;", "\xE2\x8B\x9B") \
+    X("gtreqqless;", "\xE2\xAA\x8C") \
+    X("gtrless;", "\xE2\x89\xB7") \
+    X("gtrsim;", "\xE2\x89\xB3") \
+    X("gvertneqq;", "\xE2\x89\xA9\xEF\xB8\x80") \
+    X("gvnE;", "\xE2\x89\xA9\xEF\xB8\x80") \
+    X("hArr;", "\xE2\x87\x94") \
+    X("hairsp;", "\xE2\x80\x8A") \
+    X("half;", "\xC2\xBD") \
+    X("hamilt;", "\xE2\x84\x8B") \
+    X("hardcy;", "\xD1\x8A") \
+    X("harr;", "\xE2\x86\x94") \
+    X("harrcir;", "\xE2\xA5\x88") \
+    X("harrw;", "\xE2\x86\xAD") \
+    X("hbar;", "\xE2\x84\x8F") \
+    X("hcirc;", "\xC4\xA5") \
+    X("hearts;", "\xE2\x99\xA5") \
+    X("heartsuit;", "\xE2\x99\xA5") \
+    X("hellip;", "\xE2\x80\xA6") \
+    X("hercon;", "\xE2\x8A\xB9") \
+    X("hfr;", "\xF0\x9D\x94\xA5") \
+    X("hksearow;", "\xE2\xA4\xA5") \
+    X("hkswarow;", "\xE2\xA4\xA6") \
+    X("hoarr;", "\xE2\x87\xBF") \
+    X("homtht;", "\xE2\x88\xBB") \
+    X("hookleftarrow;", "\xE2\x86\xA9") \
+    X("hookrightarrow;", "\xE2\x86\xAA") \
+    X("hopf;", "\xF0\x9D\x95\x99") \
+    X("horbar;", "\xE2\x80\x95") \
+    X("hscr;", "\xF0\x9D\x92\xBD") \
+    X("hslash;", "\xE2\x84\x8F") \
+    X("hstrok;", "\xC4\xA7") \
+    X("hybull;", "\xE2\x81\x83") \
+    X("hyphen;", "\xE2\x80\x90") \
+    X("iacute", "\xC3\xAD") \
+    X("iacute;", "\xC3\xAD") \
+    X("ic;", "\xE2\x81\xA3") \
+    X("icirc", "\xC3\xAE") \
+    X("icirc;", "\xC3\xAE") \
+    X("icy;", "\xD0\xB8") \
+    X("iecy;", "\xD0\xB5") \
+    X("iexcl", "\xC2\xA1") \
+    X("iexcl;", "\xC2\xA1") \
+    X("iff;", "\xE2\x87\x94") \
+    X("ifr;", "\xF0\x9D\x94\xA6") \
+    X("igrave", "\xC3\xAC") \
+    X("igrave;", "\xC3\xAC") \
+    X("ii;", "\xE2\x85\x88") \
+    X("iiiint;", "\xE2\xA8\x8C") \
+    X("iiint;", "\xE2\x88\xAD") \
+    X("iinfin;", "\xE2\xA7\x9C") \
+    X("iiota;", "\xE2\x84\xA9") \
+    X("ijlig;", "\xC4\xB3") \
+    X("imacr;", "\xC4\xAB") \
+    X("image;", "\xE2\x84\x91") \
+    X("imagline;", "\xE2\x84\x90") \
+    X("imagpart;", "\xE2\x84\x91") \
+    X("imath;", "\xC4\xB1") \
+    X("imof;", "\xE2\x8A\xB7") \
+    X("imped;", "\xC6\xB5") \
+    X("in;", "\xE2\x88\x88") \
+    X("incare;", "\xE2\x84\x85") \
+    X("infin;", "\xE2\x88\x9E") \
+    X("infintie;", "\xE2\xA7\x9D") \
+    X("inodot;", "\xC4\xB1") \
+    X("int;", "\xE2\x88\xAB") \
+    X("intcal;", "\xE2\x8A\xBA") \
+    X("integers;", "\xE2\x84\xA4") \
+    X("intercal;", "\xE2\x8A\xBA") \
+    X("intlarhk;", "\xE2\xA8\x97") \
+    X("intprod;", "\xE2\xA8\xBC") \
+    X("iocy;", "\xD1\x91") \
+    X("iogon;", "\xC4\xAF") \
+    X("iopf;", "\xF0\x9D\x95\x9A") \
+    X("iota;", "\xCE\xB9") \
+    X("iprod;", "\xE2\xA8\xBC") \
+    X("iquest", "\xC2\xBF") \
+    X("iquest;", "\xC2\xBF") \
+    X("iscr;", "\xF0\x9D\x92\xBE") \
+    X("isin;", "\xE2\x88\x88") \
+    X("isinE;", "\xE2\x8B\xB9") \
+    X("isindot;", "\xE2\x8B\xB5") \
+    X("isins;", "\xE2\x8B\xB4") \
+    X("isinsv;", "\xE2\x8B\xB3") \
+    X("isinv;", "\xE2\x88\x88") \
+    X("it;", "\xE2\x81\xA2") \
+    X("itilde;", "\xC4\xA9") \
+    X("iukcy;", "\xD1\x96") \
+    X("iuml", "\xC3\xAF") \
+    X("iuml;", "\xC3\xAF") \
+    X("jcirc;", "\xC4\xB5") \
+    X("jcy;", "\xD0\xB9") \
+    X("jfr;", "\xF0\x9D\x94\xA7") \
+    X("jmath;", "\xC8\xB7") \
+    X("jopf;", "\xF0\x9D\x95\x9B") \
+    X("jscr;", "\xF0\x9D\x92\xBF") \
+    X("jsercy;", "\xD1\x98") \
+    X("jukcy;", "\xD1\x94") \
+    X("kappa;", "\xCE\xBA") \
+    X("kappav;", "\xCF\xB0") \
+    X("kcedil;", "\xC4\xB7") \
+    X("kcy;", "\xD0\xBA") \
+    X("kfr;", "\xF0\x9D\x94\xA8") \
+    X("kgreen;", "\xC4\xB8") \
+    X("khcy;", "\xD1\x85") \
+    X("kjcy;", "\xD1\x9C") \
+    X("kopf;", "\xF0\x9D\x95\x9C") \
+    X("kscr;", "\xF0\x9D\x93\x80") \
+    X("lAarr;", "\xE2\x87\x9A") \
+    X("lArr;", "\xE2\x87\x90") \
+    X("lAtail;", "\xE2\xA4\x9B") \
+    X("lBarr;", "\xE2\xA4\x8E") \
+    X("lE;", "\xE2\x89\xA6") \
+    X("lEg;", "\xE2\xAA\x8B") \
+    X("lHar;", "\xE2\xA5\xA2") \
+    X("lacute;", "\xC4\xBA") \
+    X("laemptyv;", "\xE2\xA6\xB4") \
+    X("lagran;", "\xE2\x84\x92") \
+    X("lambda;", "\xCE\xBB") \
+    X("lang;", "\xE2\x9F\xA8") \
+    X("langd;", "\xE2\xA6\x91") \
+    X("langle;", "\xE2\x9F\xA8") \
+    X("lap;", "\xE2\xAA\x85") \
+    X("laquo", "\xC2\xAB") \
+    X("laquo;", "\xC2\xAB") \
+    X("larr;", "\xE2\x86\x90") \
+    X("larrb;", "\xE2\x87\xA4") \
+    X("larrbfs;", "\xE2\xA4\x9F") \
+    X("larrfs;", "\xE2\xA4\x9D") \
+    X("larrhk;", "\xE2\x86\xA9") \
+    X("larrlp;", "\xE2\x86\xAB") \
+    X("larrpl;", "\xE2\xA4\xB9") \
+    X("larrsim;", "\xE2\xA5\xB3") \
+    X("larrtl;", "\xE2\x86\xA2") \
+    X("lat;", "\xE2\xAA\xAB") \
+    X("latail;", "\xE2\xA4\x99") \
+    X("late;", "\xE2\xAA\xAD") \
+    X("lates;", "\xE2\xAA\xAD\xEF\xB8\x80") \
+    X("lbarr;", "\xE2\xA4\x8C") \
+    X("lbbrk;", "\xE2\x9D\xB2") \
+    X("lbrace;", "\x7B") \
+    X("lbrack;", "\x5B") \
+    X("lbrke;", "\xE2\xA6\x8B") \
+    X("lbrksld;", "\xE2\xA6\x8F") \
+    X("lbrkslu;", "\xE2\xA6\x8D") \
+    X("lcaron;", "\xC4\xBE") \
+    X("lcedil;", "\xC4\xBC") \
+    X("lceil;", "\xE2\x8C\x88") \
+    X("lcub;", "\x7B") \
+    X("lcy;", "\xD0\xBB") \
+    X("ldca;", "\xE2\xA4\xB6") \
+    X("ldquo;", "\xE2\x80\x9C") \
+    X("ldquor;", "\xE2\x80\x9E") \
+    X("ldrdhar;", "\xE2\xA5\xA7") \
+    X("ldrushar;", "\xE2\xA5\x8B") \
+    X("ldsh;", "\xE2\x86\xB2") \
+    X("le;", "\xE2\x89\xA4") \
+    X("leftarrow;", "\xE2\x86\x90") \
+    X("leftarrowtail;", "\xE2\x86\xA2") \
+    X("leftharpoondown;", "\xE2\x86\xBD") \
+    X("leftharpoonup;", "\xE2\x86\xBC") \
+    X("leftleftarrows;", "\xE2\x87\x87") \
+    X("leftrightarrow;", "\xE2\x86\x94") \
+    X("leftrightarrows;", "\xE2\x87\x86") \
+    X("leftrightharpoons;", "\xE2\x87\x8B") \
+    X("leftrightsquigarrow;", "\xE2\x86\xAD") \
+    X("leftthreetimes;", "\xE2\x8B\x8B") \
+    X("leg;", "\xE2\x8B\x9A") \
+    X("leq;", "\xE2\x89\xA4") \
+    X("leqq;", "\xE2\x89\xA6") \
+    X("leqslant;", "\xE2\xA9\xBD") \
+    X("les;", "\xE2\xA9\xBD") \
+    X("lescc;", "\xE2\xAA\xA8") \
+    X("lesdot;", "\xE2\xA9\xBF") \
+    X("lesdoto;", "\xE2\xAA\x81") \
+    X("lesdotor;", "\xE2\xAA\x83") \
+    X("lesg;", "\xE2\x8B\x9A\xEF\xB8\x80") \
+    X("lesges;", "\xE2\xAA\x93") \
+    X("lessapprox;", "\xE2\xAA\x85") \
+    X("lessdot;", "\xE2\x8B\x96") \
+    X("lesseqgtr;", "\xE2\x8B\x9A") \
+    X("lesseqqgtr;", "\xE2\xAA\x8B") \
+    X("lessgtr;", "\xE2\x89\xB6") \
+    X("lesssim;", "\xE2\x89\xB2") \
+    X("lfisht;", "\xE2\xA5\xBC") \
+    X("lfloor;", "\xE2\x8C\x8A") \
+    X("lfr;", "\xF0\x9D\x94\xA9") \
+    X("lg;", "\xE2\x89\xB6") \
+    X("lgE;", "\xE2\xAA\x91") \
+    X("lhard;", "\xE2\x86\xBD") \
+    X("lharu;", "\xE2\x86\xBC") \
+    X("lharul;", "\xE2\xA5\xAA") \
+    X("lhblk;", "\xE2\x96\x84") \
+    X("ljcy;", "\xD1\x99") \
+    X("ll;", "\xE2\x89\xAA") \
+    X("llarr;", "\xE2\x87\x87") \
+    X("llcorner;", "\xE2\x8C\x9E") \
+    X("llhard;", "\xE2\xA5\xAB") \
+    X("lltri;", "\xE2\x97\xBA") \
+    X("lmidot;", "\xC5\x80") \
+    X("lmoust;", "\xE2\x8E\xB0") \
+    X("lmoustache;", "\xE2\x8E\xB0") \
+    X("lnE;", "\xE2\x89\xA8") \
+    X("lnap;", "\xE2\xAA\x89") \
+    X("lnapprox;", "\xE2\xAA\x89") \
+    X("lne;", "\xE2\xAA\x87") \
+    X("lneq;", "\xE2\xAA\x87") \
+    X("lneqq;", "\xE2\x89\xA8") \
+    X("lnsim;", "\xE2\x8B\xA6") \
+    X("loang;", "\xE2\x9F\xAC") \
+    X("loarr;", "\xE2\x87\xBD") \
+    X("lobrk;", "\xE2\x9F\xA6") \
+    X("longleftarrow;", "\xE2\x9F\xB5") \
+    X("longleftrightarrow;", "\xE2\x9F\xB7") \
+    X("longmapsto;", "\xE2\x9F\xBC") \
+    X("longrightarrow;", "\xE2\x9F\xB6") \
+    X("looparrowleft;", "\xE2\x86\xAB") \
+    X("looparrowright;", "\xE2\x86\xAC") \
+    X("lopar;", "\xE2\xA6\x85") \
+    X("lopf;", "\xF0\x9D\x95\x9D") \
+    X("loplus;", "\xE2\xA8\xAD") \
+    X("lotimes;", "\xE2\xA8\xB4") \
+    X("lowast;", "\xE2\x88\x97") \
+    X("lowbar;", "\x5F") \
+    X("loz;", "\xE2\x97\x8A") \
+    X("lozenge;", "\xE2\x97\x8A") \
+    X("lozf;", "\xE2\xA7\xAB") \
+    X("lpar;", "\x28") \
+    X("lparlt;", "\xE2\xA6\x93") \
+    X("lrarr;", "\xE2\x87\x86") \
+    X("lrcorner;", "\xE2\x8C\x9F") \
+    X("lrhar;", "\xE2\x87\x8B") \
+    X("lrhard;", "\xE2\xA5\xAD") \
+    X("lrm;", "\xE2\x80\x8E") \
+    X("lrtri;", "\xE2\x8A\xBF") \
+    X("lsaquo;", "\xE2\x80\xB9") \
+    X("lscr;", "\xF0\x9D\x93\x81") \
+    X("lsh;", "\xE2\x86\xB0") \
+    X("lsim;", "\xE2\x89\xB2") \
+    X("lsime;", "\xE2\xAA\x8D") \
+    X("lsimg;", "\xE2\xAA\x8F") \
+    X("lsqb;", "\x5B") \
+    X("lsquo;", "\xE2\x80\x98") \
+    X("lsquor;", "\xE2\x80\x9A") \
+    X("lstrok;", "\xC5\x82") \
+    X("lt", "\x3C") \
+    X("lt;", "\x3C") \
+    X("ltcc;", "\xE2\xAA\xA6") \
+    X("ltcir;", "\xE2\xA9\xB9") \
+    X("ltdot;", "\xE2\x8B\x96") \
+    X("lthree;", "\xE2\x8B\x8B") \
+    X("ltimes;", "\xE2\x8B\x89") \
+    X("ltlarr;", "\xE2\xA5\xB6") \
+    X("ltquest;", "\xE2\xA9\xBB") \
+    X("ltrPar;", "\xE2\xA6\x96") \
+    X("ltri;", "\xE2\x97\x83") \
+    X("ltrie;", "\xE2\x8A\xB4") \
+    X("ltrif;", "\xE2\x97\x82") \
+    X("lurdshar;", "\xE2\xA5\x8A") \
+    X("luruhar;", "\xE2\xA5\xA6") \
+    X("lvertneqq;", "\xE2\x89\xA8\xEF\xB8\x80") \
+    X("lvnE;", "\xE2\x89\xA8\xEF\xB8\x80") \
+    X("mDDot;", "\xE2\x88\xBA") \
+    X("macr", "\xC2\xAF") \
+    X("macr;", "\xC2\xAF") \
+    X("male;", "\xE2\x99\x82") \
+    X("malt;", "\xE2\x9C\xA0") \
+    X("maltese;", "\xE2\x9C\xA0") \
+    X("map;", "\xE2\x86\xA6") \
+    X("mapsto;", "\xE2\x86\xA6") \
+    X("mapstodown;", "\xE2\x86\xA7") \
+    X("mapstoleft;", "\xE2\x86\xA4") \
+    X("mapstoup;", "\xE2\x86\xA5") \
+    X("marker;", "\xE2\x96\xAE") \
+    X("mcomma;", "\xE2\xA8\xA9") \
+    X("mcy;", "\xD0\xBC") \
+    X("mdash;", "\xE2\x80\x94") \
+    X("measuredangle;", "\xE2\x88\xA1") \
+    X("mfr;", "\xF0\x9D\x94\xAA") \
+    X("mho;", "\xE2\x84\xA7") \
+    X("micro", "\xC2\xB5") \
+    X("micro;", "\xC2\xB5") \
+    X("mid;", "\xE2\x88\xA3") \
+    X("midast;", "\x2A") \
+    X("midcir;", "\xE2\xAB\xB0") \
+    X("middot", "\xC2\xB7") \
+    X("middot;", "\xC2\xB7") \
+    X("minus;", "\xE2\x88\x92") \
+    X("minusb;", "\xE2\x8A\x9F") \
+    X("minusd;", "\xE2\x88\xB8") \
+    X("minusdu;", "\xE2\xA8\xAA") \
+    X("mlcp;", "\xE2\xAB\x9B") \
+    X("mldr;", "\xE2\x80\xA6") \
+    X("mnplus;", "\xE2\x88\x93") \
+    X("models;", "\xE2\x8A\xA7") \
+    X("mopf;", "\xF0\x9D\x95\x9E") \
+    X("mp;", "\xE2\x88\x93") \
+    X("mscr;", "\xF0\x9D\x93\x82") \
+    X("mstpos;", "\xE2\x88\xBE") \
+    X("mu;", "\xCE\xBC") \
+    X("multimap;", "\xE2\x8A\xB8") \
+    X("mumap;", "\xE2\x8A\xB8") \
+    X("nGg;", "\xE2\x8B\x99\xCC\xB8") \
+    X("nGt;", "\xE2\x89\xAB\xE2\x83\x92") \
+    X("nGtv;", "\xE2\x89\xAB\xCC\xB8") \
+    X("nLeftarrow;", "\xE2\x87\x8D") \
+    X("nLeftrightarrow;", "\xE2\x87\x8E") \
+    X("nLl;", "\xE2\x8B\x98\xCC\xB8") \
+    X("nLt;", "\xE2\x89\xAA\xE2\x83\x92") \
+    X("nLtv;", "\xE2\x89\xAA\xCC\xB8") \
+    X("nRightarrow;", "\xE2\x87\x8F") \
+    X("nVDash;", "\xE2\x8A\xAF") \
+    X("nVdash;", "\xE2\x8A\xAE") \
+    X("nabla;", "\xE2\x88\x87") \
+    X("nacute;", "\xC5\x84") \
+    X("nang;", "\xE2\x88\xA0\xE2\x83\x92") \
+    X("nap;", "\xE2\x89\x89") \
+    X("napE;", "\xE2\xA9\xB0\xCC\xB8") \
+    X("napid;", "\xE2\x89\x8B\xCC\xB8") \
+    X("napos;", "\xC5\x89") \
+    X("napprox;", "\xE2\x89\x89") \
+    X("natur;", "\xE2\x99\xAE") \
+    X("natural;", "\xE2\x99\xAE") \
+    X("naturals;", "\xE2\x84\x95") \
+    X("nbsp", "\xC2\xA0") \
+    X("nbsp;", "\xC2\xA0") \
+    X("nbump;", "\xE2\x89\x8E\xCC\xB8") \
+    X("nbumpe;", "\xE2\x89\x8F\xCC\xB8") \
+    X("ncap;", "\xE2\xA9\x83") \
+    X("ncaron;", "\xC5\x88") \
+    X("ncedil;", "\xC5\x86") \
+    X("ncong;", "\xE2\x89\x87") \
+    X("ncongdot;", "\xE2\xA9\xAD\xCC\xB8") \
+    X("ncup;", "\xE2\xA9\x82") \
+    X("ncy;", "\xD0\xBD") \
+    X("ndash;", "\xE2\x80\x93") \
+    X("ne;", "\xE2\x89\xA0") \
+    X("neArr;", "\xE2\x87\x97") \
+    X("nearhk;", "\xE2\xA4\xA4") \
+    X("nearr;", "\xE2\x86\x97") \
+    X("nearrow;", "\xE2\x86\x97") \
+    X("nedot;", "\xE2\x89\x90\xCC\xB8") \
+    X("nequiv;", "\xE2\x89\xA2") \
+    X("nesear;", "\xE2\xA4\xA8") \
+    X("nesim;", "\xE2\x89\x82\xCC\xB8") \
+    X("nexist;", "\xE2\x88\x84") \
+    X("nexists;", "\xE2\x88\x84") \
+    X("nfr;", "\xF0\x9D\x94\xAB") \
+    X("ngE;", "\xE2\x89\xA7\xCC\xB8") \
+    X("nge;", "\xE2\x89\xB1") \
+    X("ngeq;", "\xE2\x89\xB1") \
+    X("ngeqq;", "\xE2\x89\xA7\xCC\xB8") \
+    X("ngeqslant;", "\xE2\xA9\xBE\xCC\xB8") \
+    X("nges;", "\xE2\xA9\xBE\xCC\xB8") \
+    X("ngsim;", "\xE2\x89\xB5") \
+    X("ngt;", "\xE2\x89\xAF") \
+    X("ngtr;", "\xE2\x89\xAF") \
+    X("nhArr;", "\xE2\x87\x8E") \
+    X("nharr;", "\xE2\x86\xAE") \
+    X("nhpar;", "\xE2\xAB\xB2") \
+    X("ni;", "\xE2\x88\x8B") \
+    X("nis;", "\xE2\x8B\xBC") \
+    X("nisd;", "\xE2\x8B\xBA") \
+    X("niv;", "\xE2\x88\x8B") \
+    X("njcy;", "\xD1\x9A") \
+    X("nlArr;", "\xE2\x87\x8D") \
+    X("nlE;", "\xE2\x89\xA6\xCC\xB8") \
+    X("nlarr;", "\xE2\x86\x9A") \
+    X("nldr;", "\xE2\x80\xA5") \
+    X("nle;", "\xE2\x89\xB0") \
+    X("nleftarrow;", "\xE2\x86\x9A") \
+    X("nleftrightarrow;", "\xE2\x86\xAE") \
+    X("nleq;", "\xE2\x89\xB0") \
+    X("nleqq;", "\xE2\x89\xA6\xCC\xB8") \
+    X("nleqslant;", "\xE2\xA9\xBD\xCC\xB8") \
+    X("nles;", "\xE2\xA9\xBD\xCC\xB8") \
+    X("nless;", "\xE2\x89\xAE") \
+    X("nlsim;", "\xE2\x89\xB4") \
+    X("nlt;", "\xE2\x89\xAE") \
+    X("nltri;", "\xE2\x8B\xAA") \
+    X("nltrie;", "\xE2\x8B\xAC") \
+    X("nmid;", "\xE2\x88\xA4") \
+    X("nopf;", "\xF0\x9D\x95\x9F") \
+    X("not", "\xC2\xAC") \
+    X("not;", "\xC2\xAC") \
+    X("notin;", "\xE2\x88\x89") \
+    X("notinE;", "\xE2\x8B\xB9\xCC\xB8") \
+    X("notindot;", "\xE2\x8B\xB5\xCC\xB8") \
+    X("notinva;", "\xE2\x88\x89") \
+    X("notinvb;", "\xE2\x8B\xB7") \
+    X("notinvc;", "\xE2\x8B\xB6") \
+    X("notni;", "\xE2\x88\x8C") \
+    X("notniva;", "\xE2\x88\x8C") \
+    X("notnivb;", "\xE2\x8B\xBE") \
+    X("notnivc;", "\xE2\x8B\xBD") \
+    X("npar;", "\xE2\x88\xA6") \
+    X("nparallel;", "\xE2\x88\xA6") \
+    X("nparsl;", "\xE2\xAB\xBD\xE2\x83\xA5") \
+    X("npart;", "\xE2\x88\x82\xCC\xB8") \
+    X("npolint;", "\xE2\xA8\x94") \
+    X("npr;", "\xE2\x8A\x80") \
+    X("nprcue;", "\xE2\x8B\xA0") \
+    X("npre;", "\xE2\xAA\xAF\xCC\xB8") \
+    X("nprec;", "\xE2\x8A\x80") \
+    X("npreceq;", "\xE2\xAA\xAF\xCC\xB8") \
+    X("nrArr;", "\xE2\x87\x8F") \
+    X("nrarr;", "\xE2\x86\x9B") \
+    X("nrarrc;", "\xE2\xA4\xB3\xCC\xB8") \
+    X("nrarrw;", "\xE2\x86\x9D\xCC\xB8") \
+    X("nrightarrow;", "\xE2\x86\x9B") \
+    X("nrtri;", "\xE2\x8B\xAB") \
+    X("nrtrie;", "\xE2\x8B\xAD") \
+    X("nsc;", "\xE2\x8A\x81") \
+    X("nsccue;", "\xE2\x8B\xA1") \
+    X("nsce;", "\xE2\xAA\xB0\xCC\xB8") \
+    X("nscr;", "\xF0\x9D\x93\x83") \
+    X("nshortmid;", "\xE2\x88\xA4") \
+    X("nshortparallel;", "\xE2\x88\xA6") \
+    X("nsim;", "\xE2\x89\x81") \
+    X("nsime;", "\xE2\x89\x84") \
+    X("nsimeq;", "\xE2\x89\x84") \
+    X("nsmid;", "\xE2\x88\xA4") \
+    X("nspar;", "\xE2\x88\xA6") \
+    X("nsqsube;", "\xE2\x8B\xA2") \
+    X("nsqsupe;", "\xE2\x8B\xA3") \
+    X("nsub;", "\xE2\x8A\x84") \
+    X("nsubE;", "\xE2\xAB\x85\xCC\xB8") \
+    X("nsube;", "\xE2\x8A\x88") \
+    X("nsubset;", "\xE2\x8A\x82\xE2\x83\x92") \
+    X("nsubseteq;", "\xE2\x8A\x88") \
+    X("nsubseteqq;", "\xE2\xAB\x85\xCC\xB8") \
+    X("nsucc;", "\xE2\x8A\x81") \
+    X("nsucceq;", "\xE2\xAA\xB0\xCC\xB8") \
+    X("nsup;", "\xE2\x8A\x85") \
+    X("nsupE;", "\xE2\xAB\x86\xCC\xB8") \
+    X("nsupe;", "\xE2\x8A\x89") \
+    X("nsupset;", "\xE2\x8A\x83\xE2\x83\x92") \
+    X("nsupseteq;", "\xE2\x8A\x89") \
+    X("nsupseteqq;", "\xE2\xAB\x86\xCC\xB8") \
+    X("ntgl;", "\xE2\x89\xB9") \
+    X("ntilde", "\xC3\xB1") \
+    X("ntilde;", "\xC3\xB1") \
+    X("ntlg;", "\xE2\x89\xB8") \
+    X("ntriangleleft;", "\xE2\x8B\xAA") \
+    X("ntrianglelefteq;", "\xE2\x8B\xAC") \
+    X("ntriangleright;", "\xE2\x8B\xAB") \
+    X("ntrianglerighteq;", "\xE2\x8B\xAD") \
+    X("nu;", "\xCE\xBD") \
+    X("num;", "\x23") \
+    X("numero;", "\xE2\x84\x96") \
+    X("numsp;", "\xE2\x80\x87") \
+    X("nvDash;", "\xE2\x8A\xAD") \
+    X("nvHarr;", "\xE2\xA4\x84") \
+    X("nvap;", "\xE2\x89\x8D\xE2\x83\x92") \
+    X("nvdash;", "\xE2\x8A\xAC") \
+    X("nvge;", "\xE2\x89\xA5\xE2\x83\x92") \
+    X("nvgt;", "\x3E\xE2\x83\x92") \
+    X("nvinfin;", "\xE2\xA7\x9E") \
+    X("nvlArr;", "\xE2\xA4\x82") \
+    X("nvle;", "\xE2\x89\xA4\xE2\x83\x92") \
+    X("nvlt;", "\x3C\xE2\x83\x92") \
+    X("nvltrie;", "\xE2\x8A\xB4\xE2\x83\x92") \
+    X("nvrArr;", "\xE2\xA4\x83") \
+    X("nvrtrie;", "\xE2\x8A\xB5\xE2\x83\x92") \
+    X("nvsim;", "\xE2\x88\xBC\xE2\x83\x92") \
+    X("nwArr;", "\xE2\x87\x96") \
+    X("nwarhk;", "\xE2\xA4\xA3") \
+    X("nwarr;", "\xE2\x86\x96") \
+    X("nwarrow;", "\xE2\x86\x96") \
+    X("nwnear;", "\xE2\xA4\xA7") \
+    X("oS;", "\xE2\x93\x88") \
+    X("oacute", "\xC3\xB3") \
+    X("oacute;", "\xC3\xB3") \
+    X("oast;", "\xE2\x8A\x9B") \
+    X("ocir;", "\xE2\x8A\x9A") \
+    X("ocirc", "\xC3\xB4") \
+    X("ocirc;", "\xC3\xB4") \
+    X("ocy;", "\xD0\xBE") \
+    X("odash;", "\xE2\x8A\x9D") \
+    X("odblac;", "\xC5\x91") \
+    X("odiv;", "\xE2\xA8\xB8") \
+    X("odot;", "\xE2\x8A\x99") \
+    X("odsold;", "\xE2\xA6\xBC") \
+    X("oelig;", "\xC5\x93") \
+    X("ofcir;", "\xE2\xA6\xBF") \
+    X("ofr;", "\xF0\x9D\x94\xAC") \
+    X("ogon;", "\xCB\x9B") \
+    X("ograve", "\xC3\xB2") \
+    X("ograve;", "\xC3\xB2") \
+    X("ogt;", "\xE2\xA7\x81") \
+    X("ohbar;", "\xE2\xA6\xB5") \
+    X("ohm;", "\xCE\xA9") \
+    X("oint;", "\xE2\x88\xAE") \
+    X("olarr;", "\xE2\x86\xBA") \
+    X("olcir;", "\xE2\xA6\xBE") \
+    X("olcross;", "\xE2\xA6\xBB") \
+    X("oline;", "\xE2\x80\xBE") \
+    X("olt;", "\xE2\xA7\x80") \
+    X("omacr;", "\xC5\x8D") \
+    X("omega;", "\xCF\x89") \
+    X("omicron;", "\xCE\xBF") \
+    X("omid;", "\xE2\xA6\xB6") \
+    X("ominus;", "\xE2\x8A\x96") \
+    X("oopf;", "\xF0\x9D\x95\xA0") \
+    X("opar;", "\xE2\xA6\xB7") \
+    X("operp;", "\xE2\xA6\xB9") \
+    X("oplus;", "\xE2\x8A\x95") \
+    X("or;", "\xE2\x88\xA8") \
+    X("orarr;", "\xE2\x86\xBB") \
+    X("ord;", "\xE2\xA9\x9D") \
+    X("order;", "\xE2\x84\xB4") \
+    X("orderof;", "\xE2\x84\xB4") \
+    X("ordf", "\xC2\xAA") \
+    X("ordf;", "\xC2\xAA") \
+    X("ordm", "\xC2\xBA") \
+    X("ordm;", "\xC2\xBA") \
+    X("origof;", "\xE2\x8A\xB6") \
+    X("oror;", "\xE2\xA9\x96") \
+    X("orslope;", "\xE2\xA9\x97") \
+    X("orv;", "\xE2\xA9\x9B") \
+    X("oscr;", "\xE2\x84\xB4") \
+    X("oslash", "\xC3\xB8") \
+    X("oslash;", "\xC3\xB8") \
+    X("osol;", "\xE2\x8A\x98") \
+    X("otilde", "\xC3\xB5") \
+    X("otilde;", "\xC3\xB5") \
+    X("otimes;", "\xE2\x8A\x97") \
+    X("otimesas;", "\xE2\xA8\xB6") \
+    X("ouml", "\xC3\xB6") \
+    X("ouml;", "\xC3\xB6") \
+    X("ovbar;", "\xE2\x8C\xBD") \
+    X("par;", "\xE2\x88\xA5") \
+    X("para", "\xC2\xB6") \
+    X("para;", "\xC2\xB6") \
+    X("parallel;", "\xE2\x88\xA5") \
+    X("parsim;", "\xE2\xAB\xB3") \
+    X("parsl;", "\xE2\xAB\xBD") \
+    X("part;", "\xE2\x88\x82") \
+    X("pcy;", "\xD0\xBF") \
+    X("percnt;", "\x25") \
+    X("period;", "\x2E") \
+    X("permil;", "\xE2\x80\xB0") \
+    X("perp;", "\xE2\x8A\xA5") \
+    X("pertenk;", "\xE2\x80\xB1") \
+    X("pfr;", "\xF0\x9D\x94\xAD") \
+    X("phi;", "\xCF\x86") \
+    X("phiv;", "\xCF\x95") \
+    X("phmmat;", "\xE2\x84\xB3") \
+    X("phone;", "\xE2\x98\x8E") \
+    X("pi;", "\xCF\x80") \
+    X("pitchfork;", "\xE2\x8B\x94") \
+    X("piv;", "\xCF\x96") \
+    X("planck;", "\xE2\x84\x8F") \
+    X("planckh;", "\xE2\x84\x8E") \
+    X("plankv;", "\xE2\x84\x8F") \
+    X("plus;", "\x2B") \
+    X("plusacir;", "\xE2\xA8\xA3") \
+    X("plusb;", "\xE2\x8A\x9E") \
+    X("pluscir;", "\xE2\xA8\xA2") \
+    X("plusdo;", "\xE2\x88\x94") \
+    X("plusdu;", "\xE2\xA8\xA5") \
+    X("pluse;", "\xE2\xA9\xB2") \
+    X("plusmn", "\xC2\xB1") \
+    X("plusmn;", "\xC2\xB1") \
+    X("plussim;", "\xE2\xA8\xA6") \
+    X("plustwo;", "\xE2\xA8\xA7") \
+    X("pm;", "\xC2\xB1") \
+    X("pointint;", "\xE2\xA8\x95") \
+    X("popf;", "\xF0\x9D\x95\xA1") \
+    X("pound", "\xC2\xA3") \
+    X("pound;", "\xC2\xA3") \
+    X("pr;", "\xE2\x89\xBA") \
+    X("prE;", "\xE2\xAA\xB3") \
+    X("prap;", "\xE2\xAA\xB7") \
+    X("prcue;", "\xE2\x89\xBC") \
+    X("pre;", "\xE2\xAA\xAF") \
+    X("prec;", "\xE2\x89\xBA") \
+    X("precapprox;", "\xE2\xAA\xB7") \
+    X("preccurlyeq;", "\xE2\x89\xBC") \
+    X("preceq;", "\xE2\xAA\xAF") \
+    X("precnapprox;", "\xE2\xAA\xB9") \
+    X("precneqq;", "\xE2\xAA\xB5") \
+    X("precnsim;", "\xE2\x8B\xA8") \
+    X("precsim;", "\xE2\x89\xBE") \
+    X("prime;", "\xE2\x80\xB2") \
+    X("primes;", "\xE2\x84\x99") \
+    X("prnE;", "\xE2\xAA\xB5") \
+    X("prnap;", "\xE2\xAA\xB9") \
+    X("prnsim;", "\xE2\x8B\xA8") \
+    X("prod;", "\xE2\x88\x8F") \
+    X("profalar;", "\xE2\x8C\xAE") \
+    X("profline;", "\xE2\x8C\x92") \
+    X("profsurf;", "\xE2\x8C\x93") \
+    X("prop;", "\xE2\x88\x9D") \
+    X("propto;", "\xE2\x88\x9D") \
+    X("prsim;", "\xE2\x89\xBE") \
+    X("prurel;", "\xE2\x8A\xB0") \
+    X("pscr;", "\xF0\x9D\x93\x85") \
+    X("psi;", "\xCF\x88") \
+    X("puncsp;", "\xE2\x80\x88") \
+    X("qfr;", "\xF0\x9D\x94\xAE") \
+    X("qint;", "\xE2\xA8\x8C") \
+    X("qopf;", "\xF0\x9D\x95\xA2") \
+    X("qprime;", "\xE2\x81\x97") \
+    X("qscr;", "\xF0\x9D\x93\x86") \
+    X("quaternions;", "\xE2\x84\x8D") \
+    X("quatint;", "\xE2\xA8\x96") \
+    X("quest;", "\x3F") \
+    X("questeq;", "\xE2\x89\x9F") \
+    X("quot", "\x22") \
+    X("quot;", "\x22") \
+    X("rAarr;", "\xE2\x87\x9B") \
+    X("rArr;", "\xE2\x87\x92") \
+    X("rAtail;", "\xE2\xA4\x9C") \
+    X("rBarr;", "\xE2\xA4\x8F") \
+    X("rHar;", "\xE2\xA5\xA4") \
+    X("race;", "\xE2\x88\xBD\xCC\xB1") \
+    X("racute;", "\xC5\x95") \
+    X("radic;", "\xE2\x88\x9A") \
+    X("raemptyv;", "\xE2\xA6\xB3") \
+    X("rang;", "\xE2\x9F\xA9") \
+    X("rangd;", "\xE2\xA6\x92") \
+    X("range;", "\xE2\xA6\xA5") \
+    X("rangle;", "\xE2\x9F\xA9") \
+    X("raquo", "\xC2\xBB") \
+    X("raquo;", "\xC2\xBB") \
+    X("rarr;", "\xE2\x86\x92") \
+    X("rarrap;", "\xE2\xA5\xB5") \
+    X("rarrb;", "\xE2\x87\xA5") \
+    X("rarrbfs;", "\xE2\xA4\xA0") \
+    X("rarrc;", "\xE2\xA4\xB3") \
+    X("rarrfs;", "\xE2\xA4\x9E") \
+    X("rarrhk;", "\xE2\x86\xAA") \
+    X("rarrlp;", "\xE2\x86\xAC") \
+    X("rarrpl;", "\xE2\xA5\x85") \
+    X("rarrsim;", "\xE2\xA5\xB4") \
+    X("rarrtl;", "\xE2\x86\xA3") \
+    X("rarrw;", "\xE2\x86\x9D") \
+    X("ratail;", "\xE2\xA4\x9A") \
+    X("ratio;", "\xE2\x88\xB6") \
+    X("rationals;", "\xE2\x84\x9A") \
+    X("rbarr;", "\xE2\xA4\x8D") \
+    X("rbbrk;", "\xE2\x9D\xB3") \
+    X("rbrace;", "\x7D") \
+    X("rbrack;", "\x5D") \
+    X("rbrke;", "\xE2\xA6\x8C") \
+    X("rbrksld;", "\xE2\xA6\x8E") \
+    X("rbrkslu;", "\xE2\xA6\x90") \
+    X("rcaron;", "\xC5\x99") \
+    X("rcedil;", "\xC5\x97") \
+    X("rceil;", "\xE2\x8C\x89") \
+    X("rcub;", "\x7D") \
+    X("rcy;", "\xD1\x80") \
+    X("rdca;", "\xE2\xA4\xB7") \
+    X("rdldhar;", "\xE2\xA5\xA9") \
+    X("rdquo;", "\xE2\x80\x9D") \
+    X("rdquor;", "\xE2\x80\x9D") \
+    X("rdsh;", "\xE2\x86\xB3") \
+    X("real;", "\xE2\x84\x9C") \
+    X("realine;", "\xE2\x84\x9B") \
+    X("realpart;", "\xE2\x84\x9C") \
+    X("reals;", "\xE2\x84\x9D") \
+    X("rect;", "\xE2\x96\xAD") \
+    X("reg", "\xC2\xAE") \
+    X("reg;", "\xC2\xAE") \
+    X("rfisht;", "\xE2\xA5\xBD") \
+    X("rfloor;", "\xE2\x8C\x8B") \
+    X("rfr;", "\xF0\x9D\x94\xAF") \
+    X("rhard;", "\xE2\x87\x81") \
+    X("rharu;", "\xE2\x87\x80") \
+    X("rharul;", "\xE2\xA5\xAC") \
+    X("rho;", "\xCF\x81") \
+    X("rhov;", "\xCF\xB1") \
+    X("rightarrow;", "\xE2\x86\x92") \
+    X("rightarrowtail;", "\xE2\x86\xA3") \
+    X("rightharpoondown;", "\xE2\x87\x81") \
+    X("rightharpoonup;", "\xE2\x87\x80") \
+    X("rightleftarrows;", "\xE2\x87\x84") \
+    X("rightleftharpoons;", "\xE2\x87\x8C") \
+    X("rightrightarrows;", "\xE2\x87\x89") \
+    X("rightsquigarrow;", "\xE2\x86\x9D") \
+    X("rightthreetimes;", "\xE2\x8B\x8C") \
+    X("ring;", "\xCB\x9A") \
+    X("risingdotseq;", "\xE2\x89\x93") \
+    X("rlarr;", "\xE2\x87\x84") \
+    X("rlhar;", "\xE2\x87\x8C") \
+    X("rlm;", "\xE2\x80\x8F") \
+    X("rmoust;", "\xE2\x8E\xB1") \
+    X("rmoustache;", "\xE2\x8E\xB1") \
+    X("rnmid;", "\xE2\xAB\xAE") \
+    X("roang;", "\xE2\x9F\xAD") \
+    X("roarr;", "\xE2\x87\xBE") \
+    X("robrk;", "\xE2\x9F\xA7") \
+    X("ropar;", "\xE2\xA6\x86") \
+    X("ropf;", "\xF0\x9D\x95\xA3") \
+    X("roplus;", "\xE2\xA8\xAE") \
+    X("rotimes;", "\xE2\xA8\xB5") \
+    X("rpar;", "\x29") \
+    X("rpargt;", "\xE2\xA6\x94") \
+    X("rppolint;", "\xE2\xA8\x92") \
+    X("rrarr;", "\xE2\x87\x89") \
+    X("rsaquo;", "\xE2\x80\xBA") \
+    X("rscr;", "\xF0\x9D\x93\x87") \
+    X("rsh;", "\xE2\x86\xB1") \
+    X("rsqb;", "\x5D") \
+    X("rsquo;", "\xE2\x80\x99") \
+    X("rsquor;", "\xE2\x80\x99") \
+    X("rthree;", "\xE2\x8B\x8C") \
+    X("rtimes;", "\xE2\x8B\x8A") \
+    X("rtri;", "\xE2\x96\xB9") \
+    X("rtrie;", "\xE2\x8A\xB5") \
+    X("rtrif;", "\xE2\x96\xB8") \
+    X("rtriltri;", "\xE2\xA7\x8E") \
+    X("ruluhar;", "\xE2\xA5\xA8") \
+    X("rx;", "\xE2\x84\x9E") \
+    X("sacute;", "\xC5\x9B") \
+    X("sbquo;", "\xE2\x80\x9A") \
+    X("sc;", "\xE2\x89\xBB") \
+    X("scE;", "\xE2\xAA\xB4") \
+    X("scap;", "\xE2\xAA\xB8") \
+    X("scaron;", "\xC5\xA1") \
+    X("sccue;", "\xE2\x89\xBD") \
+    X("sce;", "\xE2\xAA\xB0") \
+    X("scedil;", "\xC5\x9F") \
+    X("scirc;", "\xC5\x9D") \
+    X("scnE;", "\xE2\xAA\xB6") \
+    X("scnap;", "\xE2\xAA\xBA") \
+    X("scnsim;", "\xE2\x8B\xA9") \
+    X("scpolint;", "\xE2\xA8\x93") \
+    X("scsim;", "\xE2\x89\xBF") \
+    X("scy;", "\xD1\x81") \
+    X("sdot;", "\xE2\x8B\x85") \
+    X("sdotb;", "\xE2\x8A\xA1") \
+    X("sdote;", "\xE2\xA9\xA6") \
+    X("seArr;", "\xE2\x87\x98") \
+    X("searhk;", "\xE2\xA4\xA5") \
+    X("searr;", "\xE2\x86\x98") \
+    X("searrow;", "\xE2\x86\x98") \
+    X("sect", "\xC2\xA7") \
+    X("sect;", "\xC2\xA7") \
+    X("semi;", "\x3B") \
+    X("seswar;", "\xE2\xA4\xA9") \
+    X("setminus;", "\xE2\x88\x96") \
+    X("setmn;", "\xE2\x88\x96") \
+    X("sext;", "\xE2\x9C\xB6") \
+    X("sfr;", "\xF0\x9D\x94\xB0") \
+    X("sfrown;", "\xE2\x8C\xA2") \
+    X("sharp;", "\xE2\x99\xAF") \
+    X("shchcy;", "\xD1\x89") \
+    X("shcy;", "\xD1\x88") \
+    X("shortmid;", "\xE2\x88\xA3") \
+    X("shortparallel;", "\xE2\x88\xA5") \
+    X("shy", "\xC2\xAD") \
+    X("shy;", "\xC2\xAD") \
+    X("sigma;", "\xCF\x83") \
+    X("sigmaf;", "\xCF\x82") \
+    X("sigmav;", "\xCF\x82") \
+    X("sim;", "\xE2\x88\xBC") \
+    X("simdot;", "\xE2\xA9\xAA") \
+    X("sime;", "\xE2\x89\x83") \
+    X("simeq;", "\xE2\x89\x83") \
+    X("simg;", "\xE2\xAA\x9E") \
+    X("simgE;", "\xE2\xAA\xA0") \
+    X("siml;", "\xE2\xAA\x9D") \
+    X("simlE;", "\xE2\xAA\x9F") \
+    X("simne;", "\xE2\x89\x86") \
+    X("simplus;", "\xE2\xA8\xA4") \
+    X("simrarr;", "\xE2\xA5\xB2") \
+    X("slarr;", "\xE2\x86\x90") \
+    X("smallsetminus;", "\xE2\x88\x96") \
+    X("smashp;", "\xE2\xA8\xB3") \
+    X("smeparsl;", "\xE2\xA7\xA4") \
+    X("smid;", "\xE2\x88\xA3") \
+    X("smile;", "\xE2\x8C\xA3") \
+    X("smt;", "\xE2\xAA\xAA") \
+    X("smte;", "\xE2\xAA\xAC") \
+    X("smtes;", "\xE2\xAA\xAC\xEF\xB8\x80") \
+    X("softcy;", "\xD1\x8C") \
+    X("sol;", "\x2F") \
+    X("solb;", "\xE2\xA7\x84") \
+    X("solbar;", "\xE2\x8C\xBF") \
+    X("sopf;", "\xF0\x9D\x95\xA4") \
+    X("spades;", "\xE2\x99\xA0") \
+    X("spadesuit;", "\xE2\x99\xA0") \
+    X("spar;", "\xE2\x88\xA5") \
+    X("sqcap;", "\xE2\x8A\x93") \
+    X("sqcaps;", "\xE2\x8A\x93\xEF\xB8\x80") \
+    X("sqcup;", "\xE2\x8A\x94") \
+    X("sqcups;", "\xE2\x8A\x94\xEF\xB8\x80") \
+    X("sqsub;", "\xE2\x8A\x8F") \
+    X("sqsube;", "\xE2\x8A\x91") \
+    X("sqsubset;", "\xE2\x8A\x8F") \
+    X("sqsubseteq;", "\xE2\x8A\x91") \
+    X("sqsup;", "\xE2\x8A\x90") \
+    X("sqsupe;", "\xE2\x8A\x92") \
+    X("sqsupset;", "\xE2\x8A\x90") \
+    X("sqsupseteq;", "\xE2\x8A\x92") \
+    X("squ;", "\xE2\x96\xA1") \
+    X("square;", "\xE2\x96\xA1") \
+    X("squarf;", "\xE2\x96\xAA") \
+    X("squf;", "\xE2\x96\xAA") \
+    X("srarr;", "\xE2\x86\x92") \
+    X("sscr;", "\xF0\x9D\x93\x88") \
+    X("ssetmn;", "\xE2\x88\x96") \
+    X("ssmile;", "\xE2\x8C\xA3") \
+    X("sstarf;", "\xE2\x8B\x86") \
+    X("star;", "\xE2\x98\x86") \
+    X("starf;", "\xE2\x98\x85") \
+    X("straightepsilon;", "\xCF\xB5") \
+    X("straightphi;", "\xCF\x95") \
+    X("strns;", "\xC2\xAF") \
+    X("sub;", "\xE2\x8A\x82") \
+    X("subE;", "\xE2\xAB\x85") \
+    X("subdot;", "\xE2\xAA\xBD") \
+    X("sube;", "\xE2\x8A\x86") \
+    X("subedot;", "\xE2\xAB\x83") \
+    X("submult;", "\xE2\xAB\x81") \
+    X("subnE;", "\xE2\xAB\x8B") \
+    X("subne;", "\xE2\x8A\x8A") \
+    X("subplus;", "\xE2\xAA\xBF") \
+    X("subrarr;", "\xE2\xA5\xB9") \
+    X("subset;", "\xE2\x8A\x82") \
+    X("subseteq;", "\xE2\x8A\x86") \
+    X("subseteqq;", "\xE2\xAB\x85") \
+    X("subsetneq;", "\xE2\x8A\x8A") \
+    X("subsetneqq;", "\xE2\xAB\x8B") \
+    X("subsim;", "\xE2\xAB\x87") \
+    X("subsub;", "\xE2\xAB\x95") \
+    X("subsup;", "\xE2\xAB\x93") \
+    X("succ;", "\xE2\x89\xBB") \
+    X("succapprox;", "\xE2\xAA\xB8") \
+    X("succcurlyeq;", "\xE2\x89\xBD") \
+    X("succeq;", "\xE2\xAA\xB0") \
+    X("succnapprox;", "\xE2\xAA\xBA") \
+    X("succneqq;", "\xE2\xAA\xB6") \
+    X("succnsim;", "\xE2\x8B\xA9") \
+    X("succsim;", "\xE2\x89\xBF") \
+    X("sum;", "\xE2\x88\x91") \
+    X("sung;", "\xE2\x99\xAA") \
+    X("sup1", "\xC2\xB9") \
+    X("sup1;", "\xC2\xB9") \
+    X("sup2", "\xC2\xB2") \
+    X("sup2;", "\xC2\xB2") \
+    X("sup3", "\xC2\xB3") \
+    X("sup3;", "\xC2\xB3") \
+    X("sup;", "\xE2\x8A\x83") \
+    X("supE;", "\xE2\xAB\x86") \
+    X("supdot;", "\xE2\xAA\xBE") \
+    X("supdsub;", "\xE2\xAB\x98") \
+    X("supe;", "\xE2\x8A\x87") \
+    X("supedot;", "\xE2\xAB\x84") \
+    X("suphsol;", "\xE2\x9F\x89") \
+    X("suphsub;", "\xE2\xAB\x97") \
+    X("suplarr;", "\xE2\xA5\xBB") \
+    X("supmult;", "\xE2\xAB\x82") \
+    X("supnE;", "\xE2\xAB\x8C") \
+    X("supne;", "\xE2\x8A\x8B") \
+    X("supplus;", "\xE2\xAB\x80") \
+    X("supset;", "\xE2\x8A\x83") \
+    X("supseteq;", "\xE2\x8A\x87") \
+    X("supseteqq;", "\xE2\xAB\x86") \
+    X("supsetneq;", "\xE2\x8A\x8B") \
+    X("supsetneqq;", "\xE2\xAB\x8C") \
+    X("supsim;", "\xE2\xAB\x88") \
+    X("supsub;", "\xE2\xAB\x94") \
+    X("supsup;", "\xE2\xAB\x96") \
+    X("swArr;", "\xE2\x87\x99") \
+    X("swarhk;", "\xE2\xA4\xA6") \
+    X("swarr;", "\xE2\x86\x99") \
+    X("swarrow;", "\xE2\x86\x99") \
+    X("swnwar;", "\xE2\xA4\xAA") \
+    X("szlig", "\xC3\x9F") \
+    X("szlig;", "\xC3\x9F") \
+    X("target;", "\xE2\x8C\x96") \
+    X("tau;", "\xCF\x84") \
+    X("tbrk;", "\xE2\x8E\xB4") \
+    X("tcaron;", "\xC5\xA5") \
+    X("tcedil;", "\xC5\xA3") \
+    X("tcy;", "\xD1\x82") \
+    X("tdot;", "\xE2\x83\x9B") \
+    X("telrec;", "\xE2\x8C\x95") \
+    X("tfr;", "\xF0\x9D\x94\xB1") \
+    X("there4;", "\xE2\x88\xB4") \
+    X("therefore;", "\xE2\x88\xB4") \
+    X("theta;", "\xCE\xB8") \
+    X("thetasym;", "\xCF\x91") \
+    X("thetav;", "\xCF\x91") \
+    X("thickapprox;", "\xE2\x89\x88") \
+    X("thicksim;", "\xE2\x88\xBC") \
+    X("thinsp;", "\xE2\x80\x89") \
+    X("thkap;", "\xE2\x89\x88") \
+    X("thksim;", "\xE2\x88\xBC") \
+    X("thorn", "\xC3\xBE") \
+    X("thorn;", "\xC3\xBE") \
+    X("tilde;", "\xCB\x9C") \
+    X("times", "\xC3\x97") \
+    X("times;", "\xC3\x97") \
+    X("timesb;", "\xE2\x8A\xA0") \
+    X("timesbar;", "\xE2\xA8\xB1") \
+    X("timesd;", "\xE2\xA8\xB0") \
+    X("tint;", "\xE2\x88\xAD") \
+    X("toea;", "\xE2\xA4\xA8") \
+    X("top;", "\xE2\x8A\xA4") \
+    X("topbot;", "\xE2\x8C\xB6") \
+    X("topcir;", "\xE2\xAB\xB1") \
+    X("topf;", "\xF0\x9D\x95\xA5") \
+    X("topfork;", "\xE2\xAB\x9A") \
+    X("tosa;", "\xE2\xA4\xA9") \
+    X("tprime;", "\xE2\x80\xB4") \
+    X("trade;", "\xE2\x84\xA2") \
+    X("triangle;", "\xE2\x96\xB5") \
+    X("triangledown;", "\xE2\x96\xBF") \
+    X("triangleleft;", "\xE2\x97\x83") \
+    X("trianglelefteq;", "\xE2\x8A\xB4") \
+    X("triangleq;", "\xE2\x89\x9C") \
+    X("triangleright;", "\xE2\x96\xB9") \
+    X("trianglerighteq;", "\xE2\x8A\xB5") \
+    X("tridot;", "\xE2\x97\xAC") \
+    X("trie;", "\xE2\x89\x9C") \
+    X("triminus;", "\xE2\xA8\xBA") \
+    X("triplus;", "\xE2\xA8\xB9") \
+    X("trisb;", "\xE2\xA7\x8D") \
+    X("tritime;", "\xE2\xA8\xBB") \
+    X("trpezium;", "\xE2\x8F\xA2") \
+    X("tscr;", "\xF0\x9D\x93\x89") \
+    X("tscy;", "\xD1\x86") \
+    X("tshcy;", "\xD1\x9B") \
+    X("tstrok;", "\xC5\xA7") \
+    X("twixt;", "\xE2\x89\xAC") \
+    X("twoheadleftarrow;", "\xE2\x86\x9E") \
+    X("twoheadrightarrow;", "\xE2\x86\xA0") \
+    X("uArr;", "\xE2\x87\x91") \
+    X("uHar;", "\xE2\xA5\xA3") \
+    X("uacute", "\xC3\xBA") \
+    X("uacute;", "\xC3\xBA") \
+    X("uarr;", "\xE2\x86\x91") \
+    X("ubrcy;", "\xD1\x9E") \
+    X("ubreve;", "\xC5\xAD") \
+    X("ucirc", "\xC3\xBB") \
+    X("ucirc;", "\xC3\xBB") \
+    X("ucy;", "\xD1\x83") \
+    X("udarr;", "\xE2\x87\x85") \
+    X("udblac;", "\xC5\xB1") \
+    X("udhar;", "\xE2\xA5\xAE") \
+    X("ufisht;", "\xE2\xA5\xBE") \
+    X("ufr;", "\xF0\x9D\x94\xB2") \
+    X("ugrave", "\xC3\xB9") \
+    X("ugrave;", "\xC3\xB9") \
+    X("uharl;", "\xE2\x86\xBF") \
+    X("uharr;", "\xE2\x86\xBE") \
+    X("uhblk;", "\xE2\x96\x80") \
+    X("ulcorn;", "\xE2\x8C\x9C") \
+    X("ulcorner;", "\xE2\x8C\x9C") \
+    X("ulcrop;", "\xE2\x8C\x8F") \
+    X("ultri;", "\xE2\x97\xB8") \
+    X("umacr;", "\xC5\xAB") \
+    X("uml", "\xC2\xA8") \
+    X("uml;", "\xC2\xA8") \
+    X("uogon;", "\xC5\xB3") \
+    X("uopf;", "\xF0\x9D\x95\xA6") \
+    X("uparrow;", "\xE2\x86\x91") \
+    X("updownarrow;", "\xE2\x86\x95") \
+    X("upharpoonleft;", "\xE2\x86\xBF") \
+    X("upharpoonright;", "\xE2\x86\xBE") \
+    X("uplus;", "\xE2\x8A\x8E") \
+    X("upsi;", "\xCF\x85") \
+    X("upsih;", "\xCF\x92") \
+    X("upsilon;", "\xCF\x85") \
+    X("upuparrows;", "\xE2\x87\x88") \
+    X("urcorn;", "\xE2\x8C\x9D") \
+    X("urcorner;", "\xE2\x8C\x9D") \
+    X("urcrop;", "\xE2\x8C\x8E") \
+    X("uring;", "\xC5\xAF") \
+    X("urtri;", "\xE2\x97\xB9") \
+    X("uscr;", "\xF0\x9D\x93\x8A") \
+    X("utdot;", "\xE2\x8B\xB0") \
+    X("utilde;", "\xC5\xA9") \
+    X("utri;", "\xE2\x96\xB5") \
+    X("utrif;", "\xE2\x96\xB4") \
+    X("uuarr;", "\xE2\x87\x88") \
+    X("uuml", "\xC3\xBC") \
+    X("uuml;", "\xC3\xBC") \
+    X("uwangle;", "\xE2\xA6\xA7") \
+    X("vArr;", "\xE2\x87\x95") \
+    X("vBar;", "\xE2\xAB\xA8") \
+    X("vBarv;", "\xE2\xAB\xA9") \
+    X("vDash;", "\xE2\x8A\xA8") \
+    X("vangrt;", "\xE2\xA6\x9C") \
+    X("varepsilon;", "\xCF\xB5") \
+    X("varkappa;", "\xCF\xB0") \
+    X("varnothing;", "\xE2\x88\x85") \
+    X("varphi;", "\xCF\x95") \
+    X("varpi;", "\xCF\x96") \
+    X("varpropto;", "\xE2\x88\x9D") \
+    X("varr;", "\xE2\x86\x95") \
+    X("varrho;", "\xCF\xB1") \
+    X("varsigma;", "\xCF\x82") \
+    X("varsubsetneq;", "\xE2\x8A\x8A\xEF\xB8\x80") \
+    X("varsubsetneqq;", "\xE2\xAB\x8B\xEF\xB8\x80") \
+    X("varsupsetneq;", "\xE2\x8A\x8B\xEF\xB8\x80") \
+    X("varsupsetneqq;", "\xE2\xAB\x8C\xEF\xB8\x80") \
+    X("vartheta;", "\xCF\x91") \
+    X("vartriangleleft;", "\xE2\x8A\xB2") \
+    X("vartriangleright;", "\xE2\x8A\xB3") \
+    X("vcy;", "\xD0\xB2") \
+    X("vdash;", "\xE2\x8A\xA2") \
+    X("vee;", "\xE2\x88\xA8") \
+    X("veebar;", "\xE2\x8A\xBB") \
+    X("veeeq;", "\xE2\x89\x9A") \
+    X("vellip;", "\xE2\x8B\xAE") \
+    X("verbar;", "\x7C") \
+    X("vert;", "\x7C") \
+    X("vfr;", "\xF0\x9D\x94\xB3") \
+    X("vltri;", "\xE2\x8A\xB2") \
+    X("vnsub;", "\xE2\x8A\x82\xE2\x83\x92") \
+    X("vnsup;", "\xE2\x8A\x83\xE2\x83\x92") \
+    X("vopf;", "\xF0\x9D\x95\xA7") \
+    X("vprop;", "\xE2\x88\x9D") \
+    X("vrtri;", "\xE2\x8A\xB3") \
+    X("vscr;", "\xF0\x9D\x93\x8B") \
+    X("vsubnE;", "\xE2\xAB\x8B\xEF\xB8\x80") \
+    X("vsubne;", "\xE2\x8A\x8A\xEF\xB8\x80") \
+    X("vsupnE;", "\xE2\xAB\x8C\xEF\xB8\x80") \
+    X("vsupne;", "\xE2\x8A\x8B\xEF\xB8\x80") \
+    X("vzigzag;", "\xE2\xA6\x9A") \
+    X("wcirc;", "\xC5\xB5") \
+    X("wedbar;", "\xE2\xA9\x9F") \
+    X("wedge;", "\xE2\x88\xA7") \
+    X("wedgeq;", "\xE2\x89\x99") \
+    X("weierp;", "\xE2\x84\x98") \
+    X("wfr;", "\xF0\x9D\x94\xB4") \
+    X("wopf;", "\xF0\x9D\x95\xA8") \
+    X("wp;", "\xE2\x84\x98") \
+    X("wr;", "\xE2\x89\x80") \
+    X("wreath;", "\xE2\x89\x80") \
+    X("wscr;", "\xF0\x9D\x93\x8C") \
+    X("xcap;", "\xE2\x8B\x82") \
+    X("xcirc;", "\xE2\x97\xAF") \
+    X("xcup;", "\xE2\x8B\x83") \
+    X("xdtri;", "\xE2\x96\xBD") \
+    X("xfr;", "\xF0\x9D\x94\xB5") \
+    X("xhArr;", "\xE2\x9F\xBA") \
+    X("xharr;", "\xE2\x9F\xB7") \
+    X("xi;", "\xCE\xBE") \
+    X("xlArr;", "\xE2\x9F\xB8") \
+    X("xlarr;", "\xE2\x9F\xB5") \
+    X("xmap;", "\xE2\x9F\xBC") \
+    X("xnis;", "\xE2\x8B\xBB") \
+    X("xodot;", "\xE2\xA8\x80") \
+    X("xopf;", "\xF0\x9D\x95\xA9") \
+    X("xoplus;", "\xE2\xA8\x81") \
+    X("xotime;", "\xE2\xA8\x82") \
+    X("xrArr;", "\xE2\x9F\xB9") \
+    X("xrarr;", "\xE2\x9F\xB6") \
+    X("xscr;", "\xF0\x9D\x93\x8D") \
+    X("xsqcup;", "\xE2\xA8\x86") \
+    X("xuplus;", "\xE2\xA8\x84") \
+    X("xutri;", "\xE2\x96\xB3") \
+    X("xvee;", "\xE2\x8B\x81") \
+    X("xwedge;", "\xE2\x8B\x80") \
+    X("yacute", "\xC3\xBD") \
+    X("yacute;", "\xC3\xBD") \
+    X("yacy;", "\xD1\x8F") \
+    X("ycirc;", "\xC5\xB7") \
+    X("ycy;", "\xD1\x8B") \
+    X("yen", "\xC2\xA5") \
+    X("yen;", "\xC2\xA5") \
+    X("yfr;", "\xF0\x9D\x94\xB6") \
+    X("yicy;", "\xD1\x97") \
+    X("yopf;", "\xF0\x9D\x95\xAA") \
+    X("yscr;", "\xF0\x9D\x93\x8E") \
+    X("yucy;", "\xD1\x8E") \
+    X("yuml", "\xC3\xBF") \
+    X("yuml;", "\xC3\xBF") \
+    X("zacute;", "\xC5\xBA") \
+    X("zcaron;", "\xC5\xBE") \
+    X("zcy;", "\xD0\xB7") \
+    X("zdot;", "\xC5\xBC") \
+    X("zeetrf;", "\xE2\x84\xA8") \
+    X("zeta;", "\xCE\xB6") \
+    X("zfr;", "\xF0\x9D\x94\xB7") \
+    X("zhcy;", "\xD0\xB6") \
+    X("zigrarr;", "\xE2\x87\x9D") \
+    X("zopf;", "\xF0\x9D\x95\xAB") \
+    X("zscr;", "\xF0\x9D\x93\x8F") \
+    X("zwj;", "\xE2\x80\x8D") \
+    X("zwnj;", "\xE2\x80\x8C")
@@ -0,0 +1,164 @@
+#include "incremental_tokenizer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../util/simd_scan.h"
+
+/// @brief Sink that records tokens into the current segment so that they
+/// outlive the tokenizer's buffers.
+struct IncrementalTokenizer::Recorder {
+    Segment* segment;
+    std::string_view document;
+
+    std::uint32_t relative(std::uint32_t offset) const
+    {
+        return offset - static_cast<std::uint32_t>(segment->offset);
+    }
+
+    TagView keep(const TagView& tag)
+    {
+        // Unknown names belong to the tokenizer, values live in its attribute
+        // buffer until the next tag.
+        TagView copy = tag;
+        copy.offset = relative(tag.offset);
+        if (tag.id == TagId::Unknown) {
+            copy.name = segment->storage.copy(tag.name);
+        }
+        if (!tag.attributes.empty()) {
+            auto* attributes = segment->storage.allocate_array<AttributeView>(tag.attributes.size());
+            for (std::size_t i = 0; i < tag.attributes.size(); i++) {
+                const auto& attr = tag.attributes[i];
+                auto name = attr.id == AttrId::Unknown ? segment->storage.copy(attr.name) : attr.name;
+                new (&attributes[i]) AttributeView { attr.id, name, segment->storage.copy(attr.value) };
+            }
+            copy.attributes = { attributes, tag.attributes.size() };
+        }
+        return copy;
+    }
+
+    void on_start_tag(const TagView& tag) { segment->tokens.push_back(TokenView::new_tag(keep(tag))); }
+    void on_end_tag(const TagView& tag) { segment->tokens.push_back(TokenView::new_tag(keep(tag))); }
+    void on_text(std::string_view text, std::uint32_t offset)
+    {
+        // Text runs are slices of the document, except for the characters of
+        // a character reference.
+        if (text.data() == document.data() + offset) {
+            auto token = TokenView::new_text_run(text, relative(offset));
+            token.ch = kDocumentSlice;
+            segment->tokens.push_back(token);
+            return;
+        }
+        segment->tokens.push_back(TokenView::new_text_run(segment->storage.copy(text), relative(offset)));
+    }
+    void on_char(char ch, std::uint32_t offset) { segment->tokens.push_back(TokenView::new_char(ch, relative(offset))); }
+    void on_eof()
+    {
+        segment->tokens.push_back(TokenView::new_eof(relative(static_cast<std::uint32_t>(document.size()))));
+    }
+    void on_parse_error(ParseError error)
+    {
+        error.offset = relative(error.offset);
+        segment->errors.emplace_back(segment->tokens.size(), error);
+    }
+};
+
+IncrementalTokenizer::IncrementalTokenizer(std::string document,
+    std::size_t checkpoint_interval, TextMode text_mode, Engine engine)
+    : checkpoint_interval_(std::max<std::size_t>(checkpoint_interval, 1))
+    , text_mode_(text_mode)
+    , engine_(engine)
+    , last_tokenized_bytes_(0)
+{
+    // An empty document with no tokens yet, not even the end of file, which
+    // the first edit fills in like any other.
+    segments_.push_back(std::make_unique<Segment>());
+    edit(0, 0, document);
+}
+
+void IncrementalTokenizer::edit(std::size_t begin, std::size_t end, std::string_view replacement)
+{
+    constexpr SimdScan::Needles kCheckpointNeedles { '<' };
+
+    end = std::min(end, document_.size());
+    begin = std::min(begin, end);
+
+    // Resume from the last checkpoint before the edit. Its state only depends
+    // on the bytes before it, and its '<' is kept, so the text before it still
+    // ends there. The start of the document is always a valid one.
+    std::size_t resume = 0;
+    while (resume + 1 < segments_.size() && segments_[resume + 1]->offset < begin) {
+        resume++;
+    }
+    // Checkpoints at or after the end of the edit are where the tokenizer may
+    // line up with the previous run.
+    auto sync = resume + 1;
+    while (sync < segments_.size() && segments_[sync]->offset < end) {
+        sync++;
+    }
+
+    // Moves the rest of the document, see the class comment.
+    document_.replace(begin, end - begin, replacement);
+    auto delta = static_cast<std::ptrdiff_t>(replacement.size()) - static_cast<std::ptrdiff_t>(end - begin);
+    auto edited_end = begin + replacement.size();
+    auto shifted = [delta](std::size_t offset) { return static_cast<std::size_t>(offset + delta); };
+
+    // Pause at a '<' every interval within the edit, and at the old
+    // checkpoints after it.
+    auto next_pause = [&](std::size_t pos) {
+        if (pos < edited_end) {
+            auto seam = SimdScan::find_any(document_, pos + checkpoint_interval_, kCheckpointNeedles);
+            if (seam < edited_end) {
+                return seam;
+            }
+        }
+        while (sync < segments_.size() && shifted(segments_[sync]->offset) <= pos) {
+            sync++;
+        }
+        return sync < segments_.size() ? shifted(segments_[sync]->offset) : document_.size();
+    };
+
+    std::vector<std::unique_ptr<Segment>> segments;
+    segments.push_back(std::make_unique<Segment>());
+    segments.back()->offset = segments_[resume]->offset;
+    Recorder recorder { segments.back().get(), document_ };
+    auto pause = next_pause(segments.back()->offset);
+    Tokenizer tokenizer(document_, segments.back()->offset, pause, text_mode_, engine_);
+    bool synced = false;
+    while (true) {
+        tokenizer.run(recorder);
+        if (pause == document_.size()) {
+            break;
+        }
+        if (tokenizer.at_data_boundary()) {
+            if (sync < segments_.size() && pause == shifted(segments_[sync]->offset)) {
+                synced = true;
+                break;
+            }
+            segments.push_back(std::make_unique<Segment>());
+            segments.back()->offset = pause;
+            recorder.segment = segments.back().get();
+        }
+        pause = next_pause(pause);
+        tokenizer.extend_input(pause, pause == document_.size());
+    }
+    last_tokenized_bytes_ = pause - segments.front()->offset;
+
+    // Replace the segments between the two checkpoints. The ones after them
+    // only move, each by rewriting its offset.
+    auto old_end = synced ? sync : segments_.size();
+    for (auto i = old_end; i < segments_.size(); i++) {
+        segments_[i]->offset = shifted(segments_[i]->offset);
+    }
+    segments_.erase(segments_.begin() + resume, segments_.begin() + old_end);
+    segments_.insert(segments_.begin() + resume, std::make_move_iterator(segments.begin()),
+        std::make_move_iterator(segments.end()));
+}
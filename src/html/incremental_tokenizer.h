@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../util/arena.h"
+#include "parse_error.h"
+#include "token.h"
+#include "tokenizer.h"
+
+/// @brief Keeps the tokens of a document up to date as it is edited.
+///
+/// While tokenizing, the tokenizer pauses at a '<' every `checkpoint_interval`
+/// bytes or so. Wherever it is then in the data state with nothing held back,
+/// its state is fully described by the offset, so that is a checkpoint. The
+/// tokens are recorded in one segment per checkpoint, with offsets relative
+/// to it.
+///
+/// After an edit, tokenizing resumes from the last checkpoint before the
+/// edit, and pauses at the old checkpoints after it. As soon as it is at one
+/// in the data state again, the rest of the document tokenizes as it did
+/// before, so the segments from there on are kept and only their checkpoint
+/// moves. An edit then tokenizes about its own size plus a checkpoint
+/// interval, however large the document is.
+///
+/// The rest of an edit is linear in the size of the document: it is one
+/// string, so the bytes after the edit move, and checkpoints have absolute
+/// offsets, so every one after the edit shifts. That is a memmove and a
+/// pass over the checkpoints, tens of microseconds per megabyte, small next
+/// to tokenizing the whole document again but not independent of its size.
+/// Appending is an edit at the end, which moves nothing.
+class IncrementalTokenizer {
+public:
+    static constexpr std::size_t kDefaultCheckpointInterval = 4096;
+
+    explicit IncrementalTokenizer(std::string document,
+        std::size_t checkpoint_interval = kDefaultCheckpointInterval,
+        TextMode text_mode = TextMode::Run, Engine engine = Engine::Switch);
+
+    std::string_view document() const { return document_; }
+
+    /// @brief Replaces the bytes [begin, end) of the document with
+    /// `replacement` and updates the tokens.
+    void edit(std::size_t begin, std::size_t end, std::string_view replacement);
+
+    /// @brief Appends bytes to the document and updates the tokens.
+    void append(std::string_view bytes) { edit(document_.size(), document_.size(), bytes); }
+
+    /// @brief Pushes all tokens of the document into `sink`, which takes the
+    /// same handlers as for Tokenizer::run(), ending with `on_eof`. Can be
+    /// called again after every edit.
+    template <typename Sink>
+    void run(Sink& sink) const;
+
+    /// @brief Like run(sink), but reports parse errors to `errors`.
+    template <typename Sink, typename ErrorSink>
+    void run(Sink& sink, ErrorSink& errors) const;
+
+    std::size_t checkpoint_count() const { return segments_.size(); }
+
+    /// @brief Bytes the last edit, or the constructor, tokenized.
+    std::size_t last_tokenized_bytes() const { return last_tokenized_bytes_; }
+
+private:
+    /// @brief The tokens from one checkpoint up to the next.
+    struct Segment {
+        /// @brief Offset of the checkpoint, a '<' that the tokenizer reached in
+        /// the data state, or 0 for the first segment.
+        std::size_t offset = 0;
+        /// @brief Offsets are relative to `offset`. Text runs that are slices
+        /// of the document have `ch` set to kDocumentSlice and are rebased on
+        /// it when replayed, the others view `storage`, like the attributes and
+        /// unknown names of tags.
+        std::vector<TokenView> tokens;
+        /// @brief Each parse error with the number of tokens before it.
+        std::vector<std::pair<std::size_t, ParseError>> errors;
+        Arena storage;
+    };
+
+    static constexpr char kDocumentSlice = 1;
+
+    struct Recorder;
+
+    std::string document_;
+    std::size_t checkpoint_interval_;
+    TextMode text_mode_;
+    Engine engine_;
+    /// @brief Sorted by offset, never empty.
+    std::vector<std::unique_ptr<Segment>> segments_;
+    std::size_t last_tokenized_bytes_;
+};
+
+template <typename Sink>
+void IncrementalTokenizer::run(Sink& sink) const
+{
+    for (const auto& segment : segments_) {
+        auto base = static_cast<std::uint32_t>(segment->offset);
+        auto error = segment->errors.begin();
+        auto report_errors_before = [&](std::size_t index) {
+            for (; error != segment->errors.end() && error->first <= index; ++error) {
+                if constexpr (HasParseErrorHandler<Sink>::value) {
+                    auto e = error->second;
+                    e.offset += base;
+                    sink.on_parse_error(e);
+                }
+            }
+        };
+
+        for (std::size_t i = 0; i < segment->tokens.size(); i++) {
+            report_errors_before(i);
+            auto token = segment->tokens[i];
+            token.offset += base;
+            token.tag.offset += base;
+            if (token.kind == Token::Kind::TextRun && token.ch == kDocumentSlice) {
+                token.text = std::string_view(document_).substr(token.offset, token.text.size());
+            }
+            Tokenizer::deliver(sink, token);
+        }
+        report_errors_before(segment->tokens.size());
+    }
+}
+
+template <typename Sink, typename ErrorSink>
+void IncrementalTokenizer::run(Sink& sink, ErrorSink& errors) const
+{
+    Tokenizer::SplitSink<Sink, ErrorSink> split { sink, errors };
+    run(split);
+}
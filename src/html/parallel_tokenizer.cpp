@@ -0,0 +1,188 @@
+#include "parallel_tokenizer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../util/simd_scan.h"
+
+/// @brief Sink that records a chunk's tokens so that they outlive the
+/// tokenizer's buffers.
+struct ParallelTokenizer::Recorder {
+    Chunk& chunk;
+    std::string_view document;
+
+    std::string_view keep(std::string_view text)
+    {
+        // Text runs are slices of the document, except for the characters of
+        // a character reference.
+        std::less<const char*> before;
+        if (!before(text.data(), document.data())
+            && !before(document.data() + document.size(), text.data() + text.size())) {
+            return text;
+        }
+        return chunk.storage.copy(text);
+    }
+
+    TagView keep(const TagView& tag)
+    {
+        // Names are atoms or interned by the chunk's tokenizer, values live in
+        // its attribute buffer until the next tag.
+        TagView copy = tag;
+        if (!tag.attributes.empty()) {
+            auto* attributes = chunk.storage.allocate_array<AttributeView>(tag.attributes.size());
+            for (std::size_t i = 0; i < tag.attributes.size(); i++) {
+                const auto& attr = tag.attributes[i];
+                new (&attributes[i]) AttributeView { attr.id, attr.name, chunk.storage.copy(attr.value) };
+            }
+            copy.attributes = { attributes, tag.attributes.size() };
+        }
+        return copy;
+    }
+
+    void on_start_tag(const TagView& tag) { chunk.tokens.push_back(TokenView::new_tag(keep(tag))); }
+    void on_end_tag(const TagView& tag) { chunk.tokens.push_back(TokenView::new_tag(keep(tag))); }
+    void on_text(std::string_view text, std::uint32_t offset)
+    {
+        chunk.tokens.push_back(TokenView::new_text_run(keep(text), offset));
+    }
+    void on_char(char ch, std::uint32_t offset) { chunk.tokens.push_back(TokenView::new_char(ch, offset)); }
+    void on_eof() { chunk.tokens.push_back(TokenView::new_eof(static_cast<std::uint32_t>(document.size()))); }
+    void on_parse_error(ParseError error) { chunk.errors.emplace_back(chunk.tokens.size(), error); }
+};
+
+ParallelTokenizer::ParallelTokenizer(std::string_view input, std::size_t threads,
+    std::size_t chunk_size, TextMode text_mode, Engine engine)
+    : input_(input)
+    , thread_count_(threads != 0 ? threads : std::max(std::thread::hardware_concurrency(), 1u))
+    , text_mode_(text_mode)
+    , engine_(engine)
+    , chunk_count_(0)
+    , retokenized_chunks_(0)
+    , next_chunk_(0)
+    , released_chunks_(0)
+    , window_(2 * thread_count_)
+{
+    // Every chunk but the first starts at the first '<' after the nominal
+    // chunk size, so that no text run crosses a seam.
+    constexpr SimdScan::Needles kSeamNeedles { '<' };
+    std::vector<std::size_t> seams { 0 };
+    if (thread_count_ > 1) {
+        chunk_size = std::max<std::size_t>(chunk_size, 1);
+        auto pos = chunk_size;
+        while (pos < input_.size()) {
+            auto seam = SimdScan::find_any(input_, pos, kSeamNeedles);
+            if (seam >= input_.size()) {
+                break;
+            }
+            seams.push_back(seam);
+            pos = seam + chunk_size;
+        }
+    }
+
+    chunk_count_ = seams.size();
+    chunks_ = std::make_unique<Chunk[]>(chunk_count_);
+    for (std::size_t i = 0; i < chunk_count_; i++) {
+        chunks_[i].begin = seams[i];
+        chunks_[i].end = i + 1 < chunk_count_ ? seams[i + 1] : input_.size();
+    }
+}
+
+ParallelTokenizer::~ParallelTokenizer() { stop_workers(); }
+
+void ParallelTokenizer::start_workers()
+{
+    auto count = std::min(thread_count_, chunk_count_);
+    workers_.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        workers_.emplace_back([this] { work(); });
+    }
+}
+
+void ParallelTokenizer::stop_workers()
+{
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+void ParallelTokenizer::work()
+{
+    while (true) {
+        Chunk* chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            chunk_released_.wait(lock, [this] {
+                return next_chunk_ >= chunk_count_ || next_chunk_ < released_chunks_ + window_;
+            });
+            if (next_chunk_ >= chunk_count_) {
+                return;
+            }
+            chunk = &chunks_[next_chunk_++];
+        }
+
+        record(*chunk);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            chunk->done = true;
+        }
+        chunk_done_.notify_all();
+    }
+}
+
+void ParallelTokenizer::record(Chunk& chunk)
+{
+    // Only the last chunk reaches the end of the file. The others pause at
+    // their end, in whatever state they are in, for run() to check.
+    chunk.tokenizer = std::unique_ptr<Tokenizer>(
+        new Tokenizer(input_, chunk.begin, chunk.end, text_mode_, engine_));
+    Recorder recorder { chunk, input_ };
+    chunk.tokenizer->run(recorder);
+}
+
+ParallelTokenizer::Chunk& ParallelTokenizer::wait_for(std::size_t index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    chunk_done_.wait(lock, [&] { return chunks_[index].done; });
+    return chunks_[index];
+}
+
+void ParallelTokenizer::skip(std::size_t index)
+{
+    // Chunks are picked up in order and every chunk before this one has been,
+    // so this one is either being recorded already or up next. In that case,
+    // take it so that no worker starts on it.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (next_chunk_ == index) {
+        next_chunk_++;
+        chunks_[index].done = true;
+    }
+}
+
+void ParallelTokenizer::release_through(std::size_t index)
+{
+    for (auto i = released_chunks_; i <= index; i++) {
+        // A skipped chunk may still be being recorded.
+        auto& chunk = wait_for(i);
+        chunk.tokenizer.reset();
+        chunk.tokens = {};
+        chunk.errors = {};
+        chunk.storage.reset();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        released_chunks_ = index + 1;
+    }
+    chunk_released_.notify_all();
+}
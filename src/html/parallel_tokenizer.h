@@ -0,0 +1,173 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../util/arena.h"
+#include "parse_error.h"
+#include "token.h"
+#include "tokenizer.h"
+
+/// @brief Tokenizes one large document on several threads.
+///
+/// The document is cut into chunks that each start at a '<'. Worker threads
+/// tokenize the chunks speculatively, assuming each one starts in the data
+/// state, and record their tokens. run() then replays the chunks in order,
+/// checking each seam: when the tokenizer of a chunk ended in the data state
+/// with nothing held back, the speculation about the next chunk was right.
+/// Otherwise, e.g. when the seam is inside a comment or a quoted attribute
+/// value, the next chunk's recording is thrown away and the tokenizer of the
+/// chunk before it carries on through it instead.
+///
+/// The sink sees exactly the tokens and parse errors of a Tokenizer over the
+/// whole document, in the same order: a seam never splits a text run, since
+/// text ends at a '<'. Workers only run a few chunks ahead of the sink, so the
+/// recordings held at any time stay small however large the document is.
+class ParallelTokenizer {
+public:
+    static constexpr std::size_t kDefaultChunkSize = 1024 * 1024;
+
+    /// @brief `threads` of 0 uses one per hardware thread. Chunks are about
+    /// `chunk_size` bytes; documents shorter than two chunks, or a single
+    /// thread, are tokenized on the calling thread.
+    explicit ParallelTokenizer(std::string_view input, std::size_t threads = 0,
+        std::size_t chunk_size = kDefaultChunkSize, TextMode text_mode = TextMode::Run,
+        Engine engine = Engine::Switch);
+    ~ParallelTokenizer();
+
+    ParallelTokenizer(const ParallelTokenizer&) = delete;
+    ParallelTokenizer& operator=(const ParallelTokenizer&) = delete;
+
+    /// @brief Pushes all tokens of the document into `sink`, which takes the
+    /// same handlers as for Tokenizer::run(), ending with `on_eof`. Can only be
+    /// called once.
+    template <typename Sink>
+    void run(Sink& sink);
+
+    /// @brief Like run(sink), but reports parse errors to `errors`.
+    template <typename Sink, typename ErrorSink>
+    void run(Sink& sink, ErrorSink& errors);
+
+    std::size_t chunk_count() const { return chunk_count_; }
+
+    /// @brief Chunks whose speculative start was wrong, so far.
+    std::size_t retokenized_chunks() const { return retokenized_chunks_; }
+
+private:
+    /// @brief A chunk of the document and what its worker recorded for it.
+    struct Chunk {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        /// @brief Owns the names of unknown tags in `tokens`, and carries on
+        /// into the next chunks when their seam turns out to be wrong.
+        std::unique_ptr<Tokenizer> tokenizer;
+        /// @brief Text runs view the document, or `storage` when they are not
+        /// a slice of it. Tag attributes are copied into `storage`.
+        std::vector<TokenView> tokens;
+        /// @brief Each parse error with the number of tokens before it.
+        std::vector<std::pair<std::size_t, ParseError>> errors;
+        Arena storage;
+        /// @brief The recording is complete, or not needed. Guarded by
+        /// `mutex_`.
+        bool done = false;
+    };
+
+    struct Recorder;
+
+    std::string_view input_;
+    std::size_t thread_count_;
+    TextMode text_mode_;
+    Engine engine_;
+    std::unique_ptr<Chunk[]> chunks_;
+    std::size_t chunk_count_;
+    std::size_t retokenized_chunks_;
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    /// @brief Signaled when a chunk is done.
+    std::condition_variable chunk_done_;
+    /// @brief Signaled when run() is done with a chunk, letting the workers
+    /// start on another one.
+    std::condition_variable chunk_released_;
+    /// @brief The next chunk a worker picks up, and the first chunk run() has
+    /// not released yet. Guarded by `mutex_`.
+    std::size_t next_chunk_;
+    std::size_t released_chunks_;
+    /// @brief How far ahead of run() the workers may get, in chunks.
+    std::size_t window_;
+
+    void start_workers();
+    void stop_workers();
+    void work();
+    void record(Chunk& chunk);
+    Chunk& wait_for(std::size_t index);
+    void skip(std::size_t index);
+    void release_through(std::size_t index);
+
+    template <typename Sink>
+    void replay(const Chunk& chunk, Sink& sink);
+};
+
+template <typename Sink>
+void ParallelTokenizer::replay(const Chunk& chunk, Sink& sink)
+{
+    auto error = chunk.errors.begin();
+    auto report_errors_before = [&](std::size_t index) {
+        for (; error != chunk.errors.end() && error->first <= index; ++error) {
+            if constexpr (HasParseErrorHandler<Sink>::value) {
+                sink.on_parse_error(error->second);
+            }
+        }
+    };
+
+    for (std::size_t i = 0; i < chunk.tokens.size(); i++) {
+        report_errors_before(i);
+        Tokenizer::deliver(sink, chunk.tokens[i]);
+    }
+    report_errors_before(chunk.tokens.size());
+}
+
+template <typename Sink>
+void ParallelTokenizer::run(Sink& sink)
+{
+    if (chunk_count_ == 1) {
+        Tokenizer tokenizer(input_, text_mode_, engine_);
+        tokenizer.run(sink);
+        return;
+    }
+
+    start_workers();
+    std::size_t index = 0;
+    while (index < chunk_count_) {
+        auto& chunk = wait_for(index);
+        replay(chunk, sink);
+
+        auto next = index + 1;
+        while (next < chunk_count_ && !chunk.tokenizer->at_data_boundary()) {
+            // The next chunk does not start in the data state, so its
+            // recording is wrong. Tokenize it from where this one stopped.
+            skip(next);
+            retokenized_chunks_++;
+            chunk.tokenizer->extend_input(chunks_[next].end, next + 1 == chunk_count_);
+            chunk.tokenizer->run(sink);
+            next++;
+        }
+
+        release_through(next - 1);
+        index = next;
+    }
+    stop_workers();
+}
+
+template <typename Sink, typename ErrorSink>
+void ParallelTokenizer::run(Sink& sink, ErrorSink& errors)
+{
+    Tokenizer::SplitSink<Sink, ErrorSink> split { sink, errors };
+    run(split);
+}
@@ -0,0 +1,16 @@
+#include "parse_error.h"
+
+#include <fmt/format.h>
+
+#include <string>
+
+std::string to_string(const ParseError& error)
+{
+    return fmt::format("{} at offset {}", name_of(error.code), error.offset);
+}
+
+std::string to_string(const ParseError& error, const LineIndex& lines)
+{
+    auto position = lines.position(error.offset);
+    return fmt::format("{} at {}:{}", name_of(error.code), position.line, position.column);
+}
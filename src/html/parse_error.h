@@ -0,0 +1,165 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../util/line_index.h"
+
+/// @brief The parse errors the tokenizer reports, as X(Ident, "code").
+/// https://html.spec.whatwg.org/multipage/parsing.html#parse-errors
+#define EVEN_HTML_PARSE_ERRORS(X)                                                     \
+    X(AbsenceOfDigitsInNumericCharacterReference,                                     \
+        "absence-of-digits-in-numeric-character-reference")                           \
+    X(CharacterReferenceOutsideUnicodeRange,                                          \
+        "character-reference-outside-unicode-range")                                  \
+    X(ControlCharacterReference, "control-character-reference")                       \
+    X(EofBeforeTagName, "eof-before-tag-name")                                        \
+    X(EofInComment, "eof-in-comment")                                                 \
+    X(EofInTag, "eof-in-tag")                                                         \
+    X(InvalidFirstCharacterOfTagName, "invalid-first-character-of-tag-name")          \
+    X(MissingAttributeValue, "missing-attribute-value")                               \
+    X(MissingEndTagName, "missing-end-tag-name")                                      \
+    X(MissingSemicolonAfterCharacterReference,                                        \
+        "missing-semicolon-after-character-reference")                                \
+    X(MissingWhitespaceBetweenAttributes, "missing-whitespace-between-attributes")    \
+    X(NoncharacterCharacterReference, "noncharacter-character-reference")             \
+    X(NullCharacterReference, "null-character-reference")                             \
+    X(SurrogateCharacterReference, "surrogate-character-reference")                   \
+    X(UnexpectedCharacterInAttributeName, "unexpected-character-in-attribute-name")   \
+    X(UnexpectedCharacterInUnquotedAttributeValue,                                    \
+        "unexpected-character-in-unquoted-attribute-value")                           \
+    X(UnexpectedEqualsSignBeforeAttributeName,                                        \
+        "unexpected-equals-sign-before-attribute-name")                               \
+    X(UnexpectedNullCharacter, "unexpected-null-character")                           \
+    X(UnexpectedQuestionMarkInsteadOfTagName,                                         \
+        "unexpected-question-mark-instead-of-tag-name")                               \
+    X(UnexpectedSolidusInTag, "unexpected-solidus-in-tag")                            \
+    X(UnknownNamedCharacterReference, "unknown-named-character-reference")
+
+enum class ParseErrorCode : std::uint8_t {
+    /// @brief No error. Only used by tables.
+    None = 0,
+#define EVEN_X(ident, code) ident,
+    EVEN_HTML_PARSE_ERRORS(EVEN_X)
+#undef EVEN_X
+};
+
+constexpr std::size_t kParseErrorCodeCount = 0
+#define EVEN_X(ident, code) +1
+    EVEN_HTML_PARSE_ERRORS(EVEN_X)
+#undef EVEN_X
+    + 1;
+
+/// @brief The spec's code for `code`, e.g. "eof-in-tag".
+constexpr std::string_view name_of(ParseErrorCode code)
+{
+    constexpr std::string_view names[] = {
+        "none",
+#define EVEN_X(ident, code) code,
+        EVEN_HTML_PARSE_ERRORS(EVEN_X)
+#undef EVEN_X
+    };
+    return names[static_cast<std::size_t>(code)];
+}
+
+/// @brief A parse error and the byte offset in the document where it was
+/// detected.
+struct ParseError {
+    ParseErrorCode code;
+    std::uint32_t offset;
+
+    bool operator==(const ParseError& other) const
+    {
+        return code == other.code && offset == other.offset;
+    }
+};
+
+/// @brief A human-readable description, e.g. "eof-in-tag at offset 12".
+std::string to_string(const ParseError& error);
+
+/// @brief Same as to_string(error), with a line and column from `lines`,
+/// e.g. "eof-in-tag at 3:7".
+std::string to_string(const ParseError& error, const LineIndex& lines);
+
+// Error sinks. A token sink may handle parse errors itself by providing
+//     void on_parse_error(ParseError error);
+// or they can be sent to a separate error sink, see Tokenizer::run().
+
+/// @brief Drops every parse error. Reporting compiles away entirely.
+struct NullErrorSink {
+    void on_parse_error(ParseError) { }
+};
+
+/// @brief Counts parse errors per code, for metrics.
+class CountingErrorSink {
+private:
+    std::array<std::size_t, kParseErrorCodeCount> counts_ {};
+    std::size_t total_ = 0;
+
+public:
+    void on_parse_error(ParseError error)
+    {
+        counts_[static_cast<std::size_t>(error.code)]++;
+        total_++;
+    }
+
+    std::size_t count(ParseErrorCode code) const { return counts_[static_cast<std::size_t>(code)]; }
+    std::size_t total() const { return total_; }
+};
+
+/// @brief Records parse errors into storage reserved up front.
+/// Once full, further errors are only counted, so recording never allocates.
+class ParseErrorBuffer {
+private:
+    std::vector<ParseError> errors_;
+    std::size_t capacity_;
+    std::size_t dropped_ = 0;
+
+public:
+    static constexpr std::size_t kDefaultCapacity = 256;
+
+    explicit ParseErrorBuffer(std::size_t capacity = kDefaultCapacity)
+        : capacity_(capacity)
+    {
+        errors_.reserve(capacity);
+    }
+
+    void on_parse_error(ParseError error)
+    {
+        if (errors_.size() < capacity_) {
+            errors_.push_back(error);
+        } else {
+            dropped_++;
+        }
+    }
+
+    std::size_t size() const { return errors_.size(); }
+    bool empty() const { return errors_.empty(); }
+    const ParseError& operator[](std::size_t i) const { return errors_[i]; }
+    auto begin() const { return errors_.begin(); }
+    auto end() const { return errors_.end(); }
+
+    /// @brief Errors that did not fit.
+    std::size_t dropped() const { return dropped_; }
+
+    void clear()
+    {
+        errors_.clear();
+        dropped_ = 0;
+    }
+};
+
+/// @brief Whether `Sink` provides on_parse_error().
+template <typename Sink, typename = void>
+struct HasParseErrorHandler : std::false_type { };
+
+template <typename Sink>
+struct HasParseErrorHandler<Sink,
+    std::void_t<decltype(std::declval<Sink&>().on_parse_error(std::declval<ParseError>()))>>
+    : std::true_type { };
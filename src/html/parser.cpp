@@ -1 +1,192 @@
-#include "parser.h"
\ No newline at end of file
+#include "parser.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../dom/element.h"
+#include "../dom/text.h"
+#include "../util/thread_pool.h"
+#include "preprocessor.h"
+#include "tokenizer.h"
+
+namespace {
+
+/// @brief Preprocesses `input` into the buffer the document keeps as its
+/// source: `owner`, the buffer `input` views, when nothing changed, else a
+/// copy of the result.
+std::shared_ptr<const std::string> preprocess(InputPreprocessor& preprocessor, std::string_view input,
+    std::shared_ptr<const std::string> owner)
+{
+    auto chunk = preprocessor.process(input, true);
+    if (owner && chunk.text.data() == input.data()) {
+        return owner;
+    }
+    return std::make_shared<const std::string>(chunk.text);
+}
+
+/// @brief What a batch worker reuses from one document to the next.
+struct Workspace {
+    InputPreprocessor preprocessor;
+    Tokenizer tokenizer;
+
+    std::unique_ptr<Document> parse(std::string_view input)
+    {
+        auto document = std::make_unique<Document>();
+        // A document takes a few times as many bytes as its source, so start
+        // with a block about that size rather than growing into it.
+        document->arena().reserve(input.size() * 4);
+        preprocessor.reset();
+        document->set_source(preprocess(preprocessor, input, nullptr));
+        HTMLParser parser(*document);
+        tokenizer.reset(document->source());
+        tokenizer.run(parser);
+        return document;
+    }
+};
+
+} // namespace
+
+bool is_void_element(TagId id)
+{
+    switch (id) {
+    case TagId::Area:
+    case TagId::Base:
+    case TagId::Basefont:
+    case TagId::Bgsound:
+    case TagId::Br:
+    case TagId::Col:
+    case TagId::Embed:
+    case TagId::Frame:
+    case TagId::Hr:
+    case TagId::Img:
+    case TagId::Input:
+    case TagId::Keygen:
+    case TagId::Link:
+    case TagId::Meta:
+    case TagId::Param:
+    case TagId::Source:
+    case TagId::Track:
+    case TagId::Wbr:
+        return true;
+    default:
+        return false;
+    }
+}
+
+HTMLParser::HTMLParser(Document& document)
+    : document_(document)
+    , open_elements_ { &document }
+    , done_(false)
+{
+}
+
+std::unique_ptr<Document> HTMLParser::parse(std::string_view input)
+{
+    InputPreprocessor preprocessor;
+    return parse_source(preprocess(preprocessor, input, nullptr));
+}
+
+std::unique_ptr<Document> HTMLParser::parse(std::shared_ptr<const std::string> input)
+{
+    InputPreprocessor preprocessor;
+    return parse_source(preprocess(preprocessor, *input, input));
+}
+
+std::unique_ptr<Document> HTMLParser::parse_source(std::shared_ptr<const std::string> source)
+{
+    auto document = std::make_unique<Document>();
+    document->set_source(std::move(source));
+    HTMLParser parser(*document);
+    Tokenizer tokenizer(document->source());
+    tokenizer.run(parser);
+    return document;
+}
+
+std::vector<std::unique_ptr<Document>> HTMLParser::parse_batch(
+    const std::vector<std::string_view>& inputs, ThreadPool& pool)
+{
+    std::vector<std::unique_ptr<Document>> documents(inputs.size());
+    parse_batch(inputs, pool, [&](std::size_t index, std::unique_ptr<Document> document) {
+        documents[index] = std::move(document);
+    });
+    return documents;
+}
+
+void HTMLParser::parse_batch(const std::vector<std::string_view>& inputs, ThreadPool& pool,
+    const ParsedCallback& on_parsed)
+{
+    std::vector<Workspace> workspaces(pool.thread_count());
+    pool.for_each_index(inputs.size(), [&](std::size_t index, std::size_t worker) {
+        on_parsed(index, workspaces[worker].parse(inputs[index]));
+    });
+}
+
+void HTMLParser::insert_text(std::string_view data, std::uint32_t offset)
+{
+    auto& parent = current_node();
+    auto* last = parent.last_child();
+    if (last && last->node_type() == Node::Type::TEXT_NODE) {
+        static_cast<Text*>(last)->append_data(data);
+        return;
+    }
+
+    auto* text = document_.create_text_node(data);
+    text->set_source_offset(offset);
+    parent.append_child(text);
+}
+
+void HTMLParser::on_start_tag(const TagView& tag)
+{
+    // The tokenizer already looked the names up.
+    auto* element = document_.create_element(tag.id, tag.name, static_cast<std::uint32_t>(tag.attributes.size()));
+    element->set_source_offset(tag.offset);
+    for (const auto& attr : tag.attributes) {
+        element->append_attribute(attr.id, attr.name, attr.value);
+    }
+
+    current_node().append_child(element);
+
+    if (!tag.self_closing && !is_void_element(tag.id)) {
+        open_elements_.push_back(element);
+    }
+}
+
+void HTMLParser::on_end_tag(const TagView& tag)
+{
+    // Pop up to and including the nearest open element with the same name, and
+    // ignore the tag if there is none.
+    for (auto i = open_elements_.size(); i-- > 1;) {
+        auto* element = static_cast<Element*>(open_elements_[i]);
+        if (element->tag_id() == tag.id && (tag.id != TagId::Unknown || element->local_name() == tag.name)) {
+            open_elements_.resize(i);
+            return;
+        }
+    }
+}
+
+void HTMLParser::on_text(std::string_view text, std::uint32_t offset)
+{
+    insert_text(text, offset);
+}
+
+void HTMLParser::on_char(char ch, std::uint32_t offset)
+{
+    // The character is usually the one at `offset` in the source, which
+    // lets the Text node go on referring to the source.
+    auto source = document_.source();
+    if (offset < source.size() && source[offset] == ch) {
+        insert_text(source.substr(offset, 1), offset);
+        return;
+    }
+    insert_text(std::string_view(&ch, 1), offset);
+}
+
+void HTMLParser::on_eof()
+{
+    open_elements_.resize(1);
+    done_ = true;
+}
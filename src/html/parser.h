@@ -1,6 +1,76 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../dom/document.h"
+#include "token.h"
+
+class ThreadPool;
+
+/// @brief https://html.spec.whatwg.org/multipage/syntax.html#void-elements
+/// plus the obsolete ones the parser treats the same way.
+bool is_void_element(TagId id);
+
+/// @brief HTML tree builder
+///
+/// https://html.spec.whatwg.org/multipage/parsing.html#tree-construction
+///
+/// A tokenizer sink: Tokenizer::run() pushes tokens straight into it. For now
+/// it only nests elements. Start tags open an element unless it is void or
+/// self-closing. End tags close up to the matching open element. Text is
+/// appended to a neighbouring Text node when there is one. Insertion modes
+/// are not implemented.
 class HTMLParser {
 private:
+    Document& document_;
+    /// @brief https://html.spec.whatwg.org/multipage/parsing.html#stack-of-open-elements
+    /// The document itself sits at the bottom.
+    std::vector<Node*> open_elements_;
+    bool done_;
+
+    Node& current_node() { return *open_elements_.back(); }
+    void insert_text(std::string_view data, std::uint32_t offset);
+    /// @brief Parses `source`, already preprocessed, into a document that
+    /// keeps it.
+    static std::unique_ptr<Document> parse_source(std::shared_ptr<const std::string> source);
+
 public:
-};
\ No newline at end of file
+    explicit HTMLParser(Document& document);
+
+    /// @brief Parses a complete document, preprocessing it first.
+    /// The document keeps a copy of the preprocessed input as its source.
+    static std::unique_ptr<Document> parse(std::string_view input);
+    /// @brief Like parse(std::string_view), but the document shares `input`
+    /// as its source instead of copying it, unless preprocessing changes it.
+    static std::unique_ptr<Document> parse(std::shared_ptr<const std::string> input);
+
+    using ParsedCallback = std::function<void(std::size_t index, std::unique_ptr<Document> document)>;
+
+    /// @brief Parses many complete documents on `pool`, each like parse().
+    /// Each worker keeps one tokenizer and preprocessor for every document it
+    /// parses, so their buffers are only grown once per thread.
+    /// @return The documents in the order of `inputs`.
+    static std::vector<std::unique_ptr<Document>> parse_batch(
+        const std::vector<std::string_view>& inputs, ThreadPool& pool);
+
+    /// @brief Like parse_batch(inputs, pool), but hands every document to
+    /// `on_parsed` with its index as soon as it is done, on the worker thread
+    /// that parsed it, so possibly on several threads at once.
+    static void parse_batch(const std::vector<std::string_view>& inputs, ThreadPool& pool,
+        const ParsedCallback& on_parsed);
+
+    /// @brief Whether the end-of-file token has been seen.
+    bool done() const { return done_; }
+
+    void on_start_tag(const TagView& tag);
+    void on_end_tag(const TagView& tag);
+    void on_text(std::string_view text, std::uint32_t offset);
+    void on_char(char ch, std::uint32_t offset);
+    void on_eof();
+};
@@ -0,0 +1,252 @@
+#include "preprocessor.h"
+
+#include <cstring>
+#include <string_view>
+
+#include "../util/char_util.h"
+#include "../util/simd_scan.h"
+
+std::size_t InputPreprocessor::valid_utf8_prefix(std::string_view input)
+{
+    constexpr std::uint64_t highs = 0x8080808080808080ull;
+    auto data = reinterpret_cast<const unsigned char*>(input.data());
+    std::size_t size = input.size();
+    std::size_t pos = 0;
+
+    while (pos < size) {
+        // Most non-ASCII text still has long ASCII stretches, e.g. markup.
+        if (pos + 8 <= size) {
+            std::uint64_t x;
+            std::memcpy(&x, data + pos, sizeof(x));
+            if ((x & highs) == 0) {
+                pos += 8;
+                continue;
+            }
+        }
+
+        auto b = data[pos];
+        if (b < 0x80) {
+            pos++;
+            continue;
+        }
+
+        // https://encoding.spec.whatwg.org/#utf-8-decoder
+        std::size_t needed;
+        unsigned char lower = 0x80;
+        unsigned char upper = 0xBF;
+        if (b >= 0xC2 && b <= 0xDF) {
+            needed = 1;
+        } else if (b >= 0xE0 && b <= 0xEF) {
+            lower = b == 0xE0 ? 0xA0 : 0x80;
+            upper = b == 0xED ? 0x9F : 0xBF;
+            needed = 2;
+        } else if (b >= 0xF0 && b <= 0xF4) {
+            lower = b == 0xF0 ? 0x90 : 0x80;
+            upper = b == 0xF4 ? 0x8F : 0xBF;
+            needed = 3;
+        } else {
+            return pos;
+        }
+
+        if (pos + needed >= size || data[pos + 1] < lower || data[pos + 1] > upper) {
+            return pos;
+        }
+        for (std::size_t i = 2; i <= needed; i++) {
+            if (data[pos + i] < 0x80 || data[pos + i] > 0xBF) {
+                return pos;
+            }
+        }
+        pos += needed + 1;
+    }
+    return pos;
+}
+
+InputPreprocessor::InputPreprocessor()
+    : pending_ {}
+    , pending_size_(0)
+    , bytes_needed_(0)
+    , lower_boundary_(0x80)
+    , upper_boundary_(0xBF)
+    , after_cr_(false)
+{
+}
+
+void InputPreprocessor::reset()
+{
+    pending_size_ = 0;
+    bytes_needed_ = 0;
+    lower_boundary_ = 0x80;
+    upper_boundary_ = 0xBF;
+    after_cr_ = false;
+}
+
+InputPreprocessor::Chunk InputPreprocessor::process(std::string_view chunk, bool last)
+{
+    Chunk result;
+    auto summary = SimdScan::summarize(chunk);
+
+    if (pending_size_ == 0 && !summary.carriage_return) {
+        // An LF right after a CR that ended the previous chunk has already
+        // been emitted as that CR, so drop it, which needs no copy either.
+        if (after_cr_ && !chunk.empty() && chunk[0] == '\n') {
+            chunk.remove_prefix(1);
+            after_cr_ = false;
+        }
+        if (!chunk.empty()) {
+            after_cr_ = false;
+        }
+
+        if (!summary.non_ascii) {
+            result.text = chunk;
+            return result;
+        }
+
+        auto valid = valid_utf8_prefix(chunk);
+        if (valid == chunk.size()) {
+            result.text = chunk;
+            return result;
+        }
+
+        // A sequence cut off by the end of the chunk is the usual reason to
+        // stop early. Hold it back and still return the rest as is.
+        if (!last && chunk.size() - valid < 4) {
+            out_.clear();
+            rewrite(chunk.substr(valid), false, false);
+            if (out_.empty()) {
+                result.text = chunk.substr(0, valid);
+                return result;
+            }
+            pending_size_ = 0;
+            bytes_needed_ = 0;
+            lower_boundary_ = 0x80;
+            upper_boundary_ = 0xBF;
+        }
+    }
+
+    out_.clear();
+    rewrite(chunk, !summary.non_ascii, last);
+    result.text = out_;
+    return result;
+}
+
+void InputPreprocessor::append_ascii(char ch)
+{
+    if (ch == '\r') {
+        // Replace every U+000D CARRIAGE RETURN (CR) code point that is not
+        // followed by a U+000A LINE FEED (LF) code point with a single LF, and
+        // normalize CR LF pairs to a single LF.
+        out_.push_back('\n');
+        after_cr_ = true;
+        return;
+    }
+    if (ch == '\n' && after_cr_) {
+        after_cr_ = false;
+        return;
+    }
+    after_cr_ = false;
+    out_.push_back(ch);
+}
+
+void InputPreprocessor::append_replacement()
+{
+    out_.append(CharUtil::kReplacementCharacter);
+    after_cr_ = false;
+}
+
+void InputPreprocessor::rewrite(std::string_view chunk, bool ascii, bool last)
+{
+    // https://encoding.spec.whatwg.org/#utf-8-decoder
+    constexpr SimdScan::Needles kCarriageReturn { '\r' };
+    std::size_t pos = 0;
+    while (pos < chunk.size()) {
+        auto b = static_cast<unsigned char>(chunk[pos]);
+
+        if (bytes_needed_ == 0) {
+            if (b < 0x80) {
+                // Copy the ASCII up to the next byte that needs a decision in
+                // one go; CR LF documents take this path for every chunk.
+                std::size_t end;
+                if (ascii) {
+                    end = SimdScan::find_any(chunk, pos + 1, kCarriageReturn);
+                } else {
+                    end = pos + 1;
+                    while (end < chunk.size() && static_cast<unsigned char>(chunk[end]) < 0x80
+                        && chunk[end] != '\r') {
+                        end++;
+                    }
+                }
+                append_ascii(chunk[pos++]);
+                if (pos < end && after_cr_ && chunk[pos] == '\n') {
+                    append_ascii(chunk[pos++]);
+                }
+                if (pos < end) {
+                    out_.append(chunk.substr(pos, end - pos));
+                    after_cr_ = false;
+                }
+                pos = end;
+                continue;
+            }
+
+            if (b >= 0xC2 && b <= 0xDF) {
+                bytes_needed_ = 1;
+            } else if (b >= 0xE0 && b <= 0xEF) {
+                if (b == 0xE0) {
+                    lower_boundary_ = 0xA0;
+                }
+                if (b == 0xED) {
+                    upper_boundary_ = 0x9F;
+                }
+                bytes_needed_ = 2;
+            } else if (b >= 0xF0 && b <= 0xF4) {
+                if (b == 0xF0) {
+                    lower_boundary_ = 0x90;
+                }
+                if (b == 0xF4) {
+                    upper_boundary_ = 0x8F;
+                }
+                bytes_needed_ = 3;
+            } else {
+                append_replacement();
+                pos++;
+                continue;
+            }
+            pending_[0] = static_cast<char>(b);
+            pending_size_ = 1;
+            pos++;
+            continue;
+        }
+
+        if (b < lower_boundary_ || b > upper_boundary_) {
+            // Set UTF-8 code point, UTF-8 bytes needed, and UTF-8 bytes seen
+            // to 0, set UTF-8 lower boundary to 0x80, and set UTF-8 upper
+            // boundary to 0xBF. Restore byte to ioQueue. Return error.
+            bytes_needed_ = 0;
+            pending_size_ = 0;
+            lower_boundary_ = 0x80;
+            upper_boundary_ = 0xBF;
+            append_replacement();
+            continue;
+        }
+
+        lower_boundary_ = 0x80;
+        upper_boundary_ = 0xBF;
+        pending_[pending_size_++] = static_cast<char>(b);
+        pos++;
+        if (pending_size_ == bytes_needed_ + 1) {
+            out_.append(pending_, pending_size_);
+            after_cr_ = false;
+            bytes_needed_ = 0;
+            pending_size_ = 0;
+        }
+    }
+
+    if (last && bytes_needed_ != 0) {
+        // If byte is end-of-queue and UTF-8 bytes needed is not 0, set UTF-8
+        // bytes needed to 0 and return error.
+        bytes_needed_ = 0;
+        pending_size_ = 0;
+        lower_boundary_ = 0x80;
+        upper_boundary_ = 0xBF;
+        append_replacement();
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/// @brief Input stream preprocessing, run on the bytes of each chunk before
+/// the tokenizer sees them.
+///
+/// https://html.spec.whatwg.org/multipage/parsing.html#preprocessing-the-input-stream
+///
+/// Decodes UTF-8 the way https://encoding.spec.whatwg.org/#utf-8-decoder does,
+/// replacing every invalid sequence (including encoded surrogates) with
+/// U+FFFD, and normalizes CR LF and lone CR to LF. A chunk is first summarized
+/// in one SIMD pass; chunks that are valid and contain no CR, which is almost
+/// all of them, are returned as they are without being copied. Only the rest
+/// are rewritten.
+///
+/// NUL is left to the tokenizer, which handles it per state as the spec
+/// says. It needs no flag or slow path here: the tokenizer's bulk scans
+/// stop at NUL among up to four needles they compare against anyway, so a
+/// chunk without NULs already costs nothing extra.
+///
+/// Token offsets count bytes of the preprocessed stream.
+class InputPreprocessor {
+public:
+    /// @brief A preprocessed chunk.
+    struct Chunk {
+        /// @brief The chunk itself when it needed no changes, else a view of
+        /// the preprocessor's buffer. Valid until the next call.
+        std::string_view text;
+
+        /// @brief Whether `text` is a view of the input chunk.
+        bool passed_through(std::string_view input) const
+        {
+            return text.data() == input.data() || text.empty();
+        }
+    };
+
+    InputPreprocessor();
+
+    /// @brief Preprocesses the next chunk. A UTF-8 sequence cut off at the end
+    /// of the chunk is held back until the next one, unless `last` is set, in
+    /// which case it is replaced like any other invalid sequence.
+    Chunk process(std::string_view chunk, bool last = false);
+
+    /// @brief Ends the stream, returning what was still held back.
+    Chunk finish() { return process({}, true); }
+
+    /// @brief Starts over on another stream, keeping the buffer.
+    void reset();
+
+    /// @brief Length of the longest prefix of `input` made of complete, valid
+    /// UTF-8 sequences.
+    static std::size_t valid_utf8_prefix(std::string_view input);
+
+private:
+    /// @brief Decodes `chunk` into `out_`, continuing from the held back
+    /// sequence if there is one. `ascii` tells that the chunk has no byte
+    /// above 0x7F, so that it only has to look for CRs.
+    void rewrite(std::string_view chunk, bool ascii, bool last);
+    void append_ascii(char ch);
+    void append_replacement();
+
+    std::string out_;
+    /// @brief The UTF-8 sequence being decoded: its bytes so far, how many
+    /// more it needs, and the range the next one must be in.
+    char pending_[4];
+    std::size_t pending_size_;
+    std::size_t bytes_needed_;
+    std::uint8_t lower_boundary_;
+    std::uint8_t upper_boundary_;
+    /// @brief The last character was a CR, so an LF right after it belongs to
+    /// the same newline.
+    bool after_cr_;
+};
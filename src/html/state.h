@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <string_view>
+
 enum class State {
     Data,
     TagOpen,
@@ -15,4 +18,42 @@ enum class State {
     AfterAttributeValueQuoted,
     SelfClosingStartTag,
     Comment,
-};
\ No newline at end of file
+    AmbiguousAmpersand,
+    NumericCharacterReference,
+    HexadecimalCharacterReferenceStart,
+    DecimalCharacterReferenceStart,
+    HexadecimalCharacterReference,
+    DecimalCharacterReference,
+};
+
+/// @brief Number of states, for tables indexed by State.
+constexpr std::size_t kStateCount = static_cast<std::size_t>(State::DecimalCharacterReference) + 1;
+
+/// @brief A name for `state` after the spec's, e.g. "tag-open".
+constexpr std::string_view name_of(State state)
+{
+    constexpr std::string_view names[] = {
+        "data",
+        "tag-open",
+        "end-tag-open",
+        "tag-name",
+        "before-attribute-name",
+        "attribute-name",
+        "after-attribute-name",
+        "before-attribute-value",
+        "attribute-value-unquoted",
+        "attribute-value-double-quoted",
+        "attribute-value-single-quoted",
+        "after-attribute-value-quoted",
+        "self-closing-start-tag",
+        "comment",
+        "ambiguous-ampersand",
+        "numeric-character-reference",
+        "hexadecimal-character-reference-start",
+        "decimal-character-reference-start",
+        "hexadecimal-character-reference",
+        "decimal-character-reference",
+    };
+    static_assert(sizeof(names) / sizeof(names[0]) == kStateCount);
+    return names[static_cast<std::size_t>(state)];
+}
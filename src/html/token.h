@@ -1,16 +1,26 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
+#include "atoms.h"
+
 struct Attribute {
-    std::string name;
+    /// @brief `AttrId::Unknown` unless the name is in the atom table.
+    AttrId id;
+    /// @brief Points into the atom table, or into the tokenizer's interner for
+    /// unknown names.
+    std::string_view name;
     std::string value;
 
-    Attribute(std::string name, std::string value)
-        : name(name)
-        , value(value)
+    Attribute(AttrId id, std::string_view name, std::string value)
+        : id(id)
+        , name(name)
+        , value(std::move(value))
     {
     }
 };
@@ -18,7 +28,11 @@ struct Attribute {
 struct TokenTag {
     enum class Kind { Start,
         End } kind;
-    std::string name;
+    /// @brief `TagId::Unknown` unless the name is in the atom table.
+    TagId id = TagId::Unknown;
+    /// @brief Points into the atom table, or into the tokenizer's interner for
+    /// unknown names.
+    std::string_view name;
     bool self_closing = false;
     std::vector<Attribute> attributes;
 
@@ -28,12 +42,13 @@ struct TokenTag {
     {
     }
 
-    TokenTag(Kind kind, std::string name, bool self_closing,
+    TokenTag(Kind kind, TagId id, std::string_view name, bool self_closing,
         std::vector<Attribute> attributes)
         : kind(kind)
+        , id(id)
         , name(name)
         , self_closing(self_closing)
-        , attributes(attributes)
+        , attributes(std::move(attributes))
     {
     }
 };
@@ -43,6 +58,7 @@ struct Token {
         StartTag,
         EndTag,
         Character,
+        TextRun,
         EndOfFile,
     } kind;
 
@@ -58,10 +74,18 @@ struct Token {
         char value;
     };
 
+    /// @brief A run of consecutive character tokens.
+    /// The value is a slice of the tokenizer input, not a copy.
+    struct TextRun {
+        std::string_view value;
+    };
+
     struct EndOfFile { };
 
-    using Data = std::variant<StartTag, EndTag, Character, EndOfFile>;
+    using Data = std::variant<StartTag, EndTag, Character, TextRun, EndOfFile>;
     Data data;
+    /// @brief Byte offset in the document where the token starts.
+    std::uint32_t offset = 0;
 
     static Token new_start(TokenTag t)
     {
@@ -78,5 +102,126 @@ struct Token {
         return { Token::Kind::Character, Character { c } };
     }
 
+    static Token new_text_run(std::string_view value)
+    {
+        return { Token::Kind::TextRun, TextRun { value } };
+    }
+
     static Token new_eof() { return { Token::Kind::EndOfFile, EndOfFile {} }; }
+};
+
+/// @brief An attribute borrowed from the tokenizer.
+struct AttributeView {
+    AttrId id;
+    std::string_view name;
+    std::string_view value;
+};
+
+/// @brief The attributes of a borrowed tag.
+struct AttributeViews {
+    const AttributeView* data = nullptr;
+    std::size_t count = 0;
+
+    const AttributeView* begin() const { return data; }
+    const AttributeView* end() const { return data + count; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const AttributeView& operator[](std::size_t i) const { return data[i]; }
+};
+
+/// @brief A tag borrowed from the tokenizer.
+struct TagView {
+    TokenTag::Kind kind = TokenTag::Kind::Start;
+    TagId id = TagId::Unknown;
+    std::string_view name;
+    bool self_closing = false;
+    AttributeViews attributes;
+    /// @brief Byte offset in the document of the tag's '<'.
+    std::uint32_t offset = 0;
+};
+
+/// @brief A token borrowed from the tokenizer.
+/// Unlike Token, it owns nothing: its views point into the tokenizer's
+/// buffers and stay valid until the tokenizer is advanced again. Only the
+/// member matching `kind` is meaningful.
+struct TokenView {
+    Token::Kind kind = Token::Kind::EndOfFile;
+    /// @brief StartTag and EndTag
+    TagView tag;
+    /// @brief TextRun
+    std::string_view text;
+    /// @brief Character
+    char ch = 0;
+    /// @brief Byte offset in the document where the token starts.
+    std::uint32_t offset = 0;
+
+    static TokenView new_tag(TagView t)
+    {
+        TokenView view;
+        view.kind = t.kind == TokenTag::Kind::Start ? Token::Kind::StartTag
+                                                    : Token::Kind::EndTag;
+        view.tag = t;
+        view.offset = t.offset;
+        return view;
+    }
+
+    static TokenView new_char(char c, std::uint32_t offset)
+    {
+        TokenView view;
+        view.kind = Token::Kind::Character;
+        view.ch = c;
+        view.offset = offset;
+        return view;
+    }
+
+    static TokenView new_text_run(std::string_view value, std::uint32_t offset)
+    {
+        TokenView view;
+        view.kind = Token::Kind::TextRun;
+        view.text = value;
+        view.offset = offset;
+        return view;
+    }
+
+    static TokenView new_eof(std::uint32_t offset)
+    {
+        TokenView view;
+        view.offset = offset;
+        return view;
+    }
+
+    /// @brief Copies the borrowed attribute values into an owned Token.
+    /// Names and text runs keep pointing at the same storage as before.
+    Token to_token() const
+    {
+        auto token = to_token_data();
+        token.offset = offset;
+        return token;
+    }
+
+private:
+    Token to_token_data() const
+    {
+        switch (kind) {
+        case Token::Kind::StartTag:
+        case Token::Kind::EndTag: {
+            std::vector<Attribute> attributes;
+            attributes.reserve(tag.attributes.size());
+            for (const auto& attr : tag.attributes) {
+                attributes.emplace_back(attr.id, attr.name, std::string(attr.value));
+            }
+            TokenTag t(tag.kind, tag.id, tag.name, tag.self_closing,
+                std::move(attributes));
+            return kind == Token::Kind::StartTag ? Token::new_start(std::move(t))
+                                                 : Token::new_end(std::move(t));
+        }
+        case Token::Kind::Character:
+            return Token::new_char(ch);
+        case Token::Kind::TextRun:
+            return Token::new_text_run(text);
+        case Token::Kind::EndOfFile:
+            break;
+        }
+        return Token::new_eof();
+    }
 };
\ No newline at end of file
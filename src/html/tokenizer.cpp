@@ -1,590 +1,506 @@
 #include "tokenizer.h"
 
 #include <fmt/base.h>
+#include <fmt/format.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
 #include "../util/char_util.h"
+#include "../util/simd_scan.h"
+#include "entities.h"
 #include "state.h"
 #include "token.h"
 
-void print_parse_error(std::string_view msg)
+namespace {
+
+bool same_token(const TokenView& a, const TokenView& b)
+{
+    if (a.kind != b.kind) {
+        return false;
+    }
+
+    switch (a.kind) {
+    case Token::Kind::StartTag:
+    case Token::Kind::EndTag:
+        if (a.tag.id != b.tag.id || a.tag.name != b.tag.name || a.offset != b.offset
+            || a.tag.self_closing != b.tag.self_closing
+            || a.tag.attributes.size() != b.tag.attributes.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.tag.attributes.size(); i++) {
+            const auto& x = a.tag.attributes[i];
+            const auto& y = b.tag.attributes[i];
+            if (x.id != y.id || x.name != y.name || x.value != y.value) {
+                return false;
+            }
+        }
+        return true;
+    case Token::Kind::Character:
+        return a.ch == b.ch && a.offset == b.offset;
+    case Token::Kind::TextRun:
+        return a.text == b.text && a.offset == b.offset;
+    case Token::Kind::EndOfFile:
+        return true;
+    }
+    return false;
+}
+
+std::string describe_token(const TokenView& token)
 {
-    fmt::println("[HTML Tokenizer] parser error: {}", msg);
+    switch (token.kind) {
+    case Token::Kind::StartTag:
+        return fmt::format("<{}> with {} attributes", token.tag.name,
+            token.tag.attributes.size());
+    case Token::Kind::EndTag:
+        return fmt::format("</{}>", token.tag.name);
+    case Token::Kind::Character:
+        return fmt::format("character '{}'", token.ch);
+    case Token::Kind::TextRun:
+        return fmt::format("text \"{}\"", token.text);
+    case Token::Kind::EndOfFile:
+        break;
+    }
+    return "EOF";
 }
 
-Tokenizer::Tokenizer(std::string_view input)
+} // namespace
+
+// Characters that end a bulk span in the states that consume input in bulk.
+// Everything else in those states is handled by the "anything else" entry.
+// The kernels compare against all four needles either way, so stopping at NUL
+// as well costs nothing on input that has none. Policies that do not handle
+// NUL take it as anything else.
+template <typename Policy>
+constexpr SimdScan::Needles kDataNeedles = Policy::kHandleNul
+    ? SimdScan::Needles { '<', '&', '\0' }
+    : SimdScan::Needles { '<', '&' };
+template <typename Policy>
+constexpr SimdScan::Needles kDoubleQuotedNeedles = Policy::kHandleNul
+    ? SimdScan::Needles { '"', '&', '\0' }
+    : SimdScan::Needles { '"', '&' };
+template <typename Policy>
+constexpr SimdScan::Needles kSingleQuotedNeedles = Policy::kHandleNul
+    ? SimdScan::Needles { '\'', '&', '\0' }
+    : SimdScan::Needles { '\'', '&' };
+template <typename Policy>
+constexpr SimdScan::Needles kCommentNeedles = Policy::kHandleNul
+    ? SimdScan::Needles { '>', '\0' }
+    : SimdScan::Needles { '>' };
+
+// A single step reports at most a couple of errors.
+constexpr std::size_t kVerifiedErrorCapacity = 16;
+
+template <typename Policy>
+BasicTokenizer<Policy>::BasicTokenizer(std::string_view input, TextMode text_mode, Engine engine)
     : input_(input)
+    , finished_(true)
+    , consumed_(0)
     , pos_(0)
     , reconsume_(false)
+    , tag_open_offset_(0)
     , state_(State::Data)
+    , return_state_(State::Data)
+    , text_mode_(text_mode)
+    , engine_(engine)
     , cur_tag_kind_(TokenTag::Kind::Start)
     , cur_tag_self_closing_(false)
+    , cur_attr_value_begin_(0)
+    , char_ref_offset_(0)
+    , char_ref_code_(0)
+    , char_ref_buffer_ {}
+    , char_ref_buffer_size_(0)
+    , pending_head_(0)
+    , verified_errors_(engine == Engine::Verify ? kVerifiedErrorCapacity : 0)
+    , eof_emitted_(false)
 {
+    if (engine_ == Engine::Verify) {
+        shadow_ = std::make_unique<BasicTokenizer>(input, text_mode, Engine::Switch);
+    }
 }
 
-Tokenizer::~Tokenizer() { }
+template <typename Policy>
+BasicTokenizer<Policy>::BasicTokenizer(TextMode text_mode, Engine engine)
+    : finished_(false)
+    , consumed_(0)
+    , pos_(0)
+    , reconsume_(false)
+    , tag_open_offset_(0)
+    , state_(State::Data)
+    , return_state_(State::Data)
+    , text_mode_(text_mode)
+    , engine_(engine)
+    , cur_tag_kind_(TokenTag::Kind::Start)
+    , cur_tag_self_closing_(false)
+    , cur_attr_value_begin_(0)
+    , char_ref_offset_(0)
+    , char_ref_code_(0)
+    , char_ref_buffer_ {}
+    , char_ref_buffer_size_(0)
+    , pending_head_(0)
+    , verified_errors_(engine == Engine::Verify ? kVerifiedErrorCapacity : 0)
+    , eof_emitted_(false)
+{
+    if (engine_ == Engine::Verify) {
+        shadow_ = std::make_unique<BasicTokenizer>(text_mode, Engine::Switch);
+    }
+}
 
-std::optional<char> Tokenizer::peek()
+template <typename Policy>
+BasicTokenizer<Policy>::BasicTokenizer(std::string_view document, std::size_t begin, std::size_t end,
+    TextMode text_mode, Engine engine)
+    : BasicTokenizer(document.substr(0, end), text_mode, engine)
 {
-    if (reconsume_) {
-        reconsume_ = false;
-        if (pos_ <= 0) {
-            return std::nullopt;
-        }
+    // The bytes before `begin` are never read, they only make offsets count
+    // from the start of the document.
+    pos_ = begin;
+    finished_ = end == document.size();
+    if (shadow_) {
+        shadow_->pos_ = begin;
+        shadow_->finished_ = finished_;
+    }
+}
+
+template <typename Policy>
+BasicTokenizer<Policy>::~BasicTokenizer() { }
 
-        pos_--;
+template <typename Policy>
+void BasicTokenizer<Policy>::reset(std::string_view input)
+{
+    input_ = input;
+    buffer_.clear();
+    preprocessor_.reset();
+    finished_ = true;
+    consumed_ = 0;
+    pos_ = 0;
+    reconsume_ = false;
+    tag_open_offset_ = 0;
+    state_ = State::Data;
+    return_state_ = State::Data;
+    if (interner_.size() > 0) {
+        interner_ = AtomInterner();
+    }
+    create_start_tag();
+    attr_views_.clear();
+    char_ref_offset_ = 0;
+    char_ref_code_ = 0;
+    char_ref_buffer_size_ = 0;
+    pending_tokens_.clear();
+    pending_head_ = 0;
+    verified_tokens_.clear();
+    verified_errors_.clear();
+    eof_emitted_ = false;
+    errors_.clear();
+#ifdef EVEN_TOKENIZER_STATS
+    stats_state_ = State::Data;
+#endif
+
+    if (shadow_) {
+        shadow_->reset(input);
+    }
+}
+
+template <typename Policy>
+void BasicTokenizer<Policy>::feed(std::string_view chunk)
+{
+    if (finished_) {
+        return;
+    }
+
+    // Nothing behind pos_ is ever read again: the tag and attribute being built
+    // are kept in their own buffers, so the buffer only has to hold what has not
+    // been consumed yet, and the last character when it is to be reconsumed.
+    auto keep = pos_ - (reconsume_ ? 1 : 0);
+    buffer_.erase(0, keep);
+    consumed_ += keep;
+    pos_ -= keep;
+    buffer_.append(chunk);
+    input_ = buffer_;
+
+    if (shadow_) {
+        shadow_->feed(chunk);
     }
+}
+
+template <typename Policy>
+void BasicTokenizer<Policy>::extend_input(std::size_t end, bool last)
+{
+    input_ = std::string_view(input_.data(), end);
+    finished_ = last;
 
-    if (pos_ >= input_.size()) {
+    if (shadow_) {
+        shadow_->extend_input(end, last);
+    }
+}
+
+template <typename Policy>
+void BasicTokenizer<Policy>::finish()
+{
+    // Whatever feed_raw() held back, as replacement characters.
+    auto rest = preprocessor_.finish();
+    if (!rest.text.empty()) {
+        feed(rest.text);
+    }
+    finished_ = true;
+
+    if (shadow_) {
+        shadow_->finish();
+    }
+}
+
+template <typename Policy>
+std::optional<Token> BasicTokenizer<Policy>::try_next()
+{
+    auto view = try_next_view();
+    if (!view) {
         return std::nullopt;
     }
+    return view->to_token();
+}
 
-    auto c = input_[pos_];
+template <typename Policy>
+Token BasicTokenizer<Policy>::next() { return try_next().value(); }
 
-    pos_++;
+template <typename Policy>
+TokenView BasicTokenizer<Policy>::next_view() { return try_next_view().value(); }
 
-    return c;
+template <typename Policy>
+std::optional<TokenView> BasicTokenizer<Policy>::try_next_view()
+{
+    if (pending_head_ < pending_tokens_.size()) {
+        return pending_tokens_[pending_head_++];
+    }
+
+    pending_tokens_.clear();
+    pending_head_ = 0;
+    ViewSink sink { *this, pending_tokens_, errors_ };
+    if (!step(sink)) {
+        return std::nullopt;
+    }
+#ifdef EVEN_TOKENIZER_STATS
+    stats_.pending_tokens += pending_tokens_.size() - 1;
+#endif
+    return pending_tokens_[pending_head_++];
 }
 
-Token Tokenizer::next()
+template <typename Policy>
+bool BasicTokenizer<Policy>::verify_step()
 {
-    if (!pending_tokens_.empty()) {
-        auto last = std::move(pending_tokens_.back());
-        pending_tokens_.pop_back();
-        return last;
+    verified_tokens_.clear();
+    verified_errors_.clear();
+    ViewSink sink { *this, verified_tokens_, verified_errors_ };
+    bool stepped = step_table(sink);
+
+    for (const auto& token : verified_tokens_) {
+        auto expected = shadow_->try_next_view();
+        if (!expected || !same_token(token, *expected)) {
+            fmt::println(stderr, "[HTML Tokenizer] table engine diverged at offset {}: {} (switch engine: {})",
+                pos_, describe_token(token),
+                expected ? describe_token(*expected) : "nothing");
+            std::abort();
+        }
     }
 
-    while (true) {
-        auto c = peek();
-
-        switch (state_) {
-        case State::Data:
-            // https://html.spec.whatwg.org/multipage/parsing.html#data-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                // TODO: U+0026 AMPERSAND (&)
-                // TODO: U+0000 NULL
-
-                if (ch == '<') {
-                    // U+003C LESS-THAN SIGN (<) - Switch to the tag open state.
-                    state_ = State::TagOpen;
-                } else {
-                    // Anything else
-                    // Emit the current input character as a character token.
-                    return emit_char(ch);
-                }
-            } else {
-                // EOF - Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::TagOpen:
-            // https://html.spec.whatwg.org/multipage/parsing.html#tag-open-state
-            if (c.has_value()) {
-                auto ch = c.value();
-                if (ch == '!') {
-                    // TODO: U+0021 EXCLAMATION MARK (!) - Switch to the markup
-                    // declaration open state.
-                    state_ = State::Comment;
-                } else if (ch == '/') {
-                    // U+002F SOLIDUS (/) - Switch to the end tag open state.
-                    state_ = State::EndTagOpen;
-                } else if (CharUtil::is_ascii_alpha(ch)) {
-                    // ASCII alpha
-                    // Create a new start tag token,
-                    // set its tag name to the empty string.
-                    create_start_tag();
-                    // Reconsume in the tag name state.
-                    reconsume_ = true;
-                    state_ = State::TagName;
-                } else if (ch == '?') {
-                    // TODO: U+003F QUESTION MARK (?)
-                    // This is an unexpected-question-mark-instead-of-tag-name
-                    // parse error.
-                    print_parse_error("unexpected-question-mark-instead-of-tag-name");
-                    // Create a comment token whose data is the empty string.
-                    // Reconsume in the bogus comment state.
-                    reconsume_ = true;
-                    state_ = State::Comment;
-                } else {
-                    // Anything else
-                    // This is an invalid-first-character-of-tag-name parse error.
-                    print_parse_error("invalid-first-character-of-tag-name");
-                    // Emit a U+003C LESS-THAN SIGN character token.
-                    // Reconsume in the data state.
-                    reconsume_ = true;
-                    state_ = State::Data;
-                    return emit_char('<');
-                }
-            } else {
-                // EOF
-                // This is an eof-before-tag-name parse error.
-                print_parse_error("eof-before-tag-name");
-                // Emit a U+003C LESS-THAN SIGN character token
-                // and an end-of-file token.
-                pending_tokens_.push_back(emit_eof());
-                return emit_char('<');
-            }
-            break;
-        case State::EndTagOpen:
-            // https://html.spec.whatwg.org/multipage/parsing.html#end-tag-open-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (CharUtil::is_ascii_alpha(ch)) {
-                    // ASCII alpha
-                    // Create a new end tag token, set its tag name to the empty string.
-                    create_end_tag();
-                    // Reconsume in the tag name state.
-                    reconsume_ = true;
-                    state_ = State::TagName;
-                } else if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // This is a missing-end-tag-name parse error.
-                    print_parse_error("missing-end-tag-name");
-                    // Switch to the data state.
-                    state_ = State::Data;
-                } else {
-                    // Anything else
-                    // This is an invalid-first-character-of-tag-name parse error.
-                    print_parse_error("invalid-first-character-of-tag-name");
-                    // TODO: Create a comment token whose data is the empty string.
-                    // Reconsume in the bogus comment state.
-                    reconsume_ = true;
-                    state_ = State::Comment;
-                }
-            } else {
-                // This is an eof-before-tag-name parse error.
-                print_parse_error("eof-before-tag-name");
-                // Emit a U+003C LESS-THAN SIGN character token, a U+002F SOLIDUS
-                // character token and an end-of-file token.
-                pending_tokens_.push_back(emit_eof());
-                pending_tokens_.push_back(emit_char('/'));
-                return emit_char('<');
-            }
-            break;
-        case State::TagName:
-            // https://html.spec.whatwg.org/multipage/parsing.html#tag-name-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE - Switch to the before
-                    // attribute name state.
-                    // Switch to the before attribute name state.
-                    state_ = State::BeforeAttributeName;
-                } else if (ch == '/') {
-                    // U+002F SOLIDUS (/) - Switch to the self-closing start tag state.
-                    state_ = State::SelfClosingStartTag;
-                } else if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // Switch to the data state.
-                    // Emit the current tag token.
-                    state_ = State::Data;
-                    return emit_cur_tag();
-                } /* TODO: U+0000 NULL*/ else {
-                    // Anything else
-                    // ASCII upper alpha - Append the lowercase version of the current
-                    // input character (add 0x0020 to the character's code point) to the
-                    // current tag token's tag name. Append the current input character
-                    // to the current tag token's tag name.
-                    cur_tag_name_.push_back(CharUtil::to_ascii_lower(ch));
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::BeforeAttributeName:
-            // https://html.spec.whatwg.org/multipage/parsing.html#before-attribute-name-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE - Ignore the character.
-                    continue;
-                } else if (ch == '/' || ch == '>') {
-                    // U+002F SOLIDUS (/) | U+003E GREATER-THAN SIGN (>)
-                    // Reconsume in the after attribute name state.
-                    reconsume_ = true;
-                    state_ = State::AfterAttributeName;
-                } else if (ch == '=') {
-                    // U+003D EQUALS SIGN (=)
-                    // This is an unexpected-equals-sign-before-attribute-name parse
-                    // error.
-                    print_parse_error("unexpected-equals-sign-before-attribute-name");
-                    // Start a new attribute in the current tag token.
-                    create_attr();
-                    // Set that attribute's name to the current input character, and its
-                    // value to the empty string.
-                    cur_attr_name_.push_back(ch);
-                    // Switch to the attribute name state.
-                    state_ = State::AttributeName;
-                } else {
-                    // Anything else
-                    // Start a new attribute in the current tag token.
-                    create_attr();
-                    // Set that attribute name and value to the empty string.
-                    // Reconsume in the attribute name state.
-                    reconsume_ = true;
-                    state_ = State::AttributeName;
-                }
-            } else {
-                // EOF - Reconsume in the after attribute name state.
-                reconsume_ = true;
-                state_ = State::AfterAttributeName;
-            }
-            break;
-        case State::AttributeName:
-            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-name-state
-            // TODO: When the user agent leaves the attribute name state (and before
-            // emitting the tag token, if appropriate), the complete attribute's
-            // name must be compared to the other attributes on the same token; if
-            // there is already an attribute on the token with the exact same name,
-            // then this is a duplicate-attribute parse error and the new attribute
-            // must be removed from the token. If an attribute is so removed from a
-            // token, it, and the value that gets associated with it, if any, are
-            // never subsequently used by the parser, and are therefore effectively
-            // discarded. Removing the attribute in this way does not change its
-            // status as the "current attribute" for the purposes of the tokenizer,
-            // however.
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ' || ch == '/' || ch == '>') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE | U+002F SOLIDUS (/) |
-                    // U+003E GREATER-THAN SIGN (>)
-                    // Reconsume in the after attribute name state.
-                    reconsume_ = true;
-                    state_ = State::AfterAttributeName;
-                } else if (ch == '=') {
-                    // U+003D EQUALS SIGN (=)
-                    // Switch to the before attribute value state.
-                    state_ = State::BeforeAttributeValue;
-                } /* TODO: U+0000 NULL */ else if (ch == '"' || ch == '\'' || ch == '<') {
-                    // U+0022 QUOTATION MARK (") | U+0027 APOSTROPHE (') | U+003C
-                    // LESS-THAN SIGN (<).
-                    // This is an unexpected-character-in-attribute-name parse error.
-                    print_parse_error("unexpected-character-in-attribute-name");
-                    // Treat it as per the "anything else" entry below.
-                    cur_attr_name_.push_back(CharUtil::to_ascii_lower(ch));
-                } else {
-                    // Anything else
-                    // Append the current input character to the current attribute's
-                    // name.
-                    // ASCII upper alpha - Append the lowercase version of the current
-                    // input character (add 0x0020 to the character's code point) to the
-                    // current attribute's name.
-                    cur_attr_name_.push_back(CharUtil::to_ascii_lower(ch));
-                }
-            } else {
-                // EOF - Reconsume in the after attribute name state.
-                reconsume_ = true;
-                state_ = State::AfterAttributeName;
-            }
-            break;
-        case State::AfterAttributeName:
-            // https://html.spec.whatwg.org/multipage/parsing.html#after-attribute-name-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE - Ignore the character.
-                    continue;
-                } else if (ch == '/') {
-                    // U+002F SOLIDUS (/) - Switch to the self-closing start tag state.
-                    state_ = State::SelfClosingStartTag;
-                } else if (ch == '=') {
-                    // U+003D EQUALS SIGN (=)
-                    // Switch to the before attribute value state.
-                    state_ = State::BeforeAttributeValue;
-                } else if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // Switch to the data state. Emit the current tag token.
-                    state_ = State::Data;
-                    return emit_cur_tag();
-                } else {
-                    // Start a new attribute in the current tag token.
-                    // Set that attribute name and value to the empty string.
-                    create_attr();
-                    // Reconsume in the attribute name state.
-                    reconsume_ = true;
-                    state_ = State::AttributeName;
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::BeforeAttributeValue:
-            // https://html.spec.whatwg.org/multipage/parsing.html#before-attribute-value-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE - Ignore the character.
-                    continue;
-                } else if (ch == '"') {
-                    // U+0022 QUOTATION MARK (")
-                    // Switch to the attribute value (double-quoted) state.
-                    state_ = State::AttributeValueDoubleQuoted;
-                } else if (ch == '\'') {
-                    // U+0027 APOSTROPHE (')
-                    // Switch to the attribute value (single-quoted) state.
-                    state_ = State::AttributeValueSingleQuoted;
-                } else if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // This is a missing-attribute-value parse error.
-                    print_parse_error("missing-attribute-value");
-                    // Switch to the data state.
-                    state_ = State::Data;
-                    // Emit the current tag token.
-                    return emit_cur_tag();
-                } else {
-                    // Anything else
-                    // Reconsume in the attribute value (unquoted) state.
-                    reconsume_ = true;
-                    state_ = State::AttributeValueUnquoted;
-                }
-            } else {
-                // Anything else - Reconsume in the attribute value (unquoted) state.
-                reconsume_ = true;
-                state_ = State::AttributeValueUnquoted;
-            }
-            break;
-        case State::AttributeValueDoubleQuoted:
-            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-value-(double-quoted)-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '"') {
-                    // U+0022 QUOTATION MARK (")
-                    // Switch to the after attribute value (quoted) state.
-                    state_ = State::AfterAttributeValueQuoted;
-                } /* TODO: U+0026 AMPERSAND (&) U+0000 NULL */ else {
-                    // Anything else - Append the current input character to the current
-                    // attribute's value.
-                    cur_attr_value_.push_back(ch);
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag parse");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::AttributeValueSingleQuoted:
-            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-value-(single-quoted)-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\'') {
-                    // U+0027 APOSTROPHE (')
-                    // Switch to the after attribute value (quoted) state.
-                    state_ = State::AfterAttributeValueQuoted;
-                } /* TODO: U+0026 AMPERSAND (&) U+0000 NULL */ else {
-                    // Anything else - Append the current input character to the current
-                    // attribute's value.
-                    cur_attr_value_.push_back(ch);
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag parse");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::AttributeValueUnquoted:
-            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-value-(unquoted)-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE - Switch to the before
-                    // attribute name state.
-                    state_ = State::BeforeAttributeName;
-                } /* TODO: U+0026 AMPERSAND (&) */ else if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // Switch to the data state.
-                    // Emit the current tag token.
-                    state_ = State::Data;
-                    return emit_cur_tag();
-                } /* TODO: U+0000 NULL */ else if (ch == '"' || ch == '\'' || ch == '<' || ch == '=' || ch == '`') {
-                    // U+0022 QUOTATION MARK (") | U+0027 APOSTROPHE (') | U+003C
-                    // LESS-THAN SIGN (<) | U+003D EQUALS SIGN (=) | U+0060 GRAVE ACCENT
-                    // (`)
-                    // This is an unexpected-character-in-unquoted-attribute-value parse
-                    // error.
-                    print_parse_error(
-                        "unexpected-character-in-unquoted-attribute-value");
-                    // Treat it as per the "anything else" entry below.
-                    cur_attr_value_.push_back(ch);
-                } else {
-                    // Anything else - Append the current input character to the current
-                    // attribute's value.
-                    cur_attr_value_.push_back(ch);
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag parse");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::AfterAttributeValueQuoted:
-            // https://html.spec.whatwg.org/multipage/parsing.html#after-attribute-value-(quoted)-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
-                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
-                    // U+000C FORM FEED (FF) | U+0020 SPACE - Switch to the before
-                    // attribute name state.
-                    state_ = State::BeforeAttributeName;
-                } else if (ch == '/') {
-                    // U+002F SOLIDUS (/) - Switch to the self-closing start tag state.
-                    state_ = State::SelfClosingStartTag;
-                } else if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // Switch to the data state.
-                    // Emit the current tag token.
-                    state_ = State::Data;
-                    return emit_cur_tag();
-                } else {
-                    // Anything else
-                    // This is a missing-whitespace-between-attributes parse error.
-                    print_parse_error("missing-whitespace-between-attributes");
-                    // Reconsume in the before attribute name state.
-                    reconsume_ = true;
-                    state_ = State::BeforeAttributeName;
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::SelfClosingStartTag:
-            // https://html.spec.whatwg.org/multipage/parsing.html#self-closing-start-tag-state
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '>') {
-                    // U+003E GREATER-THAN SIGN (>)
-                    // Set the self-closing flag of the current tag token.
-                    cur_tag_self_closing_ = true;
-                    // Switch to the data state.
-                    state_ = State::Data;
-                    // Emit the current tag token.
-                    return emit_cur_tag();
-                } else {
-                    // Anything else
-                    // This is an unexpected-solidus-in-tag parse error.
-                    print_parse_error("unexpected-solidus-in-tag");
-                    // Reconsume in the before attribute name state.
-                    reconsume_ = true;
-                    state_ = State::BeforeAttributeName;
-                }
-            } else {
-                // This is an eof-in-tag parse error.
-                print_parse_error("eof-in-tag");
-                // Emit an end-of-file token.
-                return emit_eof();
-            }
-            break;
-        case State::Comment:
-            // TODO: Comment & Bogus Comment
-            if (c.has_value()) {
-                auto ch = c.value();
-
-                if (ch == '>') {
-                    state_ = State::Data;
-                }
-            } else {
-                print_parse_error("eof-in-comment");
-                return emit_eof();
-            }
-            break;
+    if (!stepped && shadow_->try_next_view()) {
+        fmt::println(stderr, "[HTML Tokenizer] table engine paused at offset {} but the switch engine did not",
+            pos_);
+        std::abort();
+    }
+
+    return stepped;
+}
+
+template <typename Policy>
+std::string_view BasicTokenizer<Policy>::consume_text_run()
+{
+    // Every character up to the next '<', '&' or NUL would be emitted as a character token
+    // in this same state, so emit them all as one text run instead.
+    auto start = pos_ - 1;
+    auto end = SimdScan::find_any(input_, pos_, kDataNeedles<Policy>);
+    count_input(end - pos_);
+    pos_ = end;
+    return input_.substr(start, end - start);
+}
+
+template <typename Policy>
+void BasicTokenizer<Policy>::append_quoted_attr_value()
+{
+    // The characters up to the next closing quote all take the "anything
+    // else" entry, so append them together.
+    const auto& needles = state_ == State::AttributeValueDoubleQuoted
+        ? kDoubleQuotedNeedles<Policy>
+        : kSingleQuotedNeedles<Policy>;
+    auto start = pos_ - 1;
+    auto end = SimdScan::find_any(input_, pos_, needles);
+    attr_values_.append(input_.substr(start, end - start));
+    count_input(end - pos_);
+    pos_ = end;
+}
+
+template <typename Policy>
+bool BasicTokenizer<Policy>::in_attribute_value() const
+{
+    return return_state_ == State::AttributeValueDoubleQuoted
+        || return_state_ == State::AttributeValueSingleQuoted
+        || return_state_ == State::AttributeValueUnquoted;
+}
+
+template <typename Policy>
+void BasicTokenizer<Policy>::append_char_ref_digit(std::uint32_t base, char ch)
+{
+    // Anything above U+10FFFF ends up as the same error, so stop growing there.
+    constexpr std::uint32_t kSaturated = 0x110000;
+    auto code = static_cast<std::uint64_t>(char_ref_code_) * base + CharUtil::hex_digit_value(ch);
+    char_ref_code_ = code > kSaturated ? kSaturated : static_cast<std::uint32_t>(code);
+}
+
+template <typename Policy>
+ParseErrorCode BasicTokenizer<Policy>::resolve_char_ref_code()
+{
+    // https://html.spec.whatwg.org/multipage/parsing.html#numeric-character-reference-end-state
+    auto code = char_ref_code_;
+    auto error = ParseErrorCode::None;
+    if (code == 0) {
+        // If the number is 0x00, then this is a null-character-reference parse
+        // error. Set the character reference code to 0xFFFD.
+        error = ParseErrorCode::NullCharacterReference;
+        code = 0xFFFD;
+    } else if (code > 0x10FFFF) {
+        // If the number is greater than 0x10FFFF, then this is a
+        // character-reference-outside-unicode-range parse error. Set the
+        // character reference code to 0xFFFD.
+        error = ParseErrorCode::CharacterReferenceOutsideUnicodeRange;
+        code = 0xFFFD;
+    } else if (code >= 0xD800 && code <= 0xDFFF) {
+        // If the number is a surrogate, then this is a
+        // surrogate-character-reference parse error. Set the character
+        // reference code to 0xFFFD.
+        error = ParseErrorCode::SurrogateCharacterReference;
+        code = 0xFFFD;
+    } else if ((code >= 0xFDD0 && code <= 0xFDEF) || (code & 0xFFFE) == 0xFFFE) {
+        // If the number is a noncharacter, then this is a
+        // noncharacter-character-reference parse error.
+        error = ParseErrorCode::NoncharacterCharacterReference;
+    } else if (code == 0x0D
+        || ((code < 0x20 || (code >= 0x7F && code <= 0x9F))
+            && !CharUtil::is_html_whitespace(static_cast<char>(code)))) {
+        // If the number is 0x0D, or a control that's not ASCII whitespace, then
+        // this is a control-character-reference parse error. If the number is
+        // one of the numbers in the first column of the following table, then
+        // find the row with that number in the first column, and set the
+        // character reference code to the number in the second column.
+        // That table is windows-1252's, minus the bytes it leaves undefined.
+        error = ParseErrorCode::ControlCharacterReference;
+        if (code >= 0x80) {
+            code = CharUtil::kWindows1252HighControls[code - 0x80];
         }
     }
+
+    // Set the temporary buffer to the empty string. Append a code point equal
+    // to the character reference code to the temporary buffer.
+    char_ref_buffer_size_ = CharUtil::encode_utf8(code, char_ref_buffer_);
+    return error;
+}
+
+template <typename Policy>
+void BasicTokenizer<Policy>::skip_comment()
+{
+    auto end = SimdScan::find_any(input_, pos_, kCommentNeedles<Policy>);
+    count_input(end - pos_);
+    pos_ = end;
 }
 
-void Tokenizer::create_attr() { append_cur_attr(); }
+template <typename Policy>
+void BasicTokenizer<Policy>::create_attr() { append_cur_attr(); }
 
-void Tokenizer::clear_attr()
+template <typename Policy>
+void BasicTokenizer<Policy>::clear_attr()
 {
     cur_attr_name_.clear();
-    cur_attr_value_.clear();
+    attr_values_.resize(cur_attr_value_begin_);
 }
 
-void Tokenizer::create_start_tag()
+template <typename Policy>
+void BasicTokenizer<Policy>::create_start_tag()
 {
     cur_tag_kind_ = TokenTag::Kind::Start;
     create_tag();
 }
 
-void Tokenizer::create_end_tag()
+template <typename Policy>
+void BasicTokenizer<Policy>::create_end_tag()
 {
     cur_tag_kind_ = TokenTag::Kind::End;
     create_tag();
 }
 
-void Tokenizer::create_tag()
+template <typename Policy>
+void BasicTokenizer<Policy>::create_tag()
 {
     cur_tag_self_closing_ = false;
     clear_tag();
     clear_attr();
 }
 
-void Tokenizer::clear_tag()
+template <typename Policy>
+void BasicTokenizer<Policy>::clear_tag()
 {
     cur_tag_name_.clear();
     cur_tag_attributes_.clear();
+    attr_values_.clear();
+    cur_attr_value_begin_ = 0;
 }
 
-void Tokenizer::append_cur_attr()
+template <typename Policy>
+void BasicTokenizer<Policy>::append_cur_attr()
 {
     if (cur_attr_name_.empty()) {
         return;
     }
 
-    cur_tag_attributes_.emplace_back(std::move(cur_attr_name_),
-        std::move(cur_attr_value_));
+    // The name buffer is kept for the next attribute. Known names resolve to a
+    // static atom, unknown ones are copied into the interner once.
+    auto id = Atoms::lookup_attr(cur_attr_name_);
+    auto name = id != AttrId::Unknown ? Atoms::name_of(id)
+                                      : interner_.intern(cur_attr_name_);
+    cur_tag_attributes_.push_back(
+        { id, name, cur_attr_value_begin_, attr_values_.size() });
+    cur_attr_value_begin_ = attr_values_.size();
 
     clear_attr();
 }
 
-Token Tokenizer::emit_cur_tag()
+template <typename Policy>
+TagView BasicTokenizer<Policy>::finish_cur_tag()
 {
     append_cur_attr();
 
-    TokenTag tag(cur_tag_kind_, std::move(cur_tag_name_), cur_tag_self_closing_,
-        std::move(cur_tag_attributes_));
-    clear_tag();
-
-    if (tag.kind == TokenTag::Kind::Start) {
-        return Token::new_start(std::move(tag));
-    } else {
-        return Token::new_end(std::move(tag));
+    // The values are final now, so views into attr_values_ stay valid until
+    // the next tag is created.
+    std::string_view values = attr_values_;
+    attr_views_.clear();
+    for (const auto& attr : cur_tag_attributes_) {
+        attr_views_.push_back({ attr.id, attr.name,
+            values.substr(attr.value_begin, attr.value_end - attr.value_begin) });
     }
-}
 
-Token Tokenizer::emit_eof() { return Token::new_eof(); }
+    TagView tag;
+    tag.kind = cur_tag_kind_;
+    tag.id = Atoms::lookup_tag(cur_tag_name_);
+    tag.name = tag.id != TagId::Unknown ? Atoms::name_of(tag.id)
+                                        : interner_.intern(cur_tag_name_);
+    tag.self_closing = cur_tag_self_closing_;
+    tag.attributes = { attr_views_.data(), attr_views_.size() };
+    tag.offset = tag_open_offset_;
+
+    return tag;
+}
 
-Token Tokenizer::emit_char(char ch) { return Token::new_char(ch); }
\ No newline at end of file
+template class BasicTokenizer<SpecPolicy>;
+template class BasicTokenizer<TrustedInput>;
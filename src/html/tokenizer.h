@@ -1,34 +1,281 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
+#include "atoms.h"
+#include "parse_error.h"
+#include "preprocessor.h"
 #include "state.h"
 #include "token.h"
+#include "tokenizer_stats.h"
+
+/// @brief How the tokenizer emits text in the data state.
+enum class TextMode {
+    /// @brief One Token::Character per input character.
+    Character,
+    /// @brief One Token::TextRun per contiguous span of text, sliced from the
+    /// input without copying.
+    Run,
+};
+
+/// @brief Which implementation of the state machine drives the tokenizer.
+enum class Engine {
+    /// @brief One `switch` case per state, comparing characters directly.
+    Switch,
+    /// @brief Classifies each character once through a constexpr table and
+    /// looks the transition up in a per-state action table.
+    Table,
+    /// @brief Runs the table engine and checks every token against the switch
+    /// engine, aborting on the first difference.
+    Verify,
+};
+
+/// @brief Tokenizer policy that follows the spec to the letter. The default.
+struct SpecPolicy {
+    /// @brief Report parse errors to sinks that handle them.
+    static constexpr bool kReportErrors = true;
+    /// @brief Treat U+0000 NULL as the spec does, e.g. replace it with U+FFFD
+    /// in names and attribute values.
+    static constexpr bool kHandleNul = true;
+    /// @brief Give tokens and parse errors their byte offset in the document.
+    static constexpr bool kTrackOffsets = true;
+};
+
+/// @brief Tokenizer policy for input we generate ourselves and know to be
+/// well-formed, such as templated pages.
+///
+/// No parse errors are reported, NUL is an ordinary character and every
+/// offset is 0, so all of that bookkeeping compiles away. On well-formed input
+/// without NUL the tokens are the same as with SpecPolicy, offsets aside.
+/// Character references are decoded either way.
+struct TrustedInput {
+    static constexpr bool kReportErrors = false;
+    static constexpr bool kHandleNul = false;
+    static constexpr bool kTrackOffsets = false;
+};
 
 /// @brief HTML Tokenizer
 ///
 /// https://html.spec.whatwg.org/multipage/parsing.html#tokenization
-class Tokenizer {
+///
+/// The input is either given whole to the constructor, or pushed in chunks
+/// with feed() and closed with finish(). A chunked tokenizer pauses whenever
+/// it runs out of buffered input, in whatever state it is in, and picks up
+/// from there once the next chunk arrives.
+///
+/// `Policy` picks error reporting, NUL handling and offset tracking at
+/// compile time, see SpecPolicy and TrustedInput. Both are instantiated in
+/// tokenizer.cpp.
+template <typename Policy>
+class BasicTokenizer {
 private:
+    /// @brief The input that is currently available.
+    /// Views either the constructor argument or `buffer_`.
     std::string_view input_;
+    /// @brief Unconsumed bytes of the chunks passed to feed().
+    std::string buffer_;
+    /// @brief Preprocesses the chunks passed to feed_raw().
+    InputPreprocessor preprocessor_;
+    /// @brief Whether the end of `input_` is the end of the document.
+    bool finished_;
+    /// @brief Bytes of the document released from `buffer_`, so that
+    /// `consumed_ + pos_` is an offset in the document.
+    std::size_t consumed_;
     std::size_t pos_;
     bool reconsume_;
+    /// @brief Offset of the '<' that started the markup being tokenized.
+    std::uint32_t tag_open_offset_;
     State state_;
-    std::vector<Token> pending_tokens_;
+    /// @brief The state a character reference returns to.
+    State return_state_;
+    TextMode text_mode_;
+    Engine engine_;
+    /// @brief Reference tokenizer for Engine::Verify.
+    std::unique_ptr<BasicTokenizer> shadow_;
+    /// @brief Owns the names of tags and attributes outside the atom tables.
+    /// Tokens refer to it, so they must not outlive the tokenizer.
+    AtomInterner interner_;
+
+    /// @brief A finished attribute of the current tag.
+    /// Its value is a range of `attr_values_`, which may still reallocate
+    /// while the tag is being built.
+    struct PendingAttribute {
+        AttrId id;
+        std::string_view name;
+        std::size_t value_begin;
+        std::size_t value_end;
+    };
+
+    // Buffers for the tag being built. They are cleared rather than released
+    // between tags, so after the first few tags they stop allocating.
     TokenTag::Kind cur_tag_kind_;
     std::string cur_tag_name_;
     bool cur_tag_self_closing_;
-    std::vector<Attribute> cur_tag_attributes_;
+    std::vector<PendingAttribute> cur_tag_attributes_;
     std::string cur_attr_name_;
-    std::string cur_attr_value_;
+    /// @brief Values of all attributes of the current tag, back to back.
+    /// The current attribute's value is the tail starting at
+    /// `cur_attr_value_begin_`.
+    std::string attr_values_;
+    std::size_t cur_attr_value_begin_;
+    /// @brief Attributes of the last emitted tag.
+    std::vector<AttributeView> attr_views_;
+
+    // State of the character reference being tokenized.
+    /// @brief Offset of its '&', which the characters it flushes carry.
+    std::uint32_t char_ref_offset_;
+    /// @brief The numeric character reference code, saturated just above
+    /// U+10FFFF so that long digit strings cannot overflow it.
+    std::uint32_t char_ref_code_;
+    /// @brief The spec's temporary buffer: "&#" or "&#x" while a numeric
+    /// reference is read, then the UTF-8 of its code point.
+    char char_ref_buffer_[4];
+    std::size_t char_ref_buffer_size_;
+
+    /// @brief Tokens produced by the last step that the pull API has not
+    /// returned yet. A step emits more than one token only at end of file, or
+    /// when a character reference flushes several characters in
+    /// TextMode::Character.
+    std::vector<TokenView> pending_tokens_;
+    std::size_t pending_head_;
+    /// @brief Tokens and errors of the last step of Engine::Verify.
+    std::vector<TokenView> verified_tokens_;
+    ParseErrorBuffer verified_errors_;
+    bool eof_emitted_;
+    /// @brief Parse errors seen by the pull API.
+    ParseErrorBuffer errors_;
+#ifdef EVEN_TOKENIZER_STATS
+    TokenizerStats stats_;
+    /// @brief The state that looked at the previous input.
+    State stats_state_ = State::Data;
+#endif
+
+    /// @brief Sink that turns pushed tokens back into TokenViews.
+    struct ViewSink {
+        const BasicTokenizer& tokenizer;
+        std::vector<TokenView>& out;
+        ParseErrorBuffer& errors;
+
+        void on_start_tag(const TagView& tag) { out.push_back(TokenView::new_tag(tag)); }
+        void on_end_tag(const TagView& tag) { out.push_back(TokenView::new_tag(tag)); }
+        void on_text(std::string_view text, std::uint32_t offset)
+        {
+            out.push_back(TokenView::new_text_run(text, offset));
+        }
+        void on_char(char ch, std::uint32_t offset) { out.push_back(TokenView::new_char(ch, offset)); }
+        void on_eof() { out.push_back(TokenView::new_eof(tokenizer.offset_of(tokenizer.input_.size()))); }
+        void on_parse_error(ParseError error) { errors.on_parse_error(error); }
+    };
+
+    /// @brief Sends tokens to one sink and parse errors to another.
+    template <typename Sink, typename ErrorSink>
+    struct SplitSink {
+        Sink& tokens;
+        ErrorSink& errors;
+
+        void on_start_tag(const TagView& tag) { tokens.on_start_tag(tag); }
+        void on_end_tag(const TagView& tag) { tokens.on_end_tag(tag); }
+        void on_text(std::string_view text, std::uint32_t offset) { tokens.on_text(text, offset); }
+        void on_char(char ch, std::uint32_t offset) { tokens.on_char(ch, offset); }
+        void on_eof() { tokens.on_eof(); }
+        void on_parse_error(ParseError error) { errors.on_parse_error(error); }
+    };
 
     std::optional<char> peek();
-    Token emit_eof();
-    Token emit_char(char ch);
-    Token emit_cur_tag();
+
+    // Instrumentation hooks. They compile to nothing unless EVEN_TOKENIZER_STATS
+    // is defined.
+    void count_peek()
+    {
+#ifdef EVEN_TOKENIZER_STATS
+        if (state_ != stats_state_) {
+            stats_.transitions[static_cast<std::size_t>(stats_state_)][static_cast<std::size_t>(state_)]++;
+            stats_state_ = state_;
+        }
+        if (reconsume_) {
+            stats_.reconsumes++;
+        }
+#endif
+    }
+    void count_input([[maybe_unused]] std::size_t bytes)
+    {
+#ifdef EVEN_TOKENIZER_STATS
+        stats_.state_bytes[static_cast<std::size_t>(state_)] += bytes;
+#endif
+    }
+
+    /// @brief Runs the state machine until it has pushed at least one token
+    /// into `sink`.
+    /// @return false, without pushing anything, when more input is needed.
+    template <typename Sink>
+    bool step(Sink& sink);
+    template <typename Sink>
+    bool step_engine(Sink& sink);
+    template <typename Sink>
+    bool step_switch(Sink& sink);
+    template <typename Sink>
+    bool step_table(Sink& sink);
+    template <typename Sink>
+    bool step_verify(Sink& sink);
+    bool verify_step();
+    template <typename Sink>
+    static void deliver(Sink& sink, const TokenView& token);
+    template <typename Sink>
+    void report_error(Sink& sink, ParseErrorCode code);
+    /// @brief Offset in the document of `input_[pos]`.
+    std::uint32_t offset_of(std::size_t pos) const
+    {
+        if constexpr (Policy::kTrackOffsets) {
+            return static_cast<std::uint32_t>(consumed_ + pos);
+        } else {
+            (void)pos;
+            return 0;
+        }
+    }
+    /// @brief Offset of the character just consumed, or of the end of file.
+    std::uint32_t error_offset() const { return offset_of(pos_ > 0 ? pos_ - 1 : 0); }
+    void mark_tag_open() { tag_open_offset_ = offset_of(pos_ - 1); }
+
+    /// @brief Outcome of consume_char_ref().
+    enum class CharRefResult {
+        /// @brief Nothing was consumed, the '&' is retried with more input.
+        NeedInput,
+        /// @brief Characters were emitted, so the step is over.
+        Emitted,
+        /// @brief Keep going in the new state.
+        Continue,
+    };
+
+    template <typename Sink>
+    CharRefResult consume_char_ref(Sink& sink);
+    template <typename Sink>
+    bool emit_or_append(Sink& sink, std::string_view chars, std::uint32_t offset);
+    template <typename Sink>
+    bool emit_or_append_alphanumerics(Sink& sink);
+    template <typename Sink>
+    bool flush_char_ref_buffer(Sink& sink);
+    template <typename Sink>
+    bool finish_numeric_char_ref(Sink& sink);
+    bool in_attribute_value() const;
+    ParseErrorCode resolve_char_ref_code();
+    void append_char_ref_digit(std::uint32_t base, char ch);
+
+    template <typename Sink>
+    void emit_data_text(Sink& sink, char ch);
+    template <typename Sink>
+    void emit_cur_tag(Sink& sink);
+    template <typename Sink>
+    void emit_eof(Sink& sink);
+    std::string_view consume_text_run();
+    TagView finish_cur_tag();
+    void append_quoted_attr_value();
+    void skip_comment();
     void create_start_tag();
     void create_end_tag();
     void create_tag();
@@ -37,8 +284,115 @@ private:
     void clear_attr();
     void append_cur_attr();
 
+    friend class IncrementalTokenizer;
+    friend class ParallelTokenizer;
+
+    /// @brief Tokenizes `document` from byte `begin` in the data state, with
+    /// offsets counted from the start of `document`. Like a chunked tokenizer
+    /// out of input, it pauses at `end` until extend_input() moves it.
+    BasicTokenizer(std::string_view document, std::size_t begin, std::size_t end,
+        TextMode text_mode, Engine engine);
+
+    /// @brief Makes the bytes of the same document up to `end` available,
+    /// the last of them when `last` is set.
+    void extend_input(std::size_t end, bool last);
+
+    /// @brief Whether the tokenizer consumed all of its input and is in the
+    /// data state with nothing held back. A tokenizer that starts in the data
+    /// state at the next byte then produces exactly the same tokens as this
+    /// one would.
+    bool at_data_boundary() const
+    {
+        return state_ == State::Data && !reconsume_ && pos_ == input_.size()
+            && !eof_emitted_ && pending_head_ == pending_tokens_.size();
+    }
+
 public:
-    explicit Tokenizer(std::string_view input);
-    ~Tokenizer();
+    /// @brief Tokenizes a complete document.
+    explicit BasicTokenizer(std::string_view input,
+        TextMode text_mode = TextMode::Run, Engine engine = Engine::Switch);
+    /// @brief Tokenizes a document that arrives through feed().
+    explicit BasicTokenizer(TextMode text_mode = TextMode::Run,
+        Engine engine = Engine::Switch);
+    ~BasicTokenizer();
+
+    /// @brief Starts over on another complete document, as if newly
+    /// constructed for it, but keeps the buffers grown so far. Tokens of the
+    /// previous document become invalid.
+    void reset(std::string_view input);
+
+    /// @brief Appends the next chunk of the document.
+    /// Bytes that were already consumed are released first, so text runs
+    /// emitted before this call no longer point at valid memory.
+    /// Ignored once the input is finished.
+    void feed(std::string_view chunk);
+
+    /// @brief Like feed(), but for raw UTF-8 bytes: preprocesses the input
+    /// stream first, as HTMLParser::parse() does for whole documents, and
+    /// holds back a sequence cut off at the end of the chunk until the next
+    /// one. Offsets count preprocessed bytes. Do not mix with feed().
+    void feed_raw(std::string_view chunk) { feed(preprocessor_.process(chunk).text); }
+
+    /// @brief Marks the end of the document.
+    void finish();
+
+    /// @brief Returns the next token, or nothing when more input is needed.
+    std::optional<Token> try_next();
+
+    /// @brief Returns the next token.
+    /// Requires the whole input to be available: either given to the
+    /// constructor or closed with finish().
     Token next();
-};
\ No newline at end of file
+
+    /// @brief Like try_next(), but borrows the token instead of copying it.
+    /// The views stay valid until the tokenizer is advanced or fed again.
+    /// Once its buffers have grown to fit the input, this does not allocate.
+    std::optional<TokenView> try_next_view();
+
+    /// @brief Like next(), but borrows the token instead of copying it.
+    TokenView next_view();
+
+    /// @brief Parse errors met by the pull API so far, oldest first.
+    /// run() reports errors to its sink instead.
+    const ParseErrorBuffer& parse_errors() const { return errors_; }
+
+#ifdef EVEN_TOKENIZER_STATS
+    /// @brief What the tokenizer did so far, over every document it was
+    /// reset() to.
+    const TokenizerStats& stats() const { return stats_; }
+#endif
+
+    /// @brief Pushes tokens into `sink` until the end of file or until more
+    /// input is needed, without building Token or TokenView objects.
+    ///
+    /// A sink provides:
+    ///     void on_start_tag(const TagView& tag);
+    ///     void on_end_tag(const TagView& tag);
+    ///     void on_text(std::string_view text, std::uint32_t offset);
+    ///     void on_char(char ch, std::uint32_t offset);
+    ///     void on_eof();
+    /// and optionally
+    ///     void on_parse_error(ParseError error);
+    /// Views passed to it are only valid during the call. `on_char` receives
+    /// single character tokens, `on_text` text runs, both with the byte
+    /// offset in the document where they start; tags carry theirs. Parse
+    /// errors are dropped when the sink has no handler for them.
+    ///
+    /// The state machine is a template over the sink, so the sink's handlers
+    /// are inlined into it.
+    /// @return true once `on_eof` has been called.
+    template <typename Sink>
+    bool run(Sink& sink);
+
+    /// @brief Like run(sink), but reports parse errors to `errors`, e.g. a
+    /// CountingErrorSink or a ParseErrorBuffer.
+    template <typename Sink, typename ErrorSink>
+    bool run(Sink& sink, ErrorSink& errors);
+};
+
+using Tokenizer = BasicTokenizer<SpecPolicy>;
+
+extern template class BasicTokenizer<SpecPolicy>;
+extern template class BasicTokenizer<TrustedInput>;
+
+#include "tokenizer_impl.h"
\ No newline at end of file
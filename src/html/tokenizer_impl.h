@@ -0,0 +1,1130 @@
+#pragma once
+
+// Template members of BasicTokenizer. Included at the end of tokenizer.h; the
+// state machine lives here so that it can be instantiated for, and inlined
+// together with, every sink type.
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include "../util/char_util.h"
+#include "entities.h"
+#include "parse_error.h"
+#include "state.h"
+#include "token.h"
+#include "transition_table.h"
+
+template <typename Policy>
+std::optional<char> BasicTokenizer<Policy>::peek()
+{
+    count_peek();
+    if (reconsume_) {
+        reconsume_ = false;
+        if (pos_ <= 0) {
+            return std::nullopt;
+        }
+
+        pos_--;
+    }
+
+    if (pos_ >= input_.size()) {
+        // Step past the end as well, so that reconsuming the EOF yields the EOF
+        // again instead of the last character.
+        pos_ = input_.size() + 1;
+        return std::nullopt;
+    }
+
+    auto c = input_[pos_];
+
+    pos_++;
+    count_input(1);
+
+    return c;
+}
+
+template <typename Policy>
+template <typename Sink>
+void BasicTokenizer<Policy>::deliver(Sink& sink, const TokenView& token)
+{
+    switch (token.kind) {
+    case Token::Kind::StartTag:
+        sink.on_start_tag(token.tag);
+        break;
+    case Token::Kind::EndTag:
+        sink.on_end_tag(token.tag);
+        break;
+    case Token::Kind::Character:
+        sink.on_char(token.ch, token.offset);
+        break;
+    case Token::Kind::TextRun:
+        sink.on_text(token.text, token.offset);
+        break;
+    case Token::Kind::EndOfFile:
+        sink.on_eof();
+        break;
+    }
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::run(Sink& sink)
+{
+    while (pending_head_ < pending_tokens_.size()) {
+        deliver(sink, pending_tokens_[pending_head_++]);
+    }
+
+    while (!eof_emitted_) {
+        if (!step(sink)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Policy>
+template <typename Sink, typename ErrorSink>
+bool BasicTokenizer<Policy>::run(Sink& sink, ErrorSink& errors)
+{
+    SplitSink<Sink, ErrorSink> split { sink, errors };
+    return run(split);
+}
+
+template <typename Policy>
+template <typename Sink>
+void BasicTokenizer<Policy>::report_error(Sink& sink, ParseErrorCode code)
+{
+    if constexpr (Policy::kReportErrors && HasParseErrorHandler<Sink>::value) {
+        sink.on_parse_error({ code, error_offset() });
+    } else {
+        (void)sink;
+        (void)code;
+    }
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::step(Sink& sink)
+{
+#ifdef EVEN_TOKENIZER_STATS
+    TokenizerStats::Recorder<Sink> recorder(sink, stats_);
+    return step_engine(recorder);
+#else
+    return step_engine(sink);
+#endif
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::step_engine(Sink& sink)
+{
+    switch (engine_) {
+    case Engine::Switch:
+        break;
+    case Engine::Table:
+        return step_table(sink);
+    case Engine::Verify:
+        return step_verify(sink);
+    }
+    return step_switch(sink);
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::step_verify(Sink& sink)
+{
+    if (!verify_step()) {
+        return false;
+    }
+
+    for (const auto& error : verified_errors_) {
+        if constexpr (HasParseErrorHandler<Sink>::value) {
+            sink.on_parse_error(error);
+        }
+    }
+    for (const auto& token : verified_tokens_) {
+        deliver(sink, token);
+    }
+    return true;
+}
+
+template <typename Policy>
+template <typename Sink>
+typename BasicTokenizer<Policy>::CharRefResult BasicTokenizer<Policy>::consume_char_ref(Sink& sink)
+{
+    // https://html.spec.whatwg.org/multipage/parsing.html#character-reference-state
+    // Called with the '&' consumed. Named references are matched against the
+    // entity trie in one go rather than a character at a time, so when the
+    // buffered input ends inside one, the '&' is put back and the whole
+    // reference is retried once more input has arrived.
+    auto amp = pos_ - 1;
+    if (pos_ >= input_.size() && !finished_) {
+        pos_ = amp;
+        return CharRefResult::NeedInput;
+    }
+
+    // Set the temporary buffer to the empty string. Append a U+0026 AMPERSAND
+    // (&) character to the temporary buffer.
+    return_state_ = state_;
+    char_ref_offset_ = offset_of(amp);
+    auto flush_ampersand = [&] {
+        return emit_or_append(sink, "&", char_ref_offset_)
+            ? CharRefResult::Emitted
+            : CharRefResult::Continue;
+    };
+
+    if (pos_ < input_.size() && CharUtil::is_ascii_alphanumeric(input_[pos_])) {
+        // ASCII alphanumeric - Reconsume in the named character reference state.
+        // https://html.spec.whatwg.org/multipage/parsing.html#named-character-reference-state
+        // Consume the maximum number of characters possible, where the
+        // consumed characters are one of the identifiers in the named
+        // character references table.
+        auto match = Entities::match(input_.substr(pos_));
+        if (match.truncated && !finished_) {
+            pos_ = amp;
+            return CharRefResult::NeedInput;
+        }
+
+        if (match.length == 0) {
+            // Otherwise
+            // Flush code points consumed as a character reference. Switch to
+            // the ambiguous ampersand state.
+            state_ = State::AmbiguousAmpersand;
+            return flush_ampersand();
+        }
+
+        pos_ += match.length;
+        count_input(match.length);
+        if (input_[pos_ - 1] != ';') {
+            // If the character reference was consumed as part of an
+            // attribute, and the last character matched is not a U+003B
+            // SEMICOLON character (;), and the next input character is either
+            // a U+003D EQUALS SIGN character (=) or an ASCII alphanumeric,
+            // then, for historical reasons, flush code points consumed as a
+            // character reference and switch to the return state.
+            if (in_attribute_value() && pos_ < input_.size()
+                && (input_[pos_] == '=' || CharUtil::is_ascii_alphanumeric(input_[pos_]))) {
+                attr_values_.append(input_.substr(amp, pos_ - amp));
+                return CharRefResult::Continue;
+            }
+
+            // If the last character matched is not a U+003B SEMICOLON
+            // character (;), then this is a
+            // missing-semicolon-after-character-reference parse error.
+            report_error(sink, ParseErrorCode::MissingSemicolonAfterCharacterReference);
+        }
+
+        // Set the temporary buffer to the empty string. Append one or two
+        // characters corresponding to the character reference name to the
+        // temporary buffer. Flush code points consumed as a character
+        // reference. Switch to the return state.
+        return emit_or_append(sink, match.value, char_ref_offset_)
+            ? CharRefResult::Emitted
+            : CharRefResult::Continue;
+    }
+
+    if (pos_ < input_.size() && input_[pos_] == '#') {
+        // U+0023 NUMBER SIGN (#)
+        // Append the current input character to the temporary buffer. Switch
+        // to the numeric character reference state.
+        pos_++;
+        char_ref_buffer_[0] = '&';
+        char_ref_buffer_[1] = '#';
+        char_ref_buffer_size_ = 2;
+        // Set the character reference code to zero (0).
+        char_ref_code_ = 0;
+        state_ = State::NumericCharacterReference;
+        return CharRefResult::Continue;
+    }
+
+    // Anything else
+    // Flush code points consumed as a character reference. Reconsume in the
+    // return state.
+    return flush_ampersand();
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::emit_or_append(Sink& sink, std::string_view chars, std::uint32_t offset)
+{
+    // https://html.spec.whatwg.org/multipage/parsing.html#flush-code-points-consumed-as-a-character-reference
+    if (in_attribute_value()) {
+        attr_values_.append(chars);
+        return false;
+    }
+
+    if (text_mode_ == TextMode::Character) {
+        for (auto ch : chars) {
+            sink.on_char(ch, offset);
+        }
+    } else {
+        sink.on_text(chars, offset);
+    }
+    return true;
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::emit_or_append_alphanumerics(Sink& sink)
+{
+    // Every alphanumeric after this one takes the same entry of the ambiguous
+    // ampersand state, so take them together unless each has to be its own
+    // character token.
+    auto start = pos_ - 1;
+    if (text_mode_ == TextMode::Run || in_attribute_value()) {
+        while (pos_ < input_.size() && CharUtil::is_ascii_alphanumeric(input_[pos_])) {
+            pos_++;
+        }
+        count_input(pos_ - start - 1);
+    }
+    return emit_or_append(sink, input_.substr(start, pos_ - start), offset_of(start));
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::flush_char_ref_buffer(Sink& sink)
+{
+    state_ = return_state_;
+    return emit_or_append(sink, std::string_view(char_ref_buffer_, char_ref_buffer_size_),
+        char_ref_offset_);
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::finish_numeric_char_ref(Sink& sink)
+{
+    // https://html.spec.whatwg.org/multipage/parsing.html#numeric-character-reference-end-state
+    auto error = resolve_char_ref_code();
+    if (error != ParseErrorCode::None) {
+        report_error(sink, error);
+    }
+    // Flush code points consumed as a character reference. Switch to the
+    // return state.
+    return flush_char_ref_buffer(sink);
+}
+
+template <typename Policy>
+template <typename Sink>
+void BasicTokenizer<Policy>::emit_data_text(Sink& sink, char ch)
+{
+    auto offset = offset_of(pos_ - 1);
+    if (text_mode_ == TextMode::Character) {
+        sink.on_char(ch, offset);
+    } else {
+        sink.on_text(consume_text_run(), offset);
+    }
+}
+
+template <typename Policy>
+template <typename Sink>
+void BasicTokenizer<Policy>::emit_cur_tag(Sink& sink)
+{
+    auto tag = finish_cur_tag();
+    if (tag.kind == TokenTag::Kind::Start) {
+        sink.on_start_tag(tag);
+    } else {
+        sink.on_end_tag(tag);
+    }
+}
+
+template <typename Policy>
+template <typename Sink>
+void BasicTokenizer<Policy>::emit_eof(Sink& sink)
+{
+    eof_emitted_ = true;
+    sink.on_eof();
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::step_switch(Sink& sink)
+{
+    while (true) {
+        if (!reconsume_ && pos_ >= input_.size() && !finished_) {
+            // Out of input, but it is not the end of the file yet. Every state
+            // keeps its progress in members, so it can stop here and continue
+            // with the first character of the next chunk.
+            return false;
+        }
+
+        auto c = peek();
+
+        switch (state_) {
+        case State::Data:
+            // https://html.spec.whatwg.org/multipage/parsing.html#data-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '&') {
+                    // U+0026 AMPERSAND (&)
+                    // Set the return state to the data state. Switch to the
+                    // character reference state.
+                    auto result = consume_char_ref(sink);
+                    if (result != CharRefResult::Continue) {
+                        return result == CharRefResult::Emitted;
+                    }
+                } else if (ch == '<') {
+                    // U+003C LESS-THAN SIGN (<) - Switch to the tag open state.
+                    mark_tag_open();
+                    state_ = State::TagOpen;
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL
+                    // This is an unexpected-null-character parse error. Emit
+                    // the current input character as a character token.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                    emit_data_text(sink, ch);
+                    return true;
+                } else {
+                    // Anything else
+                    // Emit the current input character as a character token.
+                    emit_data_text(sink, ch);
+                    return true;
+                }
+            } else {
+                // EOF - Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::TagOpen:
+            // https://html.spec.whatwg.org/multipage/parsing.html#tag-open-state
+            if (c.has_value()) {
+                auto ch = c.value();
+                if (ch == '!') {
+                    // TODO: U+0021 EXCLAMATION MARK (!) - Switch to the markup
+                    // declaration open state.
+                    state_ = State::Comment;
+                } else if (ch == '/') {
+                    // U+002F SOLIDUS (/) - Switch to the end tag open state.
+                    state_ = State::EndTagOpen;
+                } else if (CharUtil::is_ascii_alpha(ch)) {
+                    // ASCII alpha
+                    // Create a new start tag token,
+                    // set its tag name to the empty string.
+                    create_start_tag();
+                    // Reconsume in the tag name state.
+                    reconsume_ = true;
+                    state_ = State::TagName;
+                } else if (ch == '?') {
+                    // TODO: U+003F QUESTION MARK (?)
+                    // This is an unexpected-question-mark-instead-of-tag-name
+                    // parse error.
+                    report_error(sink, ParseErrorCode::UnexpectedQuestionMarkInsteadOfTagName);
+                    // Create a comment token whose data is the empty string.
+                    // Reconsume in the bogus comment state.
+                    reconsume_ = true;
+                    state_ = State::Comment;
+                } else {
+                    // Anything else
+                    // This is an invalid-first-character-of-tag-name parse error.
+                    report_error(sink, ParseErrorCode::InvalidFirstCharacterOfTagName);
+                    // Emit a U+003C LESS-THAN SIGN character token.
+                    // Reconsume in the data state.
+                    reconsume_ = true;
+                    state_ = State::Data;
+                    sink.on_char('<', tag_open_offset_);
+                    return true;
+                }
+            } else {
+                // EOF
+                // This is an eof-before-tag-name parse error.
+                report_error(sink, ParseErrorCode::EofBeforeTagName);
+                // Emit a U+003C LESS-THAN SIGN character token
+                // and an end-of-file token.
+                sink.on_char('<', tag_open_offset_);
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::EndTagOpen:
+            // https://html.spec.whatwg.org/multipage/parsing.html#end-tag-open-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (CharUtil::is_ascii_alpha(ch)) {
+                    // ASCII alpha
+                    // Create a new end tag token, set its tag name to the empty string.
+                    create_end_tag();
+                    // Reconsume in the tag name state.
+                    reconsume_ = true;
+                    state_ = State::TagName;
+                } else if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // This is a missing-end-tag-name parse error.
+                    report_error(sink, ParseErrorCode::MissingEndTagName);
+                    // Switch to the data state.
+                    state_ = State::Data;
+                } else {
+                    // Anything else
+                    // This is an invalid-first-character-of-tag-name parse error.
+                    report_error(sink, ParseErrorCode::InvalidFirstCharacterOfTagName);
+                    // TODO: Create a comment token whose data is the empty string.
+                    // Reconsume in the bogus comment state.
+                    reconsume_ = true;
+                    state_ = State::Comment;
+                }
+            } else {
+                // This is an eof-before-tag-name parse error.
+                report_error(sink, ParseErrorCode::EofBeforeTagName);
+                // Emit a U+003C LESS-THAN SIGN character token, a U+002F SOLIDUS
+                // character token and an end-of-file token.
+                sink.on_char('<', tag_open_offset_);
+                sink.on_char('/', tag_open_offset_ + 1);
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::TagName:
+            // https://html.spec.whatwg.org/multipage/parsing.html#tag-name-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE - Switch to the before
+                    // attribute name state.
+                    // Switch to the before attribute name state.
+                    state_ = State::BeforeAttributeName;
+                } else if (ch == '/') {
+                    // U+002F SOLIDUS (/) - Switch to the self-closing start tag state.
+                    state_ = State::SelfClosingStartTag;
+                } else if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // Switch to the data state.
+                    // Emit the current tag token.
+                    state_ = State::Data;
+                    emit_cur_tag(sink);
+                    return true;
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL
+                    // This is an unexpected-null-character parse error. Append
+                    // a U+FFFD REPLACEMENT CHARACTER character to the current
+                    // tag token's tag name.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                    cur_tag_name_.append(CharUtil::kReplacementCharacter);
+                } else {
+                    // Anything else
+                    // ASCII upper alpha - Append the lowercase version of the current
+                    // input character (add 0x0020 to the character's code point) to the
+                    // current tag token's tag name. Append the current input character
+                    // to the current tag token's tag name.
+                    cur_tag_name_.push_back(CharUtil::to_ascii_lower(ch));
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::BeforeAttributeName:
+            // https://html.spec.whatwg.org/multipage/parsing.html#before-attribute-name-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE - Ignore the character.
+                    continue;
+                } else if (ch == '/' || ch == '>') {
+                    // U+002F SOLIDUS (/) | U+003E GREATER-THAN SIGN (>)
+                    // Reconsume in the after attribute name state.
+                    reconsume_ = true;
+                    state_ = State::AfterAttributeName;
+                } else if (ch == '=') {
+                    // U+003D EQUALS SIGN (=)
+                    // This is an unexpected-equals-sign-before-attribute-name parse
+                    // error.
+                    report_error(sink, ParseErrorCode::UnexpectedEqualsSignBeforeAttributeName);
+                    // Start a new attribute in the current tag token.
+                    create_attr();
+                    // Set that attribute's name to the current input character, and its
+                    // value to the empty string.
+                    cur_attr_name_.push_back(ch);
+                    // Switch to the attribute name state.
+                    state_ = State::AttributeName;
+                } else {
+                    // Anything else
+                    // Start a new attribute in the current tag token.
+                    create_attr();
+                    // Set that attribute name and value to the empty string.
+                    // Reconsume in the attribute name state.
+                    reconsume_ = true;
+                    state_ = State::AttributeName;
+                }
+            } else {
+                // EOF - Reconsume in the after attribute name state.
+                reconsume_ = true;
+                state_ = State::AfterAttributeName;
+            }
+            break;
+        case State::AttributeName:
+            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-name-state
+            // TODO: When the user agent leaves the attribute name state (and before
+            // emitting the tag token, if appropriate), the complete attribute's
+            // name must be compared to the other attributes on the same token; if
+            // there is already an attribute on the token with the exact same name,
+            // then this is a duplicate-attribute parse error and the new attribute
+            // must be removed from the token. If an attribute is so removed from a
+            // token, it, and the value that gets associated with it, if any, are
+            // never subsequently used by the parser, and are therefore effectively
+            // discarded. Removing the attribute in this way does not change its
+            // status as the "current attribute" for the purposes of the tokenizer,
+            // however.
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ' || ch == '/' || ch == '>') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE | U+002F SOLIDUS (/) |
+                    // U+003E GREATER-THAN SIGN (>)
+                    // Reconsume in the after attribute name state.
+                    reconsume_ = true;
+                    state_ = State::AfterAttributeName;
+                } else if (ch == '=') {
+                    // U+003D EQUALS SIGN (=)
+                    // Switch to the before attribute value state.
+                    state_ = State::BeforeAttributeValue;
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL
+                    // This is an unexpected-null-character parse error. Append
+                    // a U+FFFD REPLACEMENT CHARACTER character to the current
+                    // attribute's name.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                    cur_attr_name_.append(CharUtil::kReplacementCharacter);
+                } else if (ch == '"' || ch == '\'' || ch == '<') {
+                    // U+0022 QUOTATION MARK (") | U+0027 APOSTROPHE (') | U+003C
+                    // LESS-THAN SIGN (<).
+                    // This is an unexpected-character-in-attribute-name parse error.
+                    report_error(sink, ParseErrorCode::UnexpectedCharacterInAttributeName);
+                    // Treat it as per the "anything else" entry below.
+                    cur_attr_name_.push_back(CharUtil::to_ascii_lower(ch));
+                } else {
+                    // Anything else
+                    // Append the current input character to the current attribute's
+                    // name.
+                    // ASCII upper alpha - Append the lowercase version of the current
+                    // input character (add 0x0020 to the character's code point) to the
+                    // current attribute's name.
+                    cur_attr_name_.push_back(CharUtil::to_ascii_lower(ch));
+                }
+            } else {
+                // EOF - Reconsume in the after attribute name state.
+                reconsume_ = true;
+                state_ = State::AfterAttributeName;
+            }
+            break;
+        case State::AfterAttributeName:
+            // https://html.spec.whatwg.org/multipage/parsing.html#after-attribute-name-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE - Ignore the character.
+                    continue;
+                } else if (ch == '/') {
+                    // U+002F SOLIDUS (/) - Switch to the self-closing start tag state.
+                    state_ = State::SelfClosingStartTag;
+                } else if (ch == '=') {
+                    // U+003D EQUALS SIGN (=)
+                    // Switch to the before attribute value state.
+                    state_ = State::BeforeAttributeValue;
+                } else if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // Switch to the data state. Emit the current tag token.
+                    state_ = State::Data;
+                    emit_cur_tag(sink);
+                    return true;
+                } else {
+                    // Start a new attribute in the current tag token.
+                    // Set that attribute name and value to the empty string.
+                    create_attr();
+                    // Reconsume in the attribute name state.
+                    reconsume_ = true;
+                    state_ = State::AttributeName;
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::BeforeAttributeValue:
+            // https://html.spec.whatwg.org/multipage/parsing.html#before-attribute-value-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE - Ignore the character.
+                    continue;
+                } else if (ch == '"') {
+                    // U+0022 QUOTATION MARK (")
+                    // Switch to the attribute value (double-quoted) state.
+                    state_ = State::AttributeValueDoubleQuoted;
+                } else if (ch == '\'') {
+                    // U+0027 APOSTROPHE (')
+                    // Switch to the attribute value (single-quoted) state.
+                    state_ = State::AttributeValueSingleQuoted;
+                } else if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // This is a missing-attribute-value parse error.
+                    report_error(sink, ParseErrorCode::MissingAttributeValue);
+                    // Switch to the data state.
+                    state_ = State::Data;
+                    // Emit the current tag token.
+                    emit_cur_tag(sink);
+                    return true;
+                } else {
+                    // Anything else
+                    // Reconsume in the attribute value (unquoted) state.
+                    reconsume_ = true;
+                    state_ = State::AttributeValueUnquoted;
+                }
+            } else {
+                // Anything else - Reconsume in the attribute value (unquoted) state.
+                reconsume_ = true;
+                state_ = State::AttributeValueUnquoted;
+            }
+            break;
+        case State::AttributeValueDoubleQuoted:
+            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-value-(double-quoted)-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '"') {
+                    // U+0022 QUOTATION MARK (")
+                    // Switch to the after attribute value (quoted) state.
+                    state_ = State::AfterAttributeValueQuoted;
+                } else if (ch == '&') {
+                    // U+0026 AMPERSAND (&)
+                    // Set the return state to the attribute value (double-quoted)
+                    // state. Switch to the character reference state.
+                    auto result = consume_char_ref(sink);
+                    if (result != CharRefResult::Continue) {
+                        return result == CharRefResult::Emitted;
+                    }
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL
+                    // This is an unexpected-null-character parse error. Append
+                    // a U+FFFD REPLACEMENT CHARACTER character to the current
+                    // attribute's value.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                    attr_values_.append(CharUtil::kReplacementCharacter);
+                } else {
+                    // Anything else - Append the current input character to the current
+                    // attribute's value.
+                    append_quoted_attr_value();
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::AttributeValueSingleQuoted:
+            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-value-(single-quoted)-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\'') {
+                    // U+0027 APOSTROPHE (')
+                    // Switch to the after attribute value (quoted) state.
+                    state_ = State::AfterAttributeValueQuoted;
+                } else if (ch == '&') {
+                    // U+0026 AMPERSAND (&)
+                    // Set the return state to the attribute value (single-quoted)
+                    // state. Switch to the character reference state.
+                    auto result = consume_char_ref(sink);
+                    if (result != CharRefResult::Continue) {
+                        return result == CharRefResult::Emitted;
+                    }
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL
+                    // This is an unexpected-null-character parse error. Append
+                    // a U+FFFD REPLACEMENT CHARACTER character to the current
+                    // attribute's value.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                    attr_values_.append(CharUtil::kReplacementCharacter);
+                } else {
+                    // Anything else - Append the current input character to the current
+                    // attribute's value.
+                    append_quoted_attr_value();
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::AttributeValueUnquoted:
+            // https://html.spec.whatwg.org/multipage/parsing.html#attribute-value-(unquoted)-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE - Switch to the before
+                    // attribute name state.
+                    state_ = State::BeforeAttributeName;
+                } else if (ch == '&') {
+                    // U+0026 AMPERSAND (&)
+                    // Set the return state to the attribute value (unquoted)
+                    // state. Switch to the character reference state.
+                    auto result = consume_char_ref(sink);
+                    if (result != CharRefResult::Continue) {
+                        return result == CharRefResult::Emitted;
+                    }
+                } else if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // Switch to the data state.
+                    // Emit the current tag token.
+                    state_ = State::Data;
+                    emit_cur_tag(sink);
+                    return true;
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL
+                    // This is an unexpected-null-character parse error. Append
+                    // a U+FFFD REPLACEMENT CHARACTER character to the current
+                    // attribute's value.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                    attr_values_.append(CharUtil::kReplacementCharacter);
+                } else if (ch == '"' || ch == '\'' || ch == '<' || ch == '=' || ch == '`') {
+                    // U+0022 QUOTATION MARK (") | U+0027 APOSTROPHE (') | U+003C
+                    // LESS-THAN SIGN (<) | U+003D EQUALS SIGN (=) | U+0060 GRAVE ACCENT
+                    // (`)
+                    // This is an unexpected-character-in-unquoted-attribute-value parse
+                    // error.
+                    report_error(sink, ParseErrorCode::UnexpectedCharacterInUnquotedAttributeValue);
+                    // Treat it as per the "anything else" entry below.
+                    attr_values_.push_back(ch);
+                } else {
+                    // Anything else - Append the current input character to the current
+                    // attribute's value.
+                    attr_values_.push_back(ch);
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::AfterAttributeValueQuoted:
+            // https://html.spec.whatwg.org/multipage/parsing.html#after-attribute-value-(quoted)-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ') {
+                    // U+0009 CHARACTER TABULATION (tab) | U+000A LINE FEED (LF) |
+                    // U+000C FORM FEED (FF) | U+0020 SPACE - Switch to the before
+                    // attribute name state.
+                    state_ = State::BeforeAttributeName;
+                } else if (ch == '/') {
+                    // U+002F SOLIDUS (/) - Switch to the self-closing start tag state.
+                    state_ = State::SelfClosingStartTag;
+                } else if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // Switch to the data state.
+                    // Emit the current tag token.
+                    state_ = State::Data;
+                    emit_cur_tag(sink);
+                    return true;
+                } else {
+                    // Anything else
+                    // This is a missing-whitespace-between-attributes parse error.
+                    report_error(sink, ParseErrorCode::MissingWhitespaceBetweenAttributes);
+                    // Reconsume in the before attribute name state.
+                    reconsume_ = true;
+                    state_ = State::BeforeAttributeName;
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::SelfClosingStartTag:
+            // https://html.spec.whatwg.org/multipage/parsing.html#self-closing-start-tag-state
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '>') {
+                    // U+003E GREATER-THAN SIGN (>)
+                    // Set the self-closing flag of the current tag token.
+                    cur_tag_self_closing_ = true;
+                    // Switch to the data state.
+                    state_ = State::Data;
+                    // Emit the current tag token.
+                    emit_cur_tag(sink);
+                    return true;
+                } else {
+                    // Anything else
+                    // This is an unexpected-solidus-in-tag parse error.
+                    report_error(sink, ParseErrorCode::UnexpectedSolidusInTag);
+                    // Reconsume in the before attribute name state.
+                    reconsume_ = true;
+                    state_ = State::BeforeAttributeName;
+                }
+            } else {
+                // This is an eof-in-tag parse error.
+                report_error(sink, ParseErrorCode::EofInTag);
+                // Emit an end-of-file token.
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::Comment:
+            // TODO: Comment & Bogus Comment
+            if (c.has_value()) {
+                auto ch = c.value();
+
+                if (ch == '>') {
+                    state_ = State::Data;
+                } else if (Policy::kHandleNul && ch == '\0') {
+                    // U+0000 NULL - This is an unexpected-null-character parse
+                    // error.
+                    report_error(sink, ParseErrorCode::UnexpectedNullCharacter);
+                } else {
+                    skip_comment();
+                }
+            } else {
+                report_error(sink, ParseErrorCode::EofInComment);
+                emit_eof(sink);
+                return true;
+            }
+            break;
+        case State::AmbiguousAmpersand:
+            // https://html.spec.whatwg.org/multipage/parsing.html#ambiguous-ampersand-state
+            if (c.has_value() && CharUtil::is_ascii_alphanumeric(c.value())) {
+                // ASCII alphanumeric
+                // If the character reference was consumed as part of an
+                // attribute, then append the current input character to the
+                // current attribute's value. Otherwise, emit the current input
+                // character as a character token.
+                if (emit_or_append_alphanumerics(sink)) {
+                    return true;
+                }
+            } else {
+                if (c == ';') {
+                    // U+003B SEMICOLON (;)
+                    // This is an unknown-named-character-reference parse error.
+                    report_error(sink, ParseErrorCode::UnknownNamedCharacterReference);
+                }
+                // Reconsume in the return state.
+                reconsume_ = true;
+                state_ = return_state_;
+            }
+            break;
+        case State::NumericCharacterReference:
+            // https://html.spec.whatwg.org/multipage/parsing.html#numeric-character-reference-state
+            if (c == 'x' || c == 'X') {
+                // U+0078 LATIN SMALL LETTER X | U+0058 LATIN CAPITAL LETTER X
+                // Append the current input character to the temporary buffer.
+                // Switch to the hexadecimal character reference start state.
+                char_ref_buffer_[char_ref_buffer_size_++] = c.value();
+                state_ = State::HexadecimalCharacterReferenceStart;
+            } else {
+                // Anything else
+                // Reconsume in the decimal character reference start state.
+                reconsume_ = true;
+                state_ = State::DecimalCharacterReferenceStart;
+            }
+            break;
+        case State::HexadecimalCharacterReferenceStart:
+        case State::DecimalCharacterReferenceStart:
+            // https://html.spec.whatwg.org/multipage/parsing.html#hexadecimal-character-reference-start-state
+            // https://html.spec.whatwg.org/multipage/parsing.html#decimal-character-reference-start-state
+            reconsume_ = true;
+            if (c.has_value()
+                && (state_ == State::HexadecimalCharacterReferenceStart
+                        ? CharUtil::is_ascii_hex_digit(c.value())
+                        : CharUtil::is_ascii_digit(c.value()))) {
+                // ASCII hex digit (ASCII digit) - Reconsume in the hexadecimal
+                // (decimal) character reference state.
+                state_ = state_ == State::HexadecimalCharacterReferenceStart
+                    ? State::HexadecimalCharacterReference
+                    : State::DecimalCharacterReference;
+            } else {
+                // Anything else
+                // This is an absence-of-digits-in-numeric-character-reference
+                // parse error. Flush code points consumed as a character
+                // reference. Reconsume in the return state.
+                report_error(sink, ParseErrorCode::AbsenceOfDigitsInNumericCharacterReference);
+                if (flush_char_ref_buffer(sink)) {
+                    return true;
+                }
+            }
+            break;
+        case State::HexadecimalCharacterReference:
+        case State::DecimalCharacterReference: {
+            // https://html.spec.whatwg.org/multipage/parsing.html#hexadecimal-character-reference-state
+            // https://html.spec.whatwg.org/multipage/parsing.html#decimal-character-reference-state
+            bool hex = state_ == State::HexadecimalCharacterReference;
+            if (c.has_value()
+                && (hex ? CharUtil::is_ascii_hex_digit(c.value()) : CharUtil::is_ascii_digit(c.value()))) {
+                // ASCII digit | ASCII upper hex digit | ASCII lower hex digit
+                // Multiply the character reference code by 16 (10). Add a
+                // numeric version of the current input character to the
+                // character reference code.
+                append_char_ref_digit(hex ? 16 : 10, c.value());
+                break;
+            }
+            if (c != ';') {
+                // Anything else
+                // This is a missing-semicolon-after-character-reference parse
+                // error. Reconsume in the numeric character reference end state.
+                report_error(sink, ParseErrorCode::MissingSemicolonAfterCharacterReference);
+                reconsume_ = true;
+            }
+            // U+003B SEMICOLON - Switch to the numeric character reference end
+            // state.
+            if (finish_numeric_char_ref(sink)) {
+                return true;
+            }
+            break;
+        }
+        }
+    }
+}
+
+template <typename Policy>
+template <typename Sink>
+bool BasicTokenizer<Policy>::step_table(Sink& sink)
+{
+    using A = TransitionAction;
+
+    while (true) {
+        if (!reconsume_ && pos_ >= input_.size() && !finished_) {
+            return false;
+        }
+
+        auto c = peek();
+        const auto& row = kTransitionTable[static_cast<std::size_t>(state_)];
+        const auto& t = c.has_value()
+            ? row.on_class[static_cast<std::size_t>(char_class<Policy::kHandleNul>(c.value()))]
+            : row.on_eof;
+        auto ch = c.value_or('\0');
+
+        if (t.error != ParseErrorCode::None) {
+            report_error(sink, t.error);
+        }
+        reconsume_ = t.reconsume;
+        state_ = t.next;
+
+        switch (t.action) {
+        case A::None:
+            break;
+        case A::MarkTagOpen:
+            mark_tag_open();
+            break;
+        case A::EmitText:
+            emit_data_text(sink, ch);
+            return true;
+        case A::EmitLessThan:
+            sink.on_char('<', tag_open_offset_);
+            return true;
+        case A::CreateStartTag:
+            create_start_tag();
+            break;
+        case A::CreateEndTag:
+            create_end_tag();
+            break;
+        case A::AppendTagName:
+            cur_tag_name_.push_back(CharUtil::to_ascii_lower(ch));
+            break;
+        case A::AppendTagNameReplacement:
+            cur_tag_name_.append(CharUtil::kReplacementCharacter);
+            break;
+        case A::EmitTag:
+            emit_cur_tag(sink);
+            return true;
+        case A::EmitSelfClosingTag:
+            cur_tag_self_closing_ = true;
+            emit_cur_tag(sink);
+            return true;
+        case A::CreateAttr:
+            create_attr();
+            break;
+        case A::CreateAttrWithChar:
+            create_attr();
+            cur_attr_name_.push_back(ch);
+            break;
+        case A::AppendAttrName:
+            cur_attr_name_.push_back(CharUtil::to_ascii_lower(ch));
+            break;
+        case A::AppendAttrNameReplacement:
+            cur_attr_name_.append(CharUtil::kReplacementCharacter);
+            break;
+        case A::AppendAttrValue:
+            attr_values_.push_back(ch);
+            break;
+        case A::AppendAttrValueReplacement:
+            attr_values_.append(CharUtil::kReplacementCharacter);
+            break;
+        case A::AppendQuotedAttrValue:
+            append_quoted_attr_value();
+            break;
+        case A::SkipComment:
+            skip_comment();
+            break;
+        case A::ConsumeCharRef: {
+            auto result = consume_char_ref(sink);
+            if (result != CharRefResult::Continue) {
+                return result == CharRefResult::Emitted;
+            }
+            break;
+        }
+        case A::EmitOrAppendChar:
+            if (emit_or_append_alphanumerics(sink)) {
+                return true;
+            }
+            break;
+        case A::AppendToCharRefBuffer:
+            char_ref_buffer_[char_ref_buffer_size_++] = ch;
+            break;
+        case A::FlushCharRefBuffer:
+            if (flush_char_ref_buffer(sink)) {
+                return true;
+            }
+            break;
+        case A::AppendHexDigit:
+            append_char_ref_digit(16, ch);
+            break;
+        case A::AppendDecimalDigit:
+            append_char_ref_digit(10, ch);
+            break;
+        case A::FinishNumericCharRef:
+            if (finish_numeric_char_ref(sink)) {
+                return true;
+            }
+            break;
+        case A::Return:
+            state_ = return_state_;
+            break;
+        case A::EmitEof:
+            emit_eof(sink);
+            return true;
+        case A::EmitLessThanAndEof:
+            sink.on_char('<', tag_open_offset_);
+            emit_eof(sink);
+            return true;
+        case A::EmitLessThanSolidusAndEof:
+            sink.on_char('<', tag_open_offset_);
+            sink.on_char('/', tag_open_offset_ + 1);
+            emit_eof(sink);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#include "tokenizer_stats.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "state.h"
+#include "token.h"
+
+namespace {
+
+constexpr std::string_view kTokenKindNames[] = {
+    "start-tag",
+    "end-tag",
+    "character",
+    "text-run",
+    "end-of-file",
+};
+static_assert(std::size(kTokenKindNames) == TokenizerStats::kTokenKindCount);
+
+template <typename Array>
+void add(Array& into, const Array& from)
+{
+    for (std::size_t i = 0; i < into.size(); i++) {
+        into[i] += from[i];
+    }
+}
+
+template <typename Array>
+void append_array(std::string& out, const Array& counts)
+{
+    out += '[';
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        fmt::format_to(std::back_inserter(out), "{}{}", i > 0 ? "," : "", counts[i]);
+    }
+    out += ']';
+}
+
+} // namespace
+
+void TokenizerStats::count_tag(const TagView& tag)
+{
+    count_token(tag.kind == TokenTag::Kind::Start ? Token::Kind::StartTag : Token::Kind::EndTag);
+    attributes_per_tag[std::min(tag.attributes.size(), kAttributeBuckets - 1)]++;
+}
+
+void TokenizerStats::count_text_run(std::size_t bytes)
+{
+    count_token(Token::Kind::TextRun);
+    std::size_t bucket = 0;
+    while (bucket + 1 < kTextRunBuckets && bytes >= std::size_t { 2 } << bucket) {
+        bucket++;
+    }
+    text_run_bytes[bucket]++;
+}
+
+TokenizerStats& TokenizerStats::operator+=(const TokenizerStats& other)
+{
+    add(state_bytes, other.state_bytes);
+    for (std::size_t from = 0; from < kStateCount; from++) {
+        add(transitions[from], other.transitions[from]);
+    }
+    reconsumes += other.reconsumes;
+    pending_tokens += other.pending_tokens;
+    add(tokens, other.tokens);
+    add(attributes_per_tag, other.attributes_per_tag);
+    add(text_run_bytes, other.text_run_bytes);
+    return *this;
+}
+
+std::string TokenizerStats::to_json() const
+{
+    // Names are plain ASCII, so they need no escaping.
+    std::string out = "{\"state_bytes\":{";
+    for (std::size_t i = 0; i < kStateCount; i++) {
+        fmt::format_to(std::back_inserter(out), "{}\"{}\":{}", i > 0 ? "," : "",
+            name_of(static_cast<State>(i)), state_bytes[i]);
+    }
+
+    out += "},\"transitions\":[";
+    bool first = true;
+    for (std::size_t from = 0; from < kStateCount; from++) {
+        for (std::size_t to = 0; to < kStateCount; to++) {
+            if (transitions[from][to] == 0) {
+                continue;
+            }
+            fmt::format_to(std::back_inserter(out), "{}{{\"from\":\"{}\",\"to\":\"{}\",\"count\":{}}}",
+                first ? "" : ",", name_of(static_cast<State>(from)), name_of(static_cast<State>(to)),
+                transitions[from][to]);
+            first = false;
+        }
+    }
+
+    fmt::format_to(std::back_inserter(out), "],\"reconsumes\":{},\"pending_tokens\":{},\"tokens\":{{",
+        reconsumes, pending_tokens);
+    for (std::size_t i = 0; i < kTokenKindCount; i++) {
+        fmt::format_to(std::back_inserter(out), "{}\"{}\":{}", i > 0 ? "," : "", kTokenKindNames[i], tokens[i]);
+    }
+
+    out += "},\"attributes_per_tag\":";
+    append_array(out, attributes_per_tag);
+    out += ",\"text_run_bytes_log2\":";
+    append_array(out, text_run_bytes);
+    out += '}';
+    return out;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "parse_error.h"
+#include "state.h"
+#include "token.h"
+
+/// @brief Where the tokenizer spends its work on a given input, for tuning it
+/// on real page mixes.
+///
+/// Only builds configured with the EVEN_TOKENIZER_STATS CMake option collect
+/// them, see BasicTokenizer::stats(). Other builds have no counters in the
+/// tokenizer at all.
+struct TokenizerStats {
+    static constexpr std::size_t kTokenKindCount = static_cast<std::size_t>(Token::Kind::EndOfFile) + 1;
+    /// @brief Tags with 0 to 15 attributes, then 16 or more.
+    static constexpr std::size_t kAttributeBuckets = 17;
+    /// @brief Bucket i holds text runs of [2^i, 2^(i+1)) bytes, the last one
+    /// everything longer.
+    static constexpr std::size_t kTextRunBuckets = 21;
+
+    /// @brief Input bytes each state looked at, one at a time or in bulk. A
+    /// reconsumed byte counts for every state that looks at it.
+    std::array<std::uint64_t, kStateCount> state_bytes {};
+    /// @brief transitions[from][to]: how often `to` took over from `from`.
+    /// Counted when `to` looks at its first input.
+    std::array<std::array<std::uint64_t, kStateCount>, kStateCount> transitions {};
+    std::uint64_t reconsumes = 0;
+    /// @brief Tokens that waited in the pull API's pending buffer because the
+    /// step that produced them produced another one first.
+    std::uint64_t pending_tokens = 0;
+    /// @brief Indexed by Token::Kind.
+    std::array<std::uint64_t, kTokenKindCount> tokens {};
+    std::array<std::uint64_t, kAttributeBuckets> attributes_per_tag {};
+    std::array<std::uint64_t, kTextRunBuckets> text_run_bytes {};
+
+    void count_token(Token::Kind kind) { tokens[static_cast<std::size_t>(kind)]++; }
+    void count_tag(const TagView& tag);
+    void count_text_run(std::size_t bytes);
+
+    /// @brief Adds up the stats of several tokenizers, e.g. one per thread.
+    TokenizerStats& operator+=(const TokenizerStats& other);
+
+    /// @brief A JSON object of all counters, with states and token kinds by
+    /// name. Transitions that never happened are left out.
+    std::string to_json() const;
+
+    /// @brief Sink that counts the tokens passing through to `Sink`.
+    template <typename Sink, bool = HasParseErrorHandler<Sink>::value>
+    struct Recorder {
+        Sink& sink;
+        TokenizerStats& stats;
+
+        Recorder(Sink& sink, TokenizerStats& stats)
+            : sink(sink)
+            , stats(stats)
+        {
+        }
+
+        void on_start_tag(const TagView& tag)
+        {
+            stats.count_tag(tag);
+            sink.on_start_tag(tag);
+        }
+        void on_end_tag(const TagView& tag)
+        {
+            stats.count_tag(tag);
+            sink.on_end_tag(tag);
+        }
+        void on_text(std::string_view text, std::uint32_t offset)
+        {
+            stats.count_text_run(text.size());
+            sink.on_text(text, offset);
+        }
+        void on_char(char ch, std::uint32_t offset)
+        {
+            stats.count_token(Token::Kind::Character);
+            sink.on_char(ch, offset);
+        }
+        void on_eof()
+        {
+            stats.count_token(Token::Kind::EndOfFile);
+            sink.on_eof();
+        }
+    };
+
+    /// @brief Passes parse errors on as well, only when `Sink` takes them, so
+    /// that counting does not make the tokenizer report errors it would
+    /// otherwise skip.
+    template <typename Sink>
+    struct Recorder<Sink, true> : Recorder<Sink, false> {
+        using Recorder<Sink, false>::Recorder;
+
+        void on_parse_error(ParseError error) { this->sink.on_parse_error(error); }
+    };
+};
@@ -0,0 +1,369 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include "../util/char_util.h"
+#include "parse_error.h"
+#include "state.h"
+
+/// @brief Classes of input characters that some tokenizer state tells apart.
+/// Characters in the same class behave the same in every state.
+enum class CharClass : std::uint8_t {
+    Other,
+    /// @brief U+0000 NULL
+    Null,
+    /// @brief U+0009 TAB, U+000A LF, U+000C FF, U+0020 SPACE
+    Whitespace,
+    Solidus,
+    GreaterThan,
+    LessThan,
+    Equals,
+    QuotationMark,
+    Apostrophe,
+    GraveAccent,
+    ExclamationMark,
+    QuestionMark,
+    Ampersand,
+    NumberSign,
+    Semicolon,
+    Digit,
+    /// @brief A-F, which are also hex digits.
+    UpperHexAlpha,
+    /// @brief a-f, which are also hex digits.
+    LowerHexAlpha,
+    UpperX,
+    LowerX,
+    /// @brief The other ASCII upper alphas.
+    UpperAlpha,
+    /// @brief The other ASCII lower alphas.
+    LowerAlpha,
+};
+
+constexpr std::size_t kCharClassCount = static_cast<std::size_t>(CharClass::LowerAlpha) + 1;
+
+constexpr std::initializer_list<CharClass> kAsciiUpperAlpha = {
+    CharClass::UpperHexAlpha, CharClass::UpperX, CharClass::UpperAlpha
+};
+constexpr std::initializer_list<CharClass> kAsciiLowerAlpha = {
+    CharClass::LowerHexAlpha, CharClass::LowerX, CharClass::LowerAlpha
+};
+constexpr std::initializer_list<CharClass> kAsciiAlphanumeric = {
+    CharClass::Digit, CharClass::UpperHexAlpha, CharClass::UpperX, CharClass::UpperAlpha,
+    CharClass::LowerHexAlpha, CharClass::LowerX, CharClass::LowerAlpha
+};
+constexpr std::initializer_list<CharClass> kAsciiHexDigit = {
+    CharClass::Digit, CharClass::UpperHexAlpha, CharClass::LowerHexAlpha
+};
+
+/// @brief With `classify_null` unset, U+0000 NULL is CharClass::Other, as for
+/// tokenizer policies that do not handle it.
+constexpr std::array<CharClass, 256> make_char_classes(bool classify_null)
+{
+    std::array<CharClass, 256> classes {};
+    for (int c = 0; c < 256; c++) {
+        auto ch = static_cast<char>(c);
+        if (CharUtil::has_flags(ch, CharUtil::kUpperAlpha)) {
+            classes[c] = CharClass::UpperAlpha;
+        } else if (CharUtil::has_flags(ch, CharUtil::kLowerAlpha)) {
+            classes[c] = CharClass::LowerAlpha;
+        }
+    }
+    for (unsigned char c : { '\t', '\n', '\f', ' ' }) {
+        classes[c] = CharClass::Whitespace;
+    }
+    classes['/'] = CharClass::Solidus;
+    classes['>'] = CharClass::GreaterThan;
+    classes['<'] = CharClass::LessThan;
+    classes['='] = CharClass::Equals;
+    classes['"'] = CharClass::QuotationMark;
+    classes['\''] = CharClass::Apostrophe;
+    classes['`'] = CharClass::GraveAccent;
+    classes['!'] = CharClass::ExclamationMark;
+    classes['?'] = CharClass::QuestionMark;
+    classes[0] = classify_null ? CharClass::Null : CharClass::Other;
+    classes['&'] = CharClass::Ampersand;
+    classes['#'] = CharClass::NumberSign;
+    classes[';'] = CharClass::Semicolon;
+    for (int c = '0'; c <= '9'; c++) {
+        classes[c] = CharClass::Digit;
+    }
+    for (int c = 0; c < 6; c++) {
+        classes['A' + c] = CharClass::UpperHexAlpha;
+        classes['a' + c] = CharClass::LowerHexAlpha;
+    }
+    classes['X'] = CharClass::UpperX;
+    classes['x'] = CharClass::LowerX;
+    return classes;
+}
+
+inline constexpr std::array<CharClass, 256> kCharClasses = make_char_classes(true);
+inline constexpr std::array<CharClass, 256> kCharClassesWithoutNull = make_char_classes(false);
+
+template <bool kClassifyNull = true>
+constexpr CharClass char_class(char c)
+{
+    if constexpr (kClassifyNull) {
+        return kCharClasses[static_cast<unsigned char>(c)];
+    } else {
+        return kCharClassesWithoutNull[static_cast<unsigned char>(c)];
+    }
+}
+
+/// @brief The work a transition does besides switching state.
+enum class TransitionAction : std::uint8_t {
+    None,
+    /// @brief Remember where the markup this '<' starts is.
+    MarkTagOpen,
+    /// @brief Emit the current character, or the text run it starts.
+    EmitText,
+    /// @brief Emit a U+003C LESS-THAN SIGN character token.
+    EmitLessThan,
+    CreateStartTag,
+    CreateEndTag,
+    /// @brief Append the lowercased character to the tag name.
+    AppendTagName,
+    /// @brief Append U+FFFD to the tag name.
+    AppendTagNameReplacement,
+    EmitTag,
+    /// @brief Set the self-closing flag and emit the tag.
+    EmitSelfClosingTag,
+    /// @brief Start a new attribute with an empty name.
+    CreateAttr,
+    /// @brief Start a new attribute whose name is the current character.
+    CreateAttrWithChar,
+    /// @brief Append the lowercased character to the attribute name.
+    AppendAttrName,
+    /// @brief Append U+FFFD to the attribute name.
+    AppendAttrNameReplacement,
+    AppendAttrValue,
+    /// @brief Append U+FFFD to the attribute value.
+    AppendAttrValueReplacement,
+    /// @brief Append the character and everything up to the closing quote.
+    AppendQuotedAttrValue,
+    /// @brief Skip to the next '>'.
+    SkipComment,
+    /// @brief Start a character reference at the current '&'; see
+    /// Tokenizer::consume_char_ref(). It may need more input.
+    ConsumeCharRef,
+    /// @brief Emit the current character, or append it to the attribute value
+    /// when the return state is an attribute value state.
+    EmitOrAppendChar,
+    /// @brief Append the current 'x' or 'X' to the temporary buffer.
+    AppendToCharRefBuffer,
+    /// @brief Flush the temporary buffer as text and switch to the return
+    /// state.
+    FlushCharRefBuffer,
+    AppendHexDigit,
+    AppendDecimalDigit,
+    /// @brief Run the numeric character reference end state.
+    FinishNumericCharRef,
+    /// @brief Switch to the return state instead of `next`.
+    Return,
+    EmitEof,
+    /// @brief Emit '<' and an end-of-file token.
+    EmitLessThanAndEof,
+    /// @brief Emit '<', '/' and an end-of-file token.
+    EmitLessThanSolidusAndEof,
+};
+
+struct Transition {
+    State next = State::Data;
+    TransitionAction action = TransitionAction::None;
+    bool reconsume = false;
+    /// @brief Parse error to report, if any.
+    ParseErrorCode error = ParseErrorCode::None;
+};
+
+/// @brief One row per state: the transition for each character class, plus
+/// the one taken at end of file.
+struct StateTransitions {
+    std::array<Transition, kCharClassCount> on_class {};
+    Transition on_eof {};
+
+    constexpr void set_default(Transition t)
+    {
+        for (auto& entry : on_class) {
+            entry = t;
+        }
+    }
+
+    constexpr void set(CharClass c, Transition t)
+    {
+        on_class[static_cast<std::size_t>(c)] = t;
+    }
+
+    constexpr void set(std::initializer_list<CharClass> classes, Transition t)
+    {
+        for (auto c : classes) {
+            set(c, t);
+        }
+    }
+};
+
+/// @brief The tokenizer state machine as data. It mirrors the `switch` in
+/// Tokenizer::step_switch() entry for entry, including its TODOs.
+/// https://html.spec.whatwg.org/multipage/parsing.html#tokenization
+constexpr std::array<StateTransitions, kStateCount> make_transition_table()
+{
+    using A = TransitionAction;
+    using C = CharClass;
+    using E = ParseErrorCode;
+    using S = State;
+
+    std::array<StateTransitions, kStateCount> table {};
+    auto row = [&table](State s) -> StateTransitions& {
+        return table[static_cast<std::size_t>(s)];
+    };
+
+    auto& data = row(S::Data);
+    data.set_default({ S::Data, A::EmitText });
+    data.set(C::LessThan, { S::TagOpen, A::MarkTagOpen });
+    data.set(C::Ampersand, { S::Data, A::ConsumeCharRef });
+    data.set(C::Null, { S::Data, A::EmitText, false, E::UnexpectedNullCharacter });
+    data.on_eof = { S::Data, A::EmitEof };
+
+    auto& tag_open = row(S::TagOpen);
+    tag_open.set_default({ S::Data, A::EmitLessThan, true, E::InvalidFirstCharacterOfTagName });
+    tag_open.set(C::ExclamationMark, { S::Comment });
+    tag_open.set(C::Solidus, { S::EndTagOpen });
+    tag_open.set(kAsciiUpperAlpha, { S::TagName, A::CreateStartTag, true });
+    tag_open.set(kAsciiLowerAlpha, { S::TagName, A::CreateStartTag, true });
+    tag_open.set(C::QuestionMark, { S::Comment, A::None, true, E::UnexpectedQuestionMarkInsteadOfTagName });
+    tag_open.on_eof = { S::TagOpen, A::EmitLessThanAndEof, false, E::EofBeforeTagName };
+
+    auto& end_tag_open = row(S::EndTagOpen);
+    end_tag_open.set_default({ S::Comment, A::None, true, E::InvalidFirstCharacterOfTagName });
+    end_tag_open.set(kAsciiUpperAlpha, { S::TagName, A::CreateEndTag, true });
+    end_tag_open.set(kAsciiLowerAlpha, { S::TagName, A::CreateEndTag, true });
+    end_tag_open.set(C::GreaterThan, { S::Data, A::None, false, E::MissingEndTagName });
+    end_tag_open.on_eof = { S::EndTagOpen, A::EmitLessThanSolidusAndEof, false, E::EofBeforeTagName };
+
+    auto& tag_name = row(S::TagName);
+    tag_name.set_default({ S::TagName, A::AppendTagName });
+    tag_name.set(C::Whitespace, { S::BeforeAttributeName });
+    tag_name.set(C::Solidus, { S::SelfClosingStartTag });
+    tag_name.set(C::GreaterThan, { S::Data, A::EmitTag });
+    tag_name.set(C::Null, { S::TagName, A::AppendTagNameReplacement, false, E::UnexpectedNullCharacter });
+    tag_name.on_eof = { S::TagName, A::EmitEof, false, E::EofInTag };
+
+    auto& before_attr_name = row(S::BeforeAttributeName);
+    before_attr_name.set_default({ S::AttributeName, A::CreateAttr, true });
+    before_attr_name.set(C::Whitespace, { S::BeforeAttributeName });
+    before_attr_name.set(C::Solidus, { S::AfterAttributeName, A::None, true });
+    before_attr_name.set(C::GreaterThan, { S::AfterAttributeName, A::None, true });
+    before_attr_name.set(C::Equals, { S::AttributeName, A::CreateAttrWithChar, false, E::UnexpectedEqualsSignBeforeAttributeName });
+    before_attr_name.on_eof = { S::AfterAttributeName, A::None, true };
+
+    auto& attr_name = row(S::AttributeName);
+    attr_name.set_default({ S::AttributeName, A::AppendAttrName });
+    attr_name.set(C::Whitespace, { S::AfterAttributeName, A::None, true });
+    attr_name.set(C::Solidus, { S::AfterAttributeName, A::None, true });
+    attr_name.set(C::GreaterThan, { S::AfterAttributeName, A::None, true });
+    attr_name.set(C::Equals, { S::BeforeAttributeValue });
+    attr_name.set(C::Null, { S::AttributeName, A::AppendAttrNameReplacement, false, E::UnexpectedNullCharacter });
+    for (auto c : { C::QuotationMark, C::Apostrophe, C::LessThan }) {
+        attr_name.set(c, { S::AttributeName, A::AppendAttrName, false, E::UnexpectedCharacterInAttributeName });
+    }
+    attr_name.on_eof = { S::AfterAttributeName, A::None, true };
+
+    auto& after_attr_name = row(S::AfterAttributeName);
+    after_attr_name.set_default({ S::AttributeName, A::CreateAttr, true });
+    after_attr_name.set(C::Whitespace, { S::AfterAttributeName });
+    after_attr_name.set(C::Solidus, { S::SelfClosingStartTag });
+    after_attr_name.set(C::Equals, { S::BeforeAttributeValue });
+    after_attr_name.set(C::GreaterThan, { S::Data, A::EmitTag });
+    after_attr_name.on_eof = { S::AfterAttributeName, A::EmitEof, false, E::EofInTag };
+
+    auto& before_attr_value = row(S::BeforeAttributeValue);
+    before_attr_value.set_default({ S::AttributeValueUnquoted, A::None, true });
+    before_attr_value.set(C::Whitespace, { S::BeforeAttributeValue });
+    before_attr_value.set(C::QuotationMark, { S::AttributeValueDoubleQuoted });
+    before_attr_value.set(C::Apostrophe, { S::AttributeValueSingleQuoted });
+    before_attr_value.set(C::GreaterThan, { S::Data, A::EmitTag, false, E::MissingAttributeValue });
+    before_attr_value.on_eof = { S::AttributeValueUnquoted, A::None, true };
+
+    auto& double_quoted = row(S::AttributeValueDoubleQuoted);
+    double_quoted.set_default({ S::AttributeValueDoubleQuoted, A::AppendQuotedAttrValue });
+    double_quoted.set(C::QuotationMark, { S::AfterAttributeValueQuoted });
+    double_quoted.set(C::Ampersand, { S::AttributeValueDoubleQuoted, A::ConsumeCharRef });
+    double_quoted.set(C::Null, { S::AttributeValueDoubleQuoted, A::AppendAttrValueReplacement, false, E::UnexpectedNullCharacter });
+    double_quoted.on_eof = { S::AttributeValueDoubleQuoted, A::EmitEof, false, E::EofInTag };
+
+    auto& single_quoted = row(S::AttributeValueSingleQuoted);
+    single_quoted.set_default({ S::AttributeValueSingleQuoted, A::AppendQuotedAttrValue });
+    single_quoted.set(C::Apostrophe, { S::AfterAttributeValueQuoted });
+    single_quoted.set(C::Ampersand, { S::AttributeValueSingleQuoted, A::ConsumeCharRef });
+    single_quoted.set(C::Null, { S::AttributeValueSingleQuoted, A::AppendAttrValueReplacement, false, E::UnexpectedNullCharacter });
+    single_quoted.on_eof = { S::AttributeValueSingleQuoted, A::EmitEof, false, E::EofInTag };
+
+    auto& unquoted = row(S::AttributeValueUnquoted);
+    unquoted.set_default({ S::AttributeValueUnquoted, A::AppendAttrValue });
+    unquoted.set(C::Whitespace, { S::BeforeAttributeName });
+    unquoted.set(C::GreaterThan, { S::Data, A::EmitTag });
+    unquoted.set(C::Ampersand, { S::AttributeValueUnquoted, A::ConsumeCharRef });
+    unquoted.set(C::Null, { S::AttributeValueUnquoted, A::AppendAttrValueReplacement, false, E::UnexpectedNullCharacter });
+    for (auto c : { C::QuotationMark, C::Apostrophe, C::LessThan, C::Equals, C::GraveAccent }) {
+        unquoted.set(c, { S::AttributeValueUnquoted, A::AppendAttrValue, false, E::UnexpectedCharacterInUnquotedAttributeValue });
+    }
+    unquoted.on_eof = { S::AttributeValueUnquoted, A::EmitEof, false, E::EofInTag };
+
+    auto& after_attr_value = row(S::AfterAttributeValueQuoted);
+    after_attr_value.set_default({ S::BeforeAttributeName, A::None, true, E::MissingWhitespaceBetweenAttributes });
+    after_attr_value.set(C::Whitespace, { S::BeforeAttributeName });
+    after_attr_value.set(C::Solidus, { S::SelfClosingStartTag });
+    after_attr_value.set(C::GreaterThan, { S::Data, A::EmitTag });
+    after_attr_value.on_eof = { S::AfterAttributeValueQuoted, A::EmitEof, false, E::EofInTag };
+
+    auto& self_closing = row(S::SelfClosingStartTag);
+    self_closing.set_default({ S::BeforeAttributeName, A::None, true, E::UnexpectedSolidusInTag });
+    self_closing.set(C::GreaterThan, { S::Data, A::EmitSelfClosingTag });
+    self_closing.on_eof = { S::SelfClosingStartTag, A::EmitEof, false, E::EofInTag };
+
+    auto& comment = row(S::Comment);
+    comment.set_default({ S::Comment, A::SkipComment });
+    comment.set(C::GreaterThan, { S::Data });
+    comment.set(C::Null, { S::Comment, A::None, false, E::UnexpectedNullCharacter });
+    comment.on_eof = { S::Comment, A::EmitEof, false, E::EofInComment };
+
+    // The character reference states leave through the return state, so
+    // their `next` only matters when the action does not override it.
+    auto& ambiguous = row(S::AmbiguousAmpersand);
+    ambiguous.set_default({ S::AmbiguousAmpersand, A::Return, true });
+    ambiguous.set(kAsciiAlphanumeric, { S::AmbiguousAmpersand, A::EmitOrAppendChar });
+    ambiguous.set(C::Semicolon, { S::AmbiguousAmpersand, A::Return, true, E::UnknownNamedCharacterReference });
+    ambiguous.on_eof = { S::AmbiguousAmpersand, A::Return, true };
+
+    auto& numeric = row(S::NumericCharacterReference);
+    numeric.set_default({ S::DecimalCharacterReferenceStart, A::None, true });
+    numeric.set({ C::UpperX, C::LowerX }, { S::HexadecimalCharacterReferenceStart, A::AppendToCharRefBuffer });
+    numeric.on_eof = { S::DecimalCharacterReferenceStart, A::None, true };
+
+    auto& hex_start = row(S::HexadecimalCharacterReferenceStart);
+    hex_start.set_default({ S::HexadecimalCharacterReferenceStart, A::FlushCharRefBuffer, true, E::AbsenceOfDigitsInNumericCharacterReference });
+    hex_start.set(kAsciiHexDigit, { S::HexadecimalCharacterReference, A::None, true });
+    hex_start.on_eof = hex_start.on_class[static_cast<std::size_t>(C::Other)];
+
+    auto& decimal_start = row(S::DecimalCharacterReferenceStart);
+    decimal_start.set_default({ S::DecimalCharacterReferenceStart, A::FlushCharRefBuffer, true, E::AbsenceOfDigitsInNumericCharacterReference });
+    decimal_start.set(C::Digit, { S::DecimalCharacterReference, A::None, true });
+    decimal_start.on_eof = decimal_start.on_class[static_cast<std::size_t>(C::Other)];
+
+    auto& hex = row(S::HexadecimalCharacterReference);
+    hex.set_default({ S::HexadecimalCharacterReference, A::FinishNumericCharRef, true, E::MissingSemicolonAfterCharacterReference });
+    hex.set(kAsciiHexDigit, { S::HexadecimalCharacterReference, A::AppendHexDigit });
+    hex.set(C::Semicolon, { S::HexadecimalCharacterReference, A::FinishNumericCharRef });
+    hex.on_eof = hex.on_class[static_cast<std::size_t>(C::Other)];
+
+    auto& decimal = row(S::DecimalCharacterReference);
+    decimal.set_default({ S::DecimalCharacterReference, A::FinishNumericCharRef, true, E::MissingSemicolonAfterCharacterReference });
+    decimal.set(C::Digit, { S::DecimalCharacterReference, A::AppendDecimalDigit });
+    decimal.set(C::Semicolon, { S::DecimalCharacterReference, A::FinishNumericCharRef });
+    decimal.on_eof = decimal.on_class[static_cast<std::size_t>(C::Other)];
+
+    return table;
+}
+
+inline constexpr std::array<StateTransitions, kStateCount> kTransitionTable = make_transition_table();
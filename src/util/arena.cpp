@@ -0,0 +1,73 @@
+#include "arena.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+Arena::Arena()
+    : next_block_size_(kInitialBlockSize)
+{
+}
+
+Arena::~Arena() { release(); }
+
+void* Arena::allocate_slow(std::size_t size, std::size_t align)
+{
+    // Room for the header and for aligning the first allocation.
+    std::size_t needed = sizeof(Block) + size + align;
+    std::size_t block_size = std::max(next_block_size_, needed);
+
+    auto* block = static_cast<Block*>(std::malloc(block_size));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    block->next = blocks_;
+    block->size = block_size;
+    blocks_ = block;
+    bytes_allocated_ += block_size;
+
+    // Oversized requests get a block of their own; the next regular block
+    // keeps growing geometrically up to the cap.
+    if (needed <= next_block_size_) {
+        next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+    }
+
+    cur_ = reinterpret_cast<char*>(block + 1);
+    end_ = reinterpret_cast<char*>(block) + block_size;
+    return allocate(size, align);
+}
+
+std::string_view Arena::copy(std::string_view s)
+{
+    if (s.empty()) {
+        return {};
+    }
+
+    auto* data = allocate_array<char>(s.size());
+    std::memcpy(data, s.data(), s.size());
+    return { data, s.size() };
+}
+
+void Arena::reserve(std::size_t bytes)
+{
+    next_block_size_ = std::max(next_block_size_, std::min(bytes, kMaxBlockSize));
+}
+
+void Arena::release()
+{
+    while (blocks_) {
+        auto* next = blocks_->next;
+        std::free(blocks_);
+        blocks_ = next;
+    }
+    cur_ = nullptr;
+    end_ = nullptr;
+    bytes_allocated_ = 0;
+}
+
+void Arena::reset()
+{
+    release();
+    next_block_size_ = kInitialBlockSize;
+}
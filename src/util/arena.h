@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <utility>
+
+/// @brief Bump allocator that frees everything at once.
+///
+/// Allocations are carved out of large blocks and are never freed one by one.
+/// Destroying (or resetting) the arena releases all blocks without running
+/// any destructors, so objects placed in it must not own other resources.
+class Arena {
+private:
+    struct Block {
+        Block* next;
+        std::size_t size;
+    };
+
+    Block* blocks_ = nullptr;
+    char* cur_ = nullptr;
+    char* end_ = nullptr;
+    std::size_t next_block_size_;
+    std::size_t bytes_allocated_ = 0;
+
+    void* allocate_slow(std::size_t size, std::size_t align);
+    void release();
+
+public:
+    static constexpr std::size_t kInitialBlockSize = 4 * 1024;
+    static constexpr std::size_t kMaxBlockSize = 1024 * 1024;
+
+    Arena();
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t align)
+    {
+        auto addr = reinterpret_cast<std::uintptr_t>(cur_);
+        auto aligned = (addr + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1);
+        if (cur_ && aligned + size <= reinterpret_cast<std::uintptr_t>(end_)) {
+            cur_ = reinterpret_cast<char*>(aligned + size);
+            return reinterpret_cast<void*>(aligned);
+        }
+        return allocate_slow(size, align);
+    }
+
+    /// @brief Constructs a T in the arena. Its destructor is never called.
+    template <typename T, typename... Args>
+    T* make(Args&&... args)
+    {
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /// @brief Uninitialized storage for `count` objects of type T.
+    template <typename T>
+    T* allocate_array(std::size_t count)
+    {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /// @brief Copies a string into the arena.
+    std::string_view copy(std::string_view s);
+
+    /// @brief Makes the next block at least `bytes` large, up to
+    /// kMaxBlockSize, for when the total is roughly known up front.
+    void reserve(std::size_t bytes);
+
+    /// @brief Releases every block, invalidating all allocations.
+    void reset();
+
+    /// @brief Bytes obtained from the system for blocks.
+    std::size_t bytes_allocated() const { return bytes_allocated_; }
+};
@@ -1,32 +1,146 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
 namespace CharUtil {
 
+/// @brief Bit flags describing a byte, see kCharFlags.
+enum CharFlag : std::uint8_t {
+    kLowerAlpha = 1 << 0,
+    kUpperAlpha = 1 << 1,
+    kDigit = 1 << 2,
+    kHtmlWhitespace = 1 << 3,
+};
+
+constexpr std::array<std::uint8_t, 256> make_char_flags()
+{
+    std::array<std::uint8_t, 256> flags {};
+    for (int c = 'a'; c <= 'z'; c++) {
+        flags[c] |= kLowerAlpha;
+    }
+    for (int c = 'A'; c <= 'Z'; c++) {
+        flags[c] |= kUpperAlpha;
+    }
+    for (int c = '0'; c <= '9'; c++) {
+        flags[c] |= kDigit;
+    }
+    for (unsigned char c : { ' ', '\t', '\n', '\r', '\f' }) {
+        flags[c] |= kHtmlWhitespace;
+    }
+    return flags;
+}
+
+/// @brief Flags of every byte value, so that each test below is one load and
+/// one mask instead of a chain of comparisons.
+inline constexpr std::array<std::uint8_t, 256> kCharFlags = make_char_flags();
+
+constexpr bool has_flags(char c, std::uint8_t mask)
+{
+    return (kCharFlags[static_cast<unsigned char>(c)] & mask) != 0;
+}
+
 constexpr bool is_ascii_alpha(char c)
 {
-    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    return has_flags(c, kLowerAlpha | kUpperAlpha);
 }
 
-constexpr bool is_ascii_digit(char c) { return c >= '0' && c <= '9'; }
+constexpr bool is_ascii_digit(char c) { return has_flags(c, kDigit); }
 
 constexpr bool is_ascii_alphanumeric(char c)
 {
-    return is_ascii_digit(c) || is_ascii_alpha(c);
+    return has_flags(c, kLowerAlpha | kUpperAlpha | kDigit);
 }
 
 constexpr bool is_html_whitespace(char c)
 {
-    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    return has_flags(c, kHtmlWhitespace);
 }
 
 constexpr char to_ascii_upper(char c)
 {
-    return (c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c;
+    return has_flags(c, kLowerAlpha) ? c - ('a' - 'A') : c;
 }
 
 constexpr char to_ascii_lower(char c)
 {
-    return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+    return has_flags(c, kUpperAlpha) ? c + ('a' - 'A') : c;
+}
+
+constexpr bool is_ascii_hex_digit(char c)
+{
+    return is_ascii_digit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+/// @brief Value of an ASCII hex digit.
+constexpr std::uint32_t hex_digit_value(char c)
+{
+    if (is_ascii_digit(c)) {
+        return static_cast<std::uint32_t>(c - '0');
+    }
+    return static_cast<std::uint32_t>(to_ascii_lower(c) - 'a' + 10);
+}
+
+/// @brief The code points windows-1252 maps the bytes 0x80 to 0x9F to. The
+/// five bytes it leaves undefined map to the C1 control of the same value.
+/// https://encoding.spec.whatwg.org/index-windows-1252.txt
+inline constexpr std::uint32_t kWindows1252HighControls[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+};
+
+/// @brief U+FFFD REPLACEMENT CHARACTER in UTF-8.
+inline constexpr std::string_view kReplacementCharacter = "\xEF\xBF\xBD";
+
+/// @brief Writes `code_point` as UTF-8, which takes up to 4 bytes.
+/// @return The number of bytes written.
+constexpr std::size_t encode_utf8(std::uint32_t code_point, char* out)
+{
+    if (code_point < 0x80) {
+        out[0] = static_cast<char>(code_point);
+        return 1;
+    }
+    if (code_point < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+        out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+        out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+    out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+/// @brief Calls `callback` with each token of `input`, as split by
+/// https://infra.spec.whatwg.org/#split-on-ascii-whitespace
+template <typename Callback>
+void split_on_ascii_whitespace(std::string_view input, Callback&& callback)
+{
+    std::size_t pos = 0;
+    while (true) {
+        while (pos < input.size() && is_html_whitespace(input[pos])) {
+            pos++;
+        }
+        if (pos == input.size()) {
+            return;
+        }
+        auto start = pos;
+        while (pos < input.size() && !is_html_whitespace(input[pos])) {
+            pos++;
+        }
+        callback(input.substr(start, pos - start));
+    }
 }
 
 } // namespace CharUtil
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "line_index.h"
+
+#include <algorithm>
+
+#include "simd_scan.h"
+
+void LineIndex::build() const
+{
+    constexpr SimdScan::Needles kNewline { '\n' };
+
+    line_starts_.reserve(SimdScan::count(input_, '\n'));
+    for (auto pos = SimdScan::find_any(input_, 0, kNewline); pos < input_.size();
+         pos = SimdScan::find_any(input_, pos + 1, kNewline)) {
+        line_starts_.push_back(static_cast<std::uint32_t>(pos + 1));
+    }
+    built_ = true;
+}
+
+SourcePosition LineIndex::position(std::uint32_t offset) const
+{
+    if (!built_) {
+        build();
+    }
+
+    // The number of line starts at or before `offset` is its 0-based line.
+    auto it = std::upper_bound(line_starts_.begin(), line_starts_.end(), offset);
+    auto line = static_cast<std::uint32_t>(it - line_starts_.begin());
+    std::uint32_t line_start = line == 0 ? 0 : line_starts_[line - 1];
+    return { line + 1, offset - line_start + 1 };
+}
+
+std::uint32_t LineIndex::line_count() const
+{
+    if (!built_) {
+        build();
+    }
+    return static_cast<std::uint32_t>(line_starts_.size()) + 1;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/// @brief A line and column, both starting at 1. Columns count bytes.
+struct SourcePosition {
+    std::uint32_t line;
+    std::uint32_t column;
+};
+
+/// @brief Turns byte offsets into lines and columns.
+///
+/// Tokens and nodes only store a byte offset, so that tracking positions
+/// costs nothing while tokenizing. The index of line starts is built on the
+/// first query, with one SIMD pass to count the newlines and one to find
+/// them, and each query is then a binary search.
+///
+/// Lines end at U+000A LINE FEED. The input must outlive the index.
+class LineIndex {
+private:
+    std::string_view input_;
+    /// @brief Offset of the first byte of every line but the first.
+    mutable std::vector<std::uint32_t> line_starts_;
+    mutable bool built_ = false;
+
+    void build() const;
+
+public:
+    explicit LineIndex(std::string_view input)
+        : input_(input)
+    {
+    }
+
+    /// @brief The position of `offset`, which may be the end of the input.
+    SourcePosition position(std::uint32_t offset) const;
+
+    /// @brief Number of lines in the input.
+    std::uint32_t line_count() const;
+};
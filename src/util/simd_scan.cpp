@@ -0,0 +1,528 @@
+#include "simd_scan.h"
+
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define EVEN_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define EVEN_TARGET_AVX2
+#else
+#define EVEN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define EVEN_SIMD_X86 0
+#endif
+
+namespace SimdScan {
+
+namespace {
+
+    std::size_t popcount(std::uint64_t x)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return std::bitset<64>(x).count();
+#else
+        return static_cast<std::size_t>(__builtin_popcountll(x));
+#endif
+    }
+
+    std::size_t find_any_scalar(const char* data, std::size_t pos,
+        std::size_t size, const Needles& n)
+    {
+        // Test eight bytes at a time: a byte of `x ^ broadcast(needle)` is zero
+        // exactly where the needle occurs, and the classic has-zero-byte trick
+        // tells whether any lane is zero without branching per byte.
+        constexpr std::uint64_t ones = 0x0101010101010101ull;
+        constexpr std::uint64_t highs = 0x8080808080808080ull;
+        const std::uint64_t b0 = ones * static_cast<unsigned char>(n.bytes[0]);
+        const std::uint64_t b1 = ones * static_cast<unsigned char>(n.bytes[1]);
+        const std::uint64_t b2 = ones * static_cast<unsigned char>(n.bytes[2]);
+        const std::uint64_t b3 = ones * static_cast<unsigned char>(n.bytes[3]);
+
+        auto has_zero = [](std::uint64_t v) { return (v - ones) & ~v & highs; };
+
+        while (pos + 8 <= size) {
+            std::uint64_t x;
+            std::memcpy(&x, data + pos, sizeof(x));
+            if (has_zero(x ^ b0) | has_zero(x ^ b1) | has_zero(x ^ b2) | has_zero(x ^ b3)) {
+                break;
+            }
+            pos += 8;
+        }
+
+        while (pos < size && !n.contains(data[pos])) {
+            pos++;
+        }
+
+        return pos;
+    }
+
+    std::size_t count_scalar(const char* data, std::size_t size, char byte)
+    {
+        // Same zero-lane trick as above, but the exact count needs a mask
+        // with one bit per matching lane. Clearing bit 7 before adding 0x7f
+        // keeps carries from spilling into the next lane.
+        constexpr std::uint64_t ones = 0x0101010101010101ull;
+        constexpr std::uint64_t lows = 0x7f7f7f7f7f7f7f7full;
+        const std::uint64_t b = ones * static_cast<unsigned char>(byte);
+
+        std::size_t n = 0;
+        std::size_t pos = 0;
+        while (pos + 8 <= size) {
+            std::uint64_t x;
+            std::memcpy(&x, data + pos, sizeof(x));
+            x ^= b;
+            std::uint64_t nonzero = (((x & lows) + lows) | x) & ~lows;
+            n += 8 - popcount(nonzero);
+            pos += 8;
+        }
+
+        for (; pos < size; pos++) {
+            n += data[pos] == byte;
+        }
+        return n;
+    }
+
+    Summary summarize_scalar(const char* data, std::size_t size)
+    {
+        // OR the zero-lane masks of whole words together and only look at
+        // them at the end, so that the loop has no data dependent branches.
+        constexpr std::uint64_t ones = 0x0101010101010101ull;
+        constexpr std::uint64_t highs = 0x8080808080808080ull;
+        const std::uint64_t cr = ones * '\r';
+        auto has_zero = [](std::uint64_t v) { return (v - ones) & ~v & highs; };
+
+        std::uint64_t high = 0;
+        std::uint64_t crs = 0;
+        std::size_t pos = 0;
+        while (pos + 8 <= size) {
+            std::uint64_t x;
+            std::memcpy(&x, data + pos, sizeof(x));
+            high |= x;
+            crs |= has_zero(x ^ cr);
+            pos += 8;
+        }
+
+        // has_zero() can flag a lane above a real match falsely, but only
+        // when there is a real match in the same word, so the booleans
+        // below are still exact.
+        Summary summary { (high & highs) != 0, crs != 0 };
+        for (; pos < size; pos++) {
+            auto ch = data[pos];
+            summary.non_ascii |= (static_cast<unsigned char>(ch) & 0x80) != 0;
+            summary.carriage_return |= ch == '\r';
+        }
+        return summary;
+    }
+
+    std::size_t ascii_prefix_scalar(const char* data, std::size_t size)
+    {
+        constexpr std::uint64_t highs = 0x8080808080808080ull;
+        std::size_t pos = 0;
+        while (pos + 8 <= size) {
+            std::uint64_t x;
+            std::memcpy(&x, data + pos, sizeof(x));
+            if ((x & highs) != 0) {
+                break;
+            }
+            pos += 8;
+        }
+        while (pos < size && (static_cast<unsigned char>(data[pos]) & 0x80) == 0) {
+            pos++;
+        }
+        return pos;
+    }
+
+    std::size_t narrow_ascii_utf16_scalar(const char* data, std::size_t units,
+        bool big_endian, char* out)
+    {
+        std::size_t i = 0;
+        for (; i < units; i++) {
+            auto hi = static_cast<unsigned char>(data[2 * i + (big_endian ? 0 : 1)]);
+            auto lo = static_cast<unsigned char>(data[2 * i + (big_endian ? 1 : 0)]);
+            if (hi != 0 || lo >= 0x80) {
+                break;
+            }
+            out[i] = static_cast<char>(lo);
+        }
+        return i;
+    }
+
+#if EVEN_SIMD_X86
+    std::size_t find_any_sse2(const char* data, std::size_t pos,
+        std::size_t size, const Needles& n)
+    {
+        const __m128i n0 = _mm_set1_epi8(n.bytes[0]);
+        const __m128i n1 = _mm_set1_epi8(n.bytes[1]);
+        const __m128i n2 = _mm_set1_epi8(n.bytes[2]);
+        const __m128i n3 = _mm_set1_epi8(n.bytes[3]);
+
+        while (pos + 16 <= size) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            __m128i eq = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(x, n0), _mm_cmpeq_epi8(x, n1)),
+                _mm_or_si128(_mm_cmpeq_epi8(x, n2), _mm_cmpeq_epi8(x, n3)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+            if (mask != 0) {
+#if defined(_MSC_VER) && !defined(__clang__)
+                unsigned long bit;
+                _BitScanForward(&bit, mask);
+                return pos + bit;
+#else
+                return pos + static_cast<std::size_t>(__builtin_ctz(mask));
+#endif
+            }
+            pos += 16;
+        }
+
+        return find_any_scalar(data, pos, size, n);
+    }
+
+    EVEN_TARGET_AVX2 std::size_t find_any_avx2(const char* data,
+        std::size_t pos, std::size_t size, const Needles& n)
+    {
+        const __m256i n0 = _mm256_set1_epi8(n.bytes[0]);
+        const __m256i n1 = _mm256_set1_epi8(n.bytes[1]);
+        const __m256i n2 = _mm256_set1_epi8(n.bytes[2]);
+        const __m256i n3 = _mm256_set1_epi8(n.bytes[3]);
+
+        while (pos + 32 <= size) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+            __m256i eq = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(x, n0), _mm256_cmpeq_epi8(x, n1)),
+                _mm256_or_si256(_mm256_cmpeq_epi8(x, n2), _mm256_cmpeq_epi8(x, n3)));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(eq));
+            if (mask != 0) {
+#if defined(_MSC_VER) && !defined(__clang__)
+                unsigned long bit;
+                _BitScanForward(&bit, mask);
+                return pos + bit;
+#else
+                return pos + static_cast<std::size_t>(__builtin_ctz(mask));
+#endif
+            }
+            pos += 32;
+        }
+
+        return find_any_sse2(data, pos, size, n);
+    }
+
+    std::size_t count_sse2(const char* data, std::size_t size, char byte)
+    {
+        const __m128i b = _mm_set1_epi8(byte);
+        std::size_t n = 0;
+        std::size_t pos = 0;
+        while (pos + 16 <= size) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, b)));
+            n += popcount(mask);
+            pos += 16;
+        }
+        return n + count_scalar(data + pos, size - pos, byte);
+    }
+
+    EVEN_TARGET_AVX2 std::size_t count_avx2(const char* data, std::size_t size,
+        char byte)
+    {
+        const __m256i b = _mm256_set1_epi8(byte);
+        std::size_t n = 0;
+        std::size_t pos = 0;
+        while (pos + 32 <= size) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+            auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, b)));
+            n += popcount(mask);
+            pos += 32;
+        }
+        return n + count_sse2(data + pos, size - pos, byte);
+    }
+
+    Summary summarize_sse2(const char* data, std::size_t size)
+    {
+        const __m128i cr = _mm_set1_epi8('\r');
+        const __m128i zero = _mm_setzero_si128();
+        __m128i high = zero;
+        __m128i crs = zero;
+        std::size_t pos = 0;
+        while (pos + 16 <= size) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            high = _mm_or_si128(high, x);
+            crs = _mm_or_si128(crs, _mm_cmpeq_epi8(x, cr));
+            pos += 16;
+        }
+
+        auto tail = summarize_scalar(data + pos, size - pos);
+        return {
+            tail.non_ascii || _mm_movemask_epi8(high) != 0,
+            tail.carriage_return || _mm_movemask_epi8(crs) != 0,
+        };
+    }
+
+    EVEN_TARGET_AVX2 Summary summarize_avx2(const char* data, std::size_t size)
+    {
+        const __m256i cr = _mm256_set1_epi8('\r');
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i high = zero;
+        __m256i crs = zero;
+        std::size_t pos = 0;
+        while (pos + 32 <= size) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+            high = _mm256_or_si256(high, x);
+            crs = _mm256_or_si256(crs, _mm256_cmpeq_epi8(x, cr));
+            pos += 32;
+        }
+
+        auto tail = summarize_sse2(data + pos, size - pos);
+        return {
+            tail.non_ascii || _mm256_movemask_epi8(high) != 0,
+            tail.carriage_return || _mm256_movemask_epi8(crs) != 0,
+        };
+    }
+
+    unsigned first_set_bit(unsigned mask)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long bit;
+        _BitScanForward(&bit, mask);
+        return static_cast<unsigned>(bit);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+    std::size_t ascii_prefix_sse2(const char* data, std::size_t size)
+    {
+        std::size_t pos = 0;
+        while (pos + 16 <= size) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+            auto mask = static_cast<unsigned>(_mm_movemask_epi8(x));
+            if (mask != 0) {
+                return pos + first_set_bit(mask);
+            }
+            pos += 16;
+        }
+        return pos + ascii_prefix_scalar(data + pos, size - pos);
+    }
+
+    EVEN_TARGET_AVX2 std::size_t ascii_prefix_avx2(const char* data, std::size_t size)
+    {
+        std::size_t pos = 0;
+        while (pos + 32 <= size) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+            auto mask = static_cast<unsigned>(_mm256_movemask_epi8(x));
+            if (mask != 0) {
+                return pos + first_set_bit(mask);
+            }
+            pos += 32;
+        }
+        return pos + ascii_prefix_sse2(data + pos, size - pos);
+    }
+
+    std::size_t narrow_ascii_utf16_sse2(const char* data, std::size_t units,
+        bool big_endian, char* out)
+    {
+        // Eight code units at a time: they are all ASCII when no bit above
+        // the low seven is set, and then packing the 16-bit lanes to bytes
+        // is the whole conversion.
+        const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        std::size_t i = 0;
+        while (i + 8 <= units) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2 * i));
+            if (big_endian) {
+                x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+            }
+            __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(x, non_ascii), zero);
+            if (_mm_movemask_epi8(ascii) != 0xFFFF) {
+                break;
+            }
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(x, x));
+            i += 8;
+        }
+        return i + narrow_ascii_utf16_scalar(data + 2 * i, units - i, big_endian, out + i);
+    }
+
+    bool cpu_has_avx2()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+        __cpuid(info, 1);
+        // OSXSAVE and AVX, then check that the OS saves the YMM state.
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+            return false;
+        }
+        if ((_xgetbv(0) & 0x6) != 0x6) {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    using Kernel = std::size_t (*)(const char*, std::size_t, std::size_t,
+        const Needles&);
+
+    Kernel kernel_for(Isa isa)
+    {
+        switch (isa) {
+#if EVEN_SIMD_X86
+        case Isa::Avx2:
+            return find_any_avx2;
+        case Isa::Sse2:
+            return find_any_sse2;
+#endif
+        default:
+            return find_any_scalar;
+        }
+    }
+
+    using CountKernel = std::size_t (*)(const char*, std::size_t, char);
+
+    CountKernel count_kernel_for(Isa isa)
+    {
+        switch (isa) {
+#if EVEN_SIMD_X86
+        case Isa::Avx2:
+            return count_avx2;
+        case Isa::Sse2:
+            return count_sse2;
+#endif
+        default:
+            return count_scalar;
+        }
+    }
+
+    using SummarizeKernel = Summary (*)(const char*, std::size_t);
+
+    SummarizeKernel summarize_kernel_for(Isa isa)
+    {
+        switch (isa) {
+#if EVEN_SIMD_X86
+        case Isa::Avx2:
+            return summarize_avx2;
+        case Isa::Sse2:
+            return summarize_sse2;
+#endif
+        default:
+            return summarize_scalar;
+        }
+    }
+
+    using AsciiPrefixKernel = std::size_t (*)(const char*, std::size_t);
+
+    AsciiPrefixKernel ascii_prefix_kernel_for(Isa isa)
+    {
+        switch (isa) {
+#if EVEN_SIMD_X86
+        case Isa::Avx2:
+            return ascii_prefix_avx2;
+        case Isa::Sse2:
+            return ascii_prefix_sse2;
+#endif
+        default:
+            return ascii_prefix_scalar;
+        }
+    }
+
+    using NarrowKernel = std::size_t (*)(const char*, std::size_t, bool, char*);
+
+    NarrowKernel narrow_kernel_for(Isa isa)
+    {
+        switch (isa) {
+#if EVEN_SIMD_X86
+        case Isa::Avx2:
+        case Isa::Sse2:
+            return narrow_ascii_utf16_sse2;
+#endif
+        default:
+            return narrow_ascii_utf16_scalar;
+        }
+    }
+
+} // namespace
+
+Isa best_isa()
+{
+#if EVEN_SIMD_X86
+    static const Isa isa = cpu_has_avx2() ? Isa::Avx2 : Isa::Sse2;
+    return isa;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+bool is_supported(Isa isa)
+{
+    return static_cast<int>(isa) <= static_cast<int>(best_isa());
+}
+
+std::size_t find_any(std::string_view input, std::size_t pos,
+    const Needles& needles)
+{
+    static const Kernel kernel = kernel_for(best_isa());
+    return kernel(input.data(), pos, input.size(), needles);
+}
+
+std::size_t find_any(std::string_view input, std::size_t pos,
+    const Needles& needles, Isa isa)
+{
+    return kernel_for(isa)(input.data(), pos, input.size(), needles);
+}
+
+Summary summarize(std::string_view input)
+{
+    static const SummarizeKernel kernel = summarize_kernel_for(best_isa());
+    return kernel(input.data(), input.size());
+}
+
+Summary summarize(std::string_view input, Isa isa)
+{
+    return summarize_kernel_for(isa)(input.data(), input.size());
+}
+
+std::size_t ascii_prefix(std::string_view input)
+{
+    static const AsciiPrefixKernel kernel = ascii_prefix_kernel_for(best_isa());
+    return kernel(input.data(), input.size());
+}
+
+std::size_t ascii_prefix(std::string_view input, Isa isa)
+{
+    return ascii_prefix_kernel_for(isa)(input.data(), input.size());
+}
+
+std::size_t narrow_ascii_utf16(std::string_view input, bool big_endian, char* out)
+{
+    static const NarrowKernel kernel = narrow_kernel_for(best_isa());
+    return kernel(input.data(), input.size() / 2, big_endian, out);
+}
+
+std::size_t narrow_ascii_utf16(std::string_view input, bool big_endian, char* out,
+    Isa isa)
+{
+    return narrow_kernel_for(isa)(input.data(), input.size() / 2, big_endian, out);
+}
+
+std::size_t count(std::string_view input, char byte)
+{
+    static const CountKernel kernel = count_kernel_for(best_isa());
+    return kernel(input.data(), input.size(), byte);
+}
+
+std::size_t count(std::string_view input, char byte, Isa isa)
+{
+    return count_kernel_for(isa)(input.data(), input.size(), byte);
+}
+
+} // namespace SimdScan
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace SimdScan {
+
+/// @brief Up to four bytes a scan stops at.
+/// Unused slots repeat the first byte so every kernel can compare against all
+/// four unconditionally.
+struct Needles {
+    char bytes[4];
+
+    constexpr explicit Needles(char a)
+        : bytes { a, a, a, a }
+    {
+    }
+
+    constexpr Needles(char a, char b)
+        : bytes { a, b, a, a }
+    {
+    }
+
+    constexpr Needles(char a, char b, char c)
+        : bytes { a, b, c, a }
+    {
+    }
+
+    constexpr Needles(char a, char b, char c, char d)
+        : bytes { a, b, c, d }
+    {
+    }
+
+    constexpr bool contains(char ch) const
+    {
+        return ch == bytes[0] || ch == bytes[1] || ch == bytes[2] || ch == bytes[3];
+    }
+};
+
+/// @brief Instruction set a scan kernel is written for.
+enum class Isa {
+    Scalar,
+    Sse2,
+    Avx2,
+};
+
+/// @brief The best kernel the running CPU supports, detected once.
+Isa best_isa();
+
+/// @brief Whether the running CPU can execute kernels for `isa`.
+bool is_supported(Isa isa);
+
+/// @brief Finds the first byte at or after `pos` that is one of `needles`.
+/// @return Its index, or `input.size()` when there is none.
+std::size_t find_any(std::string_view input, std::size_t pos,
+    const Needles& needles);
+
+/// @brief Same as `find_any`, forcing a specific kernel.
+/// `isa` must be supported by the running CPU.
+std::size_t find_any(std::string_view input, std::size_t pos,
+    const Needles& needles, Isa isa);
+
+/// @brief What summarize() found in a buffer.
+struct Summary {
+    /// @brief Some byte is 0x80 or above.
+    bool non_ascii = false;
+    /// @brief Some byte is '\r'.
+    bool carriage_return = false;
+};
+
+/// @brief Looks at every byte of `input` once, without branching on the
+/// data, to tell whether it needs any input stream preprocessing.
+Summary summarize(std::string_view input);
+
+/// @brief Same as `summarize`, forcing a specific kernel.
+Summary summarize(std::string_view input, Isa isa);
+
+/// @brief Length of the run of ASCII bytes `input` starts with.
+std::size_t ascii_prefix(std::string_view input);
+
+/// @brief Same as `ascii_prefix`, forcing a specific kernel.
+std::size_t ascii_prefix(std::string_view input, Isa isa);
+
+/// @brief Narrows the run of ASCII code units the UTF-16 `input` starts with
+/// to one byte each, writing them to `out`, which needs room for
+/// `input.size() / 2` bytes.
+/// @return The number of code units narrowed.
+std::size_t narrow_ascii_utf16(std::string_view input, bool big_endian, char* out);
+
+/// @brief Same as `narrow_ascii_utf16`, forcing a specific kernel. There is no
+/// AVX2 kernel; Isa::Avx2 uses the SSE2 one.
+std::size_t narrow_ascii_utf16(std::string_view input, bool big_endian, char* out,
+    Isa isa);
+
+/// @brief Counts the occurrences of `byte` in `input`.
+std::size_t count(std::string_view input, char byte);
+
+/// @brief Same as `count`, forcing a specific kernel.
+std::size_t count(std::string_view input, char byte, Isa isa);
+
+} // namespace SimdScan
@@ -0,0 +1,127 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+ThreadPool::ThreadPool(std::size_t threads)
+{
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    shares_ = std::make_unique<Share[]>(threads);
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; i++) {
+        workers_.emplace_back([this, i] { work(i); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    loop_started_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::for_each_index(std::size_t count, const IndexFunction& fn)
+{
+    if (count == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> loop_lock(loop_mutex_);
+    auto threads = thread_count();
+    for (std::size_t i = 0; i < threads; i++) {
+        std::lock_guard<std::mutex> lock(shares_[i].mutex);
+        shares_[i].begin = count * i / threads;
+        shares_[i].end = count * (i + 1) / threads;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        loop_ = &fn;
+        busy_workers_ = threads;
+        generation_++;
+    }
+    loop_started_.notify_all();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    loop_finished_.wait(lock, [this] { return busy_workers_ == 0; });
+    loop_ = nullptr;
+}
+
+void ThreadPool::work(std::size_t worker)
+{
+    std::uint64_t generation = 0;
+    while (true) {
+        const IndexFunction* loop;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            loop_started_.wait(lock, [&] { return stopping_ || generation_ != generation; });
+            if (stopping_) {
+                return;
+            }
+            generation = generation_;
+            loop = loop_;
+        }
+
+        std::size_t index;
+        while (take(worker, index)) {
+            (*loop)(index, worker);
+        }
+
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last = --busy_workers_ == 0;
+        }
+        if (last) {
+            loop_finished_.notify_all();
+        }
+    }
+}
+
+bool ThreadPool::take(std::size_t worker, std::size_t& index)
+{
+    auto& own = shares_[worker];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.begin < own.end) {
+            index = own.begin++;
+            return true;
+        }
+    }
+
+    // Steal the back half of the next share that has anything left, so that
+    // its owner keeps the front it is working through.
+    auto threads = thread_count();
+    for (std::size_t i = 1; i < threads; i++) {
+        auto& victim = shares_[(worker + i) % threads];
+        std::size_t begin;
+        std::size_t end;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin >= victim.end) {
+                continue;
+            }
+            begin = victim.begin + (victim.end - victim.begin) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+
+        std::lock_guard<std::mutex> lock(own.mutex);
+        index = begin;
+        own.begin = begin + 1;
+        own.end = end;
+        return true;
+    }
+    return false;
+}
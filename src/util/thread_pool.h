@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Fixed set of worker threads that share out loops with work stealing.
+///
+/// for_each_index() splits its index range evenly between the workers. Each
+/// worker takes indexes from the front of its own share; one that runs out
+/// steals the back half of what another worker has left. Uneven items, like
+/// documents of very different sizes, so keep every worker busy until the end,
+/// while a worker that is not stealing only ever touches its own share.
+class ThreadPool {
+public:
+    /// @brief Called with the index of the item and of the worker running it,
+    /// which is below thread_count(), e.g. to pick per-thread state.
+    using IndexFunction = std::function<void(std::size_t index, std::size_t worker)>;
+
+    /// @brief `threads` of 0 starts one per hardware thread.
+    explicit ThreadPool(std::size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t thread_count() const { return workers_.size(); }
+
+    /// @brief Calls `fn` for every index below `count` on the workers, and
+    /// returns once all calls have returned. Calls from several threads run
+    /// one after the other.
+    void for_each_index(std::size_t count, const IndexFunction& fn);
+
+private:
+    /// @brief The indexes a worker has left, on a cache line of its own.
+    struct alignas(64) Share {
+        std::mutex mutex;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<Share[]> shares_;
+
+    /// @brief Serializes for_each_index().
+    std::mutex loop_mutex_;
+    std::mutex mutex_;
+    std::condition_variable loop_started_;
+    std::condition_variable loop_finished_;
+    // Guarded by `mutex_`.
+    const IndexFunction* loop_ = nullptr;
+    std::uint64_t generation_ = 0;
+    std::size_t busy_workers_ = 0;
+    bool stopping_ = false;
+
+    void work(std::size_t worker);
+    bool take(std::size_t worker, std::size_t& index);
+};
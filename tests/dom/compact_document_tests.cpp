@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "dom/compact_document.h"
+#include "dump.h"
+#include "html/compact_tree_builder.h"
+#include "html/parser.h"
+
+namespace {
+
+using NodeId = CompactDocument::NodeId;
+
+std::string dump(const CompactDocument& document, NodeId node)
+{
+    std::string out;
+    if (document.node_type(node) == CompactDocument::Type::TEXT_NODE) {
+        return "\"" + std::string(document.data(node)) + "\"";
+    }
+
+    if (document.node_type(node) == CompactDocument::Type::ELEMENT_NODE) {
+        out += "(" + std::string(document.local_name(node));
+        for (std::uint32_t i = 0; i < document.attribute_count(node); i++) {
+            out += " " + std::string(document.attribute_name(node, i)) + "="
+                + std::string(document.attribute_value(node, i));
+        }
+    } else {
+        out += "(#document";
+    }
+
+    for (auto child = document.first_child(node); child != CompactDocument::kNone;
+         child = document.next_sibling(child)) {
+        out += " " + dump(document, child);
+    }
+    return out + ")";
+}
+
+/// The local name of an element, the data of a text node, or "#".
+std::string label(const CompactDocument& document, NodeId node)
+{
+    switch (document.node_type(node)) {
+    case CompactDocument::Type::ELEMENT_NODE:
+        return std::string(document.local_name(node));
+    case CompactDocument::Type::TEXT_NODE:
+        return std::string(document.data(node));
+    default:
+        return "#";
+    }
+}
+
+} // namespace
+
+TEST(CompactDocumentTest, builds_the_same_tree_as_the_pointer_dom)
+{
+    const char* inputs[] = {
+        "<html><body class=main><p>Hello <b>world</b>!</p><br><img src=\"a.png\"/></body></html>",
+        "<div><p><span>a</p>b</div></nope>c",
+        "<x-widget data-x=1 foo=bar>t<x-widget>u</x-widget>v</x-widget>",
+        "<x-a><x-b><b>a</x-a>b</x-b>c",
+        "a<4 b",
+    };
+
+    for (const char* input : inputs) {
+        auto compact = CompactTreeBuilder::parse(input);
+        auto document = HTMLParser::parse(input);
+        EXPECT_EQ(dump(*compact, CompactDocument::kDocument), dump(*document)) << input;
+        EXPECT_TRUE(compact->in_tree_order()) << input;
+    }
+}
+
+TEST(CompactDocumentTest, preorder_is_a_linear_scan_in_tree_order)
+{
+    auto document = CompactTreeBuilder::parse("<a><b><c></c></b>x<d></d></a><e>y</e>");
+    ASSERT_TRUE(document->in_tree_order());
+
+    std::string names;
+    for (NodeId node = CompactDocument::kDocument; node != CompactDocument::kNone;
+         node = document->following(node)) {
+        names += label(*document, node);
+    }
+    EXPECT_EQ(names, "#abcxdey");
+}
+
+TEST(CompactDocumentTest, follows_links_once_out_of_tree_order)
+{
+    CompactDocument document;
+    auto a = document.append_element(CompactDocument::kDocument, "a");
+    auto b = document.append_element(CompactDocument::kDocument, "b");
+    auto c = document.append_element(a, "c");
+    document.append_text(c, "x");
+    auto text = document.append_text(b, "y");
+    document.append_element(CompactDocument::kDocument, "d");
+    document.append_data(text, "z");
+    EXPECT_FALSE(document.in_tree_order());
+
+    std::string names;
+    for (NodeId node = document.first_child(CompactDocument::kDocument); node != CompactDocument::kNone;
+         node = document.following(node)) {
+        names += label(document, node);
+    }
+    EXPECT_EQ(names, "acxbyzd");
+}
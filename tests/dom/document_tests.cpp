@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "dom/document.h"
+#include "dom/element.h"
+#include "dom/text.h"
+#include "html/parser.h"
+
+TEST(DocumentTest, creates_nodes_owned_by_the_document)
+{
+    Document document;
+    auto* div = document.create_element("div");
+    auto* custom = document.create_element("x-widget");
+    auto* text = document.create_text_node("hi");
+
+    EXPECT_EQ(div->tag_id(), TagId::Div);
+    EXPECT_EQ(div->local_name(), "div");
+    EXPECT_EQ(custom->tag_id(), TagId::Unknown);
+    EXPECT_EQ(custom->local_name(), "x-widget");
+    EXPECT_EQ(text->owner_document(), &document);
+
+    document.append_child(div);
+    div->append_child(custom);
+    custom->append_child(text);
+    EXPECT_EQ(document.first_child(), div);
+    EXPECT_EQ(text->parent_node(), custom);
+}
+
+TEST(DocumentTest, attributes_and_text_grow_in_place)
+{
+    Document document;
+    auto* element = document.create_element("input");
+    for (int i = 0; i < 20; i++) {
+        element->append_attribute("data-" + std::to_string(i), std::to_string(i));
+    }
+    element->append_attribute("type", "text");
+
+    ASSERT_EQ(element->attributes().size(), 21u);
+    EXPECT_EQ(element->attributes()[0].name(), "data-0");
+    EXPECT_EQ(element->attributes()[19].value(), "19");
+    EXPECT_EQ(element->attributes()[20].name(), "type");
+
+    auto* text = document.create_text_node("");
+    std::string expected;
+    for (int i = 0; i < 1000; i++) {
+        text->append_data("ab");
+        expected += "ab";
+    }
+    EXPECT_EQ(text->data(), expected);
+}
+
+TEST(DocumentTest, tears_down_deeply_nested_trees)
+{
+    // Freeing node by node used to recurse once per level.
+    std::string input;
+    for (int i = 0; i < 200000; i++) {
+        input += "<div>";
+    }
+
+    auto document = HTMLParser::parse(input);
+    std::size_t depth = 0;
+    for (Node* node = document->first_child(); node; node = node->first_child()) {
+        depth++;
+    }
+    EXPECT_EQ(depth, 200000u);
+    document.reset();
+}
+
+TEST(DocumentTest, finds_elements_by_id)
+{
+    auto document = HTMLParser::parse("<div id=a><p id=b></p><p id=a></p></div><span id=''></span>");
+    auto* div = document->first_child();
+
+    EXPECT_EQ(document->get_element_by_id("a"), div);
+    EXPECT_EQ(document->get_element_by_id("b"), div->first_child());
+    EXPECT_EQ(document->get_element_by_id(""), nullptr);
+    EXPECT_EQ(document->get_element_by_id("c"), nullptr);
+
+    // Detached elements are only indexed once they are attached.
+    auto* detached = document->create_element("em");
+    detached->append_attribute("id", "c");
+    auto* inner = document->create_element("i");
+    inner->append_attribute("id", "d");
+    detached->append_child(inner);
+    EXPECT_FALSE(detached->is_connected());
+    EXPECT_EQ(document->get_element_by_id("c"), nullptr);
+
+    // Attaching it indexes its whole subtree.
+    div->first_child()->append_child(detached);
+    EXPECT_TRUE(inner->is_connected());
+    EXPECT_EQ(document->get_element_by_id("c"), detached);
+    EXPECT_EQ(document->get_element_by_id("d"), inner);
+    inner->append_attribute("id", "ignored");
+    EXPECT_EQ(document->get_element_by_id("ignored"), nullptr);
+    auto* last = static_cast<Element*>(div->last_child());
+    last->append_attribute("class", "x");
+    inner->append_attribute("class", "x");
+    ASSERT_EQ(document->get_elements_by_class_name("x").length(), 2u);
+    EXPECT_EQ(document->get_elements_by_class_name("x").item(0), inner);
+}
+
+TEST(DocumentTest, class_collections_are_live_and_in_tree_order)
+{
+    auto document = HTMLParser::parse(
+        "<ul><li class='item first'>a</li><li class=\"item\">b</li><li class='other  item item'>c</li></ul>");
+    auto* ul = document->first_child();
+
+    auto items = document->get_elements_by_class_name(" item ");
+    auto both = document->get_elements_by_class_name("first item");
+    auto none = document->get_elements_by_class_name(" \t");
+    EXPECT_EQ(items.length(), 3u);
+    EXPECT_EQ(items.item(0), ul->first_child());
+    EXPECT_EQ(items.item(2), ul->last_child());
+    EXPECT_EQ(items.item(3), nullptr);
+    EXPECT_EQ(both.length(), 1u);
+    EXPECT_EQ(none.length(), 0u);
+
+    // An element appended into the first item comes second in tree order.
+    auto* nested = document->create_element("span");
+    nested->append_attribute("class", "item");
+    ul->first_child()->append_child(nested);
+    EXPECT_EQ(items.length(), 4u);
+    EXPECT_EQ(items.item(1), nested);
+
+    std::vector<Element*> seen;
+    for (auto* element : items) {
+        seen.push_back(element);
+    }
+    EXPECT_EQ(seen.size(), 4u);
+    EXPECT_EQ(seen.back(), ul->last_child());
+}
+
+TEST(DocumentTest, gets_and_sets_attributes_by_name_or_atom)
+{
+    Document document;
+    auto* element = document.create_element("a", 2);
+    element->append_attribute("href", "/x");
+    element->append_attribute("data-x", "1");
+    // Past the room it was created with.
+    element->append_attribute("class", " b  a b ");
+
+    EXPECT_EQ(element->get_attribute("href"), "/x");
+    EXPECT_EQ(element->get_attribute(AttrId::Href), "/x");
+    EXPECT_EQ(element->attribute(AttrId::Href)->id(), AttrId::Href);
+    EXPECT_EQ(element->get_attribute("data-x"), "1");
+    EXPECT_EQ(element->attribute("data-x")->id(), AttrId::Unknown);
+    EXPECT_EQ(element->get_attribute("title"), std::nullopt);
+    EXPECT_FALSE(element->has_attribute("data-y"));
+    EXPECT_TRUE(element->has_attribute(AttrId::Class));
+
+    auto classes = element->class_list();
+    ASSERT_EQ(classes.size(), 2u);
+    EXPECT_EQ(classes.begin()[0], "b");
+    EXPECT_EQ(classes.begin()[1], "a");
+    EXPECT_TRUE(element->has_class("a"));
+    EXPECT_FALSE(element->has_class("c"));
+
+    element->set_attribute("data-x", "2");
+    element->set_attribute("title", "t");
+    EXPECT_EQ(element->get_attribute("data-x"), "2");
+    EXPECT_EQ(element->get_attribute(AttrId::Title), "t");
+    EXPECT_EQ(element->attributes().size(), 4u);
+}
+
+TEST(DocumentTest, set_attribute_updates_the_indexes)
+{
+    auto document = HTMLParser::parse("<p id=a class='x y'></p><p class=y></p>");
+    auto* first = static_cast<Element*>(document->first_child());
+    auto ys = document->get_elements_by_class_name("y");
+    ASSERT_EQ(ys.length(), 2u);
+
+    first->set_attribute("id", "b");
+    first->set_attribute("class", "z");
+    EXPECT_EQ(document->get_element_by_id("a"), nullptr);
+    EXPECT_EQ(document->get_element_by_id("b"), first);
+    EXPECT_EQ(ys.length(), 1u);
+    EXPECT_EQ(ys.item(0), first->next_sibling());
+    EXPECT_EQ(document->get_elements_by_class_name("z").item(0), first);
+    EXPECT_FALSE(first->has_class("x"));
+
+    // Adding the class back puts it first again, in tree order.
+    first->set_attribute("class", "y");
+    EXPECT_EQ(ys.item(0), first);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+#include "dom/element.h"
+#include "dom/node.h"
+#include "dom/text.h"
+
+/// Serializes a tree as nested S-expressions, e.g. (div id=a "text").
+inline std::string dump(const Node& node)
+{
+    std::string out;
+    if (node.node_type() == Node::Type::TEXT_NODE) {
+        return "\"" + std::string(static_cast<const Text&>(node).data()) + "\"";
+    }
+
+    if (node.node_type() == Node::Type::ELEMENT_NODE) {
+        const auto& element = static_cast<const Element&>(node);
+        out += "(" + std::string(element.local_name());
+        for (const auto& attr : element.attributes()) {
+            out += " " + std::string(attr.name()) + "=" + std::string(attr.value());
+        }
+    } else {
+        out += "(#document";
+    }
+
+    for (auto* child = node.first_child(); child; child = child->next_sibling()) {
+        out += " " + dump(*child);
+    }
+    return out + ")";
+}
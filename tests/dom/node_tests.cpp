@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "dom/document.h"
+#include "dom/document_fragment.h"
+#include "dom/element.h"
+#include "dom/text.h"
+#include "dom/traversal.h"
+#include "html/parser.h"
+
+namespace {
+
+/// The children of `parent` as their local names or data, checking the
+/// links both ways on the way.
+std::string children(const Node* parent)
+{
+    std::string out;
+    const Node* previous = nullptr;
+    for (auto* child = parent->first_child(); child; child = child->next_sibling()) {
+        EXPECT_EQ(child->parent_node(), parent);
+        EXPECT_EQ(child->previous_sibling(), previous);
+        if (!out.empty()) {
+            out += ' ';
+        }
+        out += child->node_type() == Node::Type::ELEMENT_NODE
+            ? std::string(static_cast<const Element*>(child)->local_name())
+            : std::string(static_cast<const Text*>(child)->data());
+        previous = child;
+    }
+    EXPECT_EQ(parent->last_child(), previous);
+    return out;
+}
+
+} // namespace
+
+TEST(NodeTest, inserts_replaces_and_removes_children)
+{
+    Document document;
+    auto* div = document.create_element("div");
+    auto* a = document.create_element("a");
+    auto* b = document.create_element("b");
+    auto* c = document.create_element("c");
+    document.append_child(div);
+
+    EXPECT_EQ(div->insert_before(b, nullptr), b);
+    EXPECT_EQ(div->insert_before(a, b), a);
+    EXPECT_EQ(div->insert_before(c, nullptr), c);
+    EXPECT_EQ(children(div), "a b c");
+
+    // Inserting a child before itself leaves it where it is.
+    EXPECT_EQ(div->insert_before(b, b), b);
+    EXPECT_EQ(children(div), "a b c");
+    // An attached node moves.
+    EXPECT_EQ(div->insert_before(c, a), c);
+    EXPECT_EQ(children(div), "c a b");
+
+    auto* text = document.create_text_node("t");
+    EXPECT_EQ(div->replace_child(text, a), a);
+    EXPECT_EQ(a->parent_node(), nullptr);
+    EXPECT_FALSE(a->is_connected());
+    EXPECT_EQ(children(div), "c t b");
+    // Replacing a child with its next sibling.
+    EXPECT_EQ(div->replace_child(b, text), text);
+    EXPECT_EQ(children(div), "c b");
+
+    EXPECT_EQ(div->remove_child(c), c);
+    EXPECT_EQ(div->remove_child(b), b);
+    EXPECT_EQ(children(div), "");
+    EXPECT_EQ(c->next_sibling(), nullptr);
+    EXPECT_EQ(b->previous_sibling(), nullptr);
+}
+
+TEST(NodeTest, refuses_what_the_spec_throws_on)
+{
+    Document document;
+    auto* div = document.create_element("div");
+    auto* span = document.create_element("span");
+    auto* text = document.create_text_node("t");
+    document.append_child(div);
+    div->append_child(span);
+    div->append_child(text);
+    Document other;
+    auto* stranger = other.create_element("p");
+
+    // An ancestor into its descendant, a node into itself or a text node.
+    EXPECT_EQ(span->append_child(div), nullptr);
+    EXPECT_EQ(span->append_child(span), nullptr);
+    EXPECT_EQ(span->append_child(&document), nullptr);
+    EXPECT_EQ(text->append_child(document.create_element("b")), nullptr);
+    // A reference child or removed child of another parent.
+    EXPECT_EQ(document.insert_before(document.create_element("b"), span), nullptr);
+    EXPECT_EQ(document.replace_child(document.create_element("b"), span), nullptr);
+    EXPECT_EQ(document.remove_child(span), nullptr);
+    EXPECT_EQ(div->remove_child(nullptr), nullptr);
+    // A node of another document.
+    EXPECT_EQ(div->append_child(stranger), nullptr);
+
+    EXPECT_EQ(children(&document), "div");
+    EXPECT_EQ(children(div), "span t");
+}
+
+TEST(NodeTest, fragments_move_all_their_children_at_once)
+{
+    auto document = HTMLParser::parse("<ul><li>a</li><li id=d>d</li></ul>");
+    auto* ul = document->first_child();
+    auto* fragment = document->create_document_fragment();
+    EXPECT_EQ(fragment->node_type(), Node::Type::DOCUMENT_FRAGMENT_NODE);
+
+    for (auto* name : { "b", "c" }) {
+        auto* li = document->create_element("li");
+        li->append_attribute("id", name);
+        li->append_child(document->create_text_node(name));
+        fragment->append_child(li);
+    }
+    EXPECT_FALSE(fragment->first_child()->is_connected());
+    EXPECT_EQ(document->get_element_by_id("b"), nullptr);
+
+    EXPECT_EQ(ul->insert_before(fragment, ul->last_child()), fragment);
+    EXPECT_EQ(fragment->first_child(), nullptr);
+    EXPECT_EQ(fragment->last_child(), nullptr);
+    EXPECT_EQ(children(ul), "li li li li");
+    EXPECT_EQ(children(ul->first_child()->next_sibling()), "b");
+    EXPECT_TRUE(ul->first_child()->next_sibling()->first_child()->is_connected());
+    EXPECT_EQ(document->get_element_by_id("c"), ul->last_child()->previous_sibling());
+
+    // An empty fragment inserts nothing.
+    EXPECT_EQ(ul->append_child(fragment), fragment);
+    EXPECT_EQ(children(ul), "li li li li");
+}
+
+TEST(NodeTest, removal_updates_the_indexes)
+{
+    auto document = HTMLParser::parse("<div id=a class=x><p id=b class=x></p></div><p class=x></p>");
+    auto* div = static_cast<Element*>(document->first_child());
+    auto* last = document->last_child();
+    auto xs = document->get_elements_by_class_name("x");
+    ASSERT_EQ(xs.length(), 3u);
+
+    EXPECT_EQ(document->remove_child(div), div);
+    EXPECT_FALSE(div->first_child()->is_connected());
+    EXPECT_EQ(document->get_element_by_id("a"), nullptr);
+    EXPECT_EQ(document->get_element_by_id("b"), nullptr);
+    EXPECT_EQ(xs.length(), 1u);
+
+    // Taken out of the document, the subtree is no longer indexed.
+    div->set_attribute("id", "c");
+    EXPECT_EQ(document->get_element_by_id("c"), nullptr);
+
+    // Removing the last child leaves the one before it ending the document,
+    // so that elements appended after it stay in tree order.
+    document->append_child(div);
+    EXPECT_EQ(document->remove_child(div), div);
+    auto* appended = document->create_element("p");
+    appended->append_attribute("class", "x");
+    document->append_child(appended);
+    ASSERT_EQ(xs.length(), 2u);
+    EXPECT_EQ(xs.item(0), last);
+    EXPECT_EQ(xs.item(1), appended);
+
+    // Inserting back before the last element puts it first.
+    document->insert_before(div, last);
+    ASSERT_EQ(xs.length(), 4u);
+    EXPECT_EQ(xs.item(0), div);
+    EXPECT_EQ(xs.item(1), div->first_child());
+    EXPECT_EQ(document->get_element_by_id("c"), div);
+}
+
+TEST(NodeTest, batches_defer_index_updates)
+{
+    auto document = HTMLParser::parse("<ul><li class=x id=a></li><li class=x id=b></li></ul>");
+    auto* ul = document->first_child();
+    auto* a = ul->first_child();
+    auto* b = ul->last_child();
+    auto xs = document->get_elements_by_class_name("x");
+    ASSERT_EQ(xs.length(), 2u);
+
+    {
+        Document::MutationBatch batch(*document);
+        {
+            Document::MutationBatch nested(*document);
+            ul->insert_before(b, a);
+            ul->remove_child(a);
+        }
+        // Lookups see every change so far, even inside the batch.
+        EXPECT_EQ(document->get_element_by_id("a"), nullptr);
+        EXPECT_EQ(xs.length(), 1u);
+
+        for (int i = 0; i < 3; i++) {
+            auto* li = document->create_element("li");
+            li->append_attribute("class", "x");
+            ul->insert_before(li, b);
+        }
+        static_cast<Element*>(b)->set_attribute("id", "c");
+    }
+
+    EXPECT_EQ(document->get_element_by_id("b"), nullptr);
+    EXPECT_EQ(document->get_element_by_id("c"), b);
+    ASSERT_EQ(xs.length(), 4u);
+    EXPECT_EQ(xs.item(0), ul->first_child());
+    EXPECT_EQ(xs.item(3), b);
+}
+
+TEST(NodeTest, removals_keep_the_rest_of_an_index_in_tree_order)
+{
+    std::string html;
+    for (int i = 0; i < 10; i++) {
+        html += "<p class='x' id=p" + std::to_string(i) + "></p>";
+    }
+    auto document = HTMLParser::parse(html);
+    auto xs = document->get_elements_by_class_name("x");
+    ASSERT_EQ(xs.length(), 10u);
+
+    // Every other one, from the front, so that later ones fill the gaps.
+    std::vector<Node*> ps;
+    for (auto* node = document->first_child(); node; node = node->next_sibling()) {
+        ps.push_back(node);
+    }
+    for (std::size_t i = 0; i < ps.size(); i += 2) {
+        document->remove_child(ps[i]);
+    }
+    ASSERT_EQ(xs.length(), 5u);
+    auto* node = document->first_child();
+    for (std::size_t i = 0; i < xs.length(); i++, node = node->next_sibling()) {
+        EXPECT_EQ(xs.item(i), node);
+    }
+
+    // Removing the rest empties the index; adding one back starts it over.
+    while (document->first_child()) {
+        document->remove_child(document->first_child());
+    }
+    EXPECT_EQ(xs.length(), 0u);
+    EXPECT_EQ(document->get_element_by_id("p0"), nullptr);
+    auto* p = document->create_element("p");
+    p->append_attribute("class", "x");
+    document->append_child(p);
+    ASSERT_EQ(xs.length(), 1u);
+    EXPECT_EQ(xs.item(0), p);
+}
+
+TEST(NodeTest, insertions_anywhere_keep_an_index_in_tree_order)
+{
+    auto document = HTMLParser::parse("<div class=x id=a><p class=x></p><p></p></div><p class=x></p>");
+    auto* div = static_cast<Element*>(document->first_child());
+    auto xs = document->get_elements_by_class_name("x");
+    auto expect_tree_order = [&] {
+        std::vector<Element*> expected;
+        for (auto* node : Traversal::preorder(document.get())) {
+            if (node->node_type() == Node::Type::ELEMENT_NODE && static_cast<Element*>(node)->has_class("x")) {
+                expected.push_back(static_cast<Element*>(node));
+            }
+        }
+        ASSERT_EQ(xs.length(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(xs.item(i), expected[i]);
+        }
+    };
+
+    auto make = [&](const char* name) {
+        auto* element = document->create_element(name);
+        element->append_attribute("class", "x");
+        return element;
+    };
+    // Before an element with the class, and between two without it.
+    div->insert_before(make("a"), div->first_child());
+    div->insert_before(make("b"), div->last_child());
+    expect_tree_order();
+    // Around ancestors and descendants with the class.
+    auto* outer = make("section");
+    outer->append_child(make("c"));
+    document->insert_before(outer, div);
+    div->last_child()->append_child(make("d"));
+    expect_tree_order();
+    // A fragment, a replacement and an element given the class late.
+    auto* fragment = document->create_document_fragment();
+    fragment->append_child(make("e"));
+    fragment->append_child(document->create_element("f"));
+    fragment->append_child(make("g"));
+    div->insert_before(fragment, div->first_child()->next_sibling());
+    div->replace_child(make("h"), div->first_child());
+    static_cast<Element*>(div->last_child())->set_attribute("class", "y x");
+    expect_tree_order();
+
+    // IDs too: the first in tree order wins.
+    auto* same = document->create_element("p");
+    same->append_attribute("id", "a");
+    EXPECT_EQ(document->get_element_by_id("a"), div);
+    document->insert_before(same, outer);
+    EXPECT_EQ(document->get_element_by_id("a"), same);
+    document->remove_child(same);
+    div->first_child()->append_child(same);
+    EXPECT_EQ(document->get_element_by_id("a"), div);
+}
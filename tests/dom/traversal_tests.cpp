@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "dom/document.h"
+#include "dom/element.h"
+#include "dom/text.h"
+#include "dom/traversal.h"
+#include "html/parser.h"
+
+namespace {
+
+/// The local name of an element, the data of a text node, or "#".
+std::string label(const Node* node)
+{
+    switch (node->node_type()) {
+    case Node::Type::ELEMENT_NODE:
+        return std::string(static_cast<const Element*>(node)->local_name());
+    case Node::Type::TEXT_NODE:
+        return std::string(static_cast<const Text*>(node)->data());
+    default:
+        return "#";
+    }
+}
+
+template <typename Nodes>
+std::vector<std::string> labels(Nodes&& nodes)
+{
+    std::vector<std::string> out;
+    for (auto* node : nodes) {
+        out.push_back(label(node));
+    }
+    return out;
+}
+
+bool is(const Node* node, std::string_view local_name)
+{
+    return node->node_type() == Node::Type::ELEMENT_NODE
+        && static_cast<const Element*>(node)->local_name() == local_name;
+}
+
+constexpr const char* kTree = "<div><p>a<b>b</b></p><ul><li>c</li><li>d</li></ul>e</div>";
+
+using Strings = std::vector<std::string>;
+
+} // namespace
+
+TEST(TraversalTest, walks_preorder_and_postorder)
+{
+    auto document = HTMLParser::parse(kTree);
+    EXPECT_EQ(labels(Traversal::preorder(document.get())),
+        (Strings { "#", "div", "p", "a", "b", "b", "ul", "li", "c", "li", "d", "e" }));
+    EXPECT_EQ(labels(Traversal::postorder(document.get())),
+        (Strings { "a", "b", "b", "p", "c", "li", "d", "li", "ul", "e", "div", "#" }));
+
+    // A subtree stops at its root, even though the root has siblings.
+    auto* p = document->first_child()->first_child();
+    EXPECT_EQ(labels(Traversal::preorder(p)), (Strings { "p", "a", "b", "b" }));
+    EXPECT_EQ(labels(Traversal::postorder(p)), (Strings { "a", "b", "b", "p" }));
+
+    Document empty;
+    EXPECT_EQ(labels(Traversal::preorder(&empty)), (Strings { "#" }));
+    EXPECT_EQ(labels(Traversal::postorder(&empty)), (Strings { "#" }));
+}
+
+TEST(TraversalTest, preorder_skips_subtrees)
+{
+    auto document = HTMLParser::parse(kTree);
+    Strings seen;
+    auto range = Traversal::preorder(document.get());
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        seen.push_back(label(*it));
+        if (is(*it, "p") || is(*it, "li")) {
+            it.skip_children();
+        }
+    }
+    EXPECT_EQ(seen, (Strings { "#", "div", "p", "ul", "li", "li", "e" }));
+}
+
+TEST(TraversalTest, walks_deep_trees_without_recursion)
+{
+    std::string input;
+    for (int i = 0; i < 200000; i++) {
+        input += "<div>";
+    }
+    auto document = HTMLParser::parse(input);
+
+    std::size_t count = 0;
+    for (auto* node : Traversal::preorder(document.get())) {
+        (void)node;
+        count++;
+    }
+    EXPECT_EQ(count, 200001u);
+
+    TreeWalker walker(document.get(), NodeFilter::SHOW_ELEMENT);
+    count = 0;
+    for (auto* node : walker) {
+        (void)node;
+        count++;
+    }
+    EXPECT_EQ(count, 200000u);
+    EXPECT_EQ(walker.previous_node(), walker.current_node()->parent_node());
+}
+
+TEST(TreeWalkerTest, filters_by_type_and_predicate)
+{
+    auto document = HTMLParser::parse(kTree);
+
+    TreeWalker text(document.get(), NodeFilter::SHOW_TEXT);
+    EXPECT_EQ(labels(text), (Strings { "a", "b", "c", "d", "e" }));
+
+    // Rejecting a node leaves out its subtree, skipping it only the node itself.
+    TreeWalker rejecting(document.get(), NodeFilter::SHOW_ALL, [](Node* node) {
+        return is(node, "ul") ? NodeFilter::Result::FILTER_REJECT : NodeFilter::Result::FILTER_ACCEPT;
+    });
+    EXPECT_EQ(labels(rejecting), (Strings { "div", "p", "a", "b", "b", "e" }));
+    TreeWalker skipping(document.get(), NodeFilter::SHOW_ALL, [](Node* node) {
+        return is(node, "ul") ? NodeFilter::Result::FILTER_SKIP : NodeFilter::Result::FILTER_ACCEPT;
+    });
+    EXPECT_EQ(labels(skipping), (Strings { "div", "p", "a", "b", "b", "li", "c", "li", "d", "e" }));
+}
+
+TEST(TreeWalkerTest, moves_between_relatives)
+{
+    auto document = HTMLParser::parse(kTree);
+    TreeWalker walker(document.get(), NodeFilter::SHOW_ELEMENT, [](Node* node) {
+        return is(node, "ul") ? NodeFilter::Result::FILTER_SKIP : NodeFilter::Result::FILTER_ACCEPT;
+    });
+
+    EXPECT_EQ(label(walker.first_child()), "div");
+    EXPECT_EQ(label(walker.first_child()), "p");
+    // The skipped <ul> is looked through.
+    auto* li = walker.next_sibling();
+    ASSERT_TRUE(li);
+    EXPECT_EQ(label(li), "li");
+    EXPECT_EQ(label(walker.parent_node()), "div");
+    EXPECT_EQ(walker.last_child(), li->next_sibling());
+    EXPECT_EQ(walker.previous_sibling(), li);
+    EXPECT_EQ(label(walker.previous_sibling()), "p");
+    EXPECT_EQ(walker.previous_sibling(), nullptr);
+    EXPECT_EQ(label(walker.current_node()), "p");
+
+    // Preorder backwards from the last element, up to the root.
+    walker.set_current_node(li->next_sibling());
+    Strings backwards;
+    while (auto* node = walker.previous_node()) {
+        backwards.push_back(label(node));
+    }
+    EXPECT_EQ(backwards, (Strings { "li", "b", "p", "div" }));
+    EXPECT_EQ(walker.parent_node(), nullptr);
+}
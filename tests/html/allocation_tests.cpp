@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "html/tokenizer.h"
+
+// Counts every heap allocation made by this test binary while `counting` is
+// set. The other tests are unaffected apart from the extra increment.
+namespace {
+
+std::atomic<bool> counting { false };
+std::atomic<std::size_t> allocations { 0 };
+
+void* counted_alloc(std::size_t size)
+{
+    if (counting.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return counted_alloc(size); }
+void* operator new[](std::size_t size) { return counted_alloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+/// A page section that exercises every kind of token, with unknown names so
+/// that the interner is involved as well.
+std::string make_block(int i)
+{
+    return "<div class=\"item item-" + std::to_string(i % 7) + "\" id='n" + std::to_string(i)
+        + "' data-index=" + std::to_string(i) + " hidden>"
+        + "<my-widget Value=\"" + std::string(i % 50, 'v') + "\"/>"
+        + "Some text with <b>bold</b> and <A HREF=/x?y=" + std::to_string(i) + ">a link</A>."
+        + "<!-- comment " + std::to_string(i) + " --><br></div>\n";
+}
+
+} // namespace
+
+TEST(AllocationTest, borrowed_tokens_do_not_allocate_after_warm_up)
+{
+    constexpr int kWarmUpBlocks = 100;
+    constexpr int kBlocks = 5000;
+
+    std::string input;
+    std::size_t warm_up_end = 0;
+    for (int i = 0; i < kBlocks; i++) {
+        input += make_block(i);
+        if (i == kWarmUpBlocks - 1) {
+            warm_up_end = input.size();
+        }
+    }
+
+    Tokenizer tokenizer(input);
+    std::size_t tokens = 0;
+    std::size_t text_bytes = 0;
+
+    // Warm up: lets the tag buffers and the interner reach their final size.
+    std::string_view last_text;
+    while (true) {
+        auto token = tokenizer.next_view();
+        if (token.kind == Token::Kind::TextRun) {
+            last_text = token.text;
+        }
+        if (last_text.data() + last_text.size() >= input.data() + warm_up_end) {
+            break;
+        }
+    }
+
+    allocations = 0;
+    counting = true;
+    while (true) {
+        auto token = tokenizer.next_view();
+        tokens++;
+        if (token.kind == Token::Kind::TextRun) {
+            text_bytes += token.text.size();
+        }
+        if (token.kind == Token::Kind::EndOfFile) {
+            break;
+        }
+    }
+    counting = false;
+
+    EXPECT_GT(tokens, 10 * (kBlocks - kWarmUpBlocks));
+    EXPECT_GT(text_bytes, 0);
+    EXPECT_EQ(allocations.load(), 0) << "over " << tokens << " tokens";
+}
+
+TEST(AllocationTest, borrowed_tag_matches_owned_tag)
+{
+    Tokenizer borrowed("<a href=x CLASS='y z' x-y>");
+    Tokenizer owned("<a href=x CLASS='y z' x-y>");
+
+    auto view = borrowed.next_view();
+    auto token = owned.next();
+    ASSERT_EQ(view.kind, Token::Kind::StartTag);
+    auto& tag = std::get<Token::StartTag>(token.data).tag;
+    EXPECT_EQ(view.tag.id, tag.id);
+    EXPECT_EQ(view.tag.name, tag.name);
+    ASSERT_EQ(view.tag.attributes.size(), tag.attributes.size());
+    for (std::size_t i = 0; i < tag.attributes.size(); i++) {
+        EXPECT_EQ(view.tag.attributes[i].id, tag.attributes[i].id);
+        EXPECT_EQ(view.tag.attributes[i].name, tag.attributes[i].name);
+        EXPECT_EQ(view.tag.attributes[i].value, tag.attributes[i].value);
+    }
+    EXPECT_EQ(view.tag.attributes[1].value, "y z");
+}
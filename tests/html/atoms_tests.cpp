@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "html/atoms.h"
+#include "html/tokenizer.h"
+
+TEST(AtomsTest, known_names_round_trip)
+{
+#define X(id, name)                                  \
+    EXPECT_EQ(Atoms::lookup_tag(name), TagId::id); \
+    EXPECT_EQ(Atoms::name_of(TagId::id), name);
+    EVEN_HTML_TAG_NAMES(X)
+#undef X
+
+#define X(id, name)                                    \
+    EXPECT_EQ(Atoms::lookup_attr(name), AttrId::id); \
+    EXPECT_EQ(Atoms::name_of(AttrId::id), name);
+    EVEN_HTML_ATTRIBUTE_NAMES(X)
+#undef X
+}
+
+TEST(AtomsTest, unknown_names)
+{
+    EXPECT_EQ(Atoms::lookup_tag(""), TagId::Unknown);
+    EXPECT_EQ(Atoms::lookup_tag("my-element"), TagId::Unknown);
+    EXPECT_EQ(Atoms::lookup_tag("DIV"), TagId::Unknown);
+    EXPECT_EQ(Atoms::lookup_tag("divx"), TagId::Unknown);
+    EXPECT_EQ(Atoms::lookup_attr("data-foo"), AttrId::Unknown);
+    EXPECT_EQ(Atoms::name_of(TagId::Unknown), "");
+}
+
+TEST(AtomsTest, lookup_is_constexpr)
+{
+    static_assert(Atoms::lookup_tag("div") == TagId::Div);
+    static_assert(Atoms::lookup_attr("http-equiv") == AttrId::HttpEquiv);
+    static_assert(Atoms::lookup_tag("blah") == TagId::Unknown);
+}
+
+TEST(AtomsTest, interner_returns_stable_views)
+{
+    AtomInterner interner;
+    auto first = interner.intern("my-element");
+    std::string buffer = "my-element";
+    auto second = interner.intern(buffer);
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(interner.size(), 1);
+
+    for (int i = 0; i < 1000; i++) {
+        interner.intern("x-" + std::to_string(i));
+    }
+    EXPECT_EQ(interner.intern("my-element").data(), first.data());
+    EXPECT_EQ(first, "my-element");
+}
+
+TEST(AtomsTest, tokenizer_emits_atoms)
+{
+    Tokenizer tokenizer("<DIV Class=a data-x=b></my-element>");
+
+    Token t = tokenizer.next();
+    ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
+    auto& start = std::get<Token::StartTag>(t.data).tag;
+    EXPECT_EQ(start.id, TagId::Div);
+    EXPECT_EQ(start.name.data(), Atoms::name_of(TagId::Div).data());
+    ASSERT_EQ(start.attributes.size(), 2);
+    EXPECT_EQ(start.attributes[0].id, AttrId::Class);
+    EXPECT_EQ(start.attributes[1].id, AttrId::Unknown);
+    EXPECT_EQ(start.attributes[1].name, "data-x");
+
+    t = tokenizer.next();
+    ASSERT_TRUE(std::holds_alternative<Token::EndTag>(t.data));
+    auto& end = std::get<Token::EndTag>(t.data).tag;
+    EXPECT_EQ(end.id, TagId::Unknown);
+    EXPECT_EQ(end.name, "my-element");
+}
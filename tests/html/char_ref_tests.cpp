@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "html/entities.h"
+#include "html/parse_error.h"
+#include "html/tokenizer.h"
+
+namespace {
+
+constexpr Engine kEngines[] = { Engine::Switch, Engine::Table, Engine::Verify };
+
+/// Text and attribute values of a document, in order, with tags as "<name>"
+/// and attributes as "[name=value]", so that decoding can be compared as one
+/// string regardless of how text was split into tokens.
+std::string render(Tokenizer& tokenizer)
+{
+    std::string out;
+    while (true) {
+        auto token = tokenizer.next_view();
+        switch (token.kind) {
+        case Token::Kind::StartTag:
+            out += "<" + std::string(token.tag.name) + ">";
+            for (const auto& attr : token.tag.attributes) {
+                out += "[" + std::string(attr.name) + "=" + std::string(attr.value) + "]";
+            }
+            break;
+        case Token::Kind::EndTag:
+            out += "</" + std::string(token.tag.name) + ">";
+            break;
+        case Token::Kind::Character:
+            out += token.ch;
+            break;
+        case Token::Kind::TextRun:
+            out += token.text;
+            break;
+        case Token::Kind::EndOfFile:
+            return out;
+        }
+    }
+}
+
+std::string decode(std::string_view input, Engine engine = Engine::Switch,
+    TextMode text_mode = TextMode::Run)
+{
+    Tokenizer tokenizer(input, text_mode, engine);
+    return render(tokenizer);
+}
+
+std::vector<ParseError> errors_of(std::string_view input, Engine engine = Engine::Switch)
+{
+    Tokenizer tokenizer(input, TextMode::Run, engine);
+    render(tokenizer);
+    return { tokenizer.parse_errors().begin(), tokenizer.parse_errors().end() };
+}
+
+} // namespace
+
+TEST(EntitiesTest, matches_the_longest_name)
+{
+    auto amp = Entities::match("amp;x");
+    EXPECT_EQ(amp.length, 4u);
+    EXPECT_EQ(amp.value, "&");
+    EXPECT_FALSE(amp.truncated);
+
+    // Legacy names match without their semicolon.
+    auto legacy = Entities::match("ampx");
+    EXPECT_EQ(legacy.length, 3u);
+    EXPECT_EQ(legacy.value, "&");
+
+    auto notin = Entities::match("notin;");
+    EXPECT_EQ(notin.length, 6u);
+    EXPECT_EQ(notin.value, "∉");
+
+    EXPECT_EQ(Entities::match("xyz;").length, 0u);
+}
+
+TEST(EntitiesTest, reports_when_more_input_could_match_more)
+{
+    auto partial = Entities::match("not");
+    EXPECT_EQ(partial.length, 3u);
+    EXPECT_TRUE(partial.truncated);
+
+    auto prefix = Entities::match("noti");
+    EXPECT_EQ(prefix.length, 3u);
+    EXPECT_TRUE(prefix.truncated);
+
+    EXPECT_FALSE(Entities::match("not ").truncated);
+}
+
+TEST(CharRefTest, decodes_named_references_in_text)
+{
+    for (auto engine : kEngines) {
+        EXPECT_EQ(decode("a &amp; b &lt;p&gt; &copy;", engine), "a & b <p> ©") << static_cast<int>(engine);
+        EXPECT_EQ(decode("&NotNestedGreaterGreater;", engine), "⪢̸");
+        EXPECT_EQ(decode("&notit; &notin;", engine), "¬it; ∉");
+    }
+}
+
+TEST(CharRefTest, decodes_numeric_references)
+{
+    for (auto engine : kEngines) {
+        EXPECT_EQ(decode("&#65;&#x42;&#X43;&#x1F600;", engine), "ABC\U0001F600");
+        EXPECT_EQ(decode("&#0065&#x42 x", engine), "AB x");
+        EXPECT_EQ(decode("&#x80;&#150;", engine), "€–");
+        EXPECT_EQ(decode("&#0;&#xD800;&#x110000;&#99999999999999;", engine), "����");
+    }
+}
+
+TEST(CharRefTest, leaves_non_references_alone)
+{
+    for (auto engine : kEngines) {
+        EXPECT_EQ(decode("a & b && c", engine), "a & b && c");
+        EXPECT_EQ(decode("&#; &#x; &#xg", engine), "&#; &#x; &#xg");
+        EXPECT_EQ(decode("&unknown; &zz", engine), "&unknown; &zz");
+        EXPECT_EQ(decode("&", engine), "&");
+        EXPECT_EQ(decode("&#", engine), "&#");
+    }
+}
+
+TEST(CharRefTest, decodes_references_in_attribute_values)
+{
+    for (auto engine : kEngines) {
+        EXPECT_EQ(decode("<a title=\"x &amp; y\" alt='&lt;&#62;' id=a&gt;b>", engine),
+            "<a>[title=x & y][alt=<>][id=a>b]");
+        // For historical reasons a legacy name without a semicolon stays as is
+        // when an alphanumeric or '=' follows it, as in query strings.
+        EXPECT_EQ(decode("<a href=\"?a=1&copy=2&not;&notx\">", engine),
+            "<a>[href=?a=1&copy=2¬&notx]");
+        EXPECT_EQ(decode("<a href=\"&not \">", engine), "<a>[href=¬ ]");
+        EXPECT_EQ(decode("<a b='&bogus;&'>", engine), "<a>[b=&bogus;&]");
+    }
+}
+
+TEST(CharRefTest, character_mode_emits_each_byte)
+{
+    for (auto engine : kEngines) {
+        EXPECT_EQ(decode("x&amp;&eacute;&#65;&zz;", engine, TextMode::Character), "x&éA&zz;");
+    }
+
+    Tokenizer tokenizer("&eacute;", TextMode::Character);
+    auto first = tokenizer.next_view();
+    auto second = tokenizer.next_view();
+    EXPECT_EQ(first.kind, Token::Kind::Character);
+    EXPECT_EQ(first.ch, '\xc3');
+    EXPECT_EQ(second.ch, '\xa9');
+    EXPECT_EQ(second.offset, 0u);
+    EXPECT_EQ(tokenizer.next_view().kind, Token::Kind::EndOfFile);
+}
+
+TEST(CharRefTest, text_without_references_stays_one_run)
+{
+    Tokenizer tokenizer("a &amp; b");
+    auto before = tokenizer.next_view();
+    auto amp = tokenizer.next_view();
+    auto after = tokenizer.next_view();
+    EXPECT_EQ(before.text, "a ");
+    EXPECT_EQ(amp.text, "&");
+    EXPECT_EQ(amp.offset, 2u);
+    EXPECT_EQ(after.text, " b");
+    EXPECT_EQ(after.offset, 7u);
+}
+
+TEST(CharRefTest, reports_parse_errors)
+{
+    for (auto engine : kEngines) {
+        std::vector<ParseError> expected {
+            { ParseErrorCode::MissingSemicolonAfterCharacterReference, 2 },
+            { ParseErrorCode::AbsenceOfDigitsInNumericCharacterReference, 7 },
+            { ParseErrorCode::UnknownNamedCharacterReference, 12 },
+            { ParseErrorCode::MissingSemicolonAfterCharacterReference, 17 },
+            { ParseErrorCode::NullCharacterReference, 17 },
+            { ParseErrorCode::ControlCharacterReference, 23 },
+            { ParseErrorCode::SurrogateCharacterReference, 31 },
+            { ParseErrorCode::NoncharacterCharacterReference, 39 },
+            { ParseErrorCode::CharacterReferenceOutsideUnicodeRange, 50 },
+        };
+        EXPECT_EQ(errors_of("&lt &#x; &xq; &#0 &#x81;&#xdfff;&#xfffe; &#x110000;", engine), expected)
+            << static_cast<int>(engine);
+    }
+}
+
+TEST(CharRefTest, references_split_across_chunks_decode_the_same)
+{
+    std::string_view input = "<p title='&notin;&not=&ampx'>&notin; &#x2209;&#8713 &noti &amp&";
+    auto whole = decode(input);
+
+    for (auto engine : kEngines) {
+        for (auto text_mode : { TextMode::Run, TextMode::Character }) {
+            Tokenizer tokenizer(text_mode, engine);
+            std::string out;
+            auto drain = [&] {
+                while (auto token = tokenizer.try_next_view()) {
+                    if (token->kind == Token::Kind::TextRun) {
+                        out += token->text;
+                    } else if (token->kind == Token::Kind::Character) {
+                        out += token->ch;
+                    } else if (token->kind == Token::Kind::StartTag) {
+                        out += "<p>";
+                        for (const auto& attr : token->tag.attributes) {
+                            out += "[" + std::string(attr.name) + "=" + std::string(attr.value) + "]";
+                        }
+                    } else {
+                        break;
+                    }
+                }
+            };
+            for (char ch : input) {
+                tokenizer.feed(std::string_view(&ch, 1));
+                drain();
+            }
+            tokenizer.finish();
+            drain();
+            EXPECT_EQ(out, whole) << static_cast<int>(engine);
+        }
+    }
+    EXPECT_EQ(whole, "<p>[title=∉&not=&ampx]∉ ∉∉ ¬i &&");
+}
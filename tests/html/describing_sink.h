@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "html/parse_error.h"
+#include "html/tokenizer.h"
+
+/// Describes every token and parse error, with offsets, in the order the sink
+/// receives them.
+struct DescribingSink {
+    std::vector<std::string> out;
+
+    void on_start_tag(const TagView& tag)
+    {
+        auto line = "<" + std::string(tag.name) + "@" + std::to_string(tag.offset);
+        for (const auto& attr : tag.attributes) {
+            line += " " + std::string(attr.name) + "=" + std::string(attr.value);
+        }
+        out.push_back(line + (tag.self_closing ? " />" : ">"));
+    }
+    void on_end_tag(const TagView& tag)
+    {
+        out.push_back("</" + std::string(tag.name) + "@" + std::to_string(tag.offset) + ">");
+    }
+    void on_text(std::string_view text, std::uint32_t offset)
+    {
+        out.push_back("text@" + std::to_string(offset) + ":" + std::string(text));
+    }
+    void on_char(char ch, std::uint32_t offset)
+    {
+        out.push_back("char@" + std::to_string(offset) + ":" + std::string(1, ch));
+    }
+    void on_eof() { out.push_back("eof"); }
+    void on_parse_error(ParseError error)
+    {
+        out.push_back("error@" + std::to_string(error.offset) + ":"
+            + std::to_string(static_cast<int>(error.code)));
+    }
+};
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+
+#include "html/encoding.h"
+
+namespace {
+
+/// Decodes `chunks` in order and concatenates the output.
+std::string decode(Encoding encoding, std::initializer_list<std::string_view> chunks)
+{
+    TextDecoder decoder(encoding);
+    std::string out;
+    std::size_t i = 0;
+    for (auto chunk : chunks) {
+        out += decoder.decode(chunk, ++i == chunks.size());
+    }
+    return out;
+}
+
+std::string utf16le(std::u16string_view units)
+{
+    std::string out;
+    for (auto unit : units) {
+        out += static_cast<char>(unit & 0xFF);
+        out += static_cast<char>(unit >> 8);
+    }
+    return out;
+}
+
+std::string utf16be(std::u16string_view units)
+{
+    std::string out;
+    for (auto unit : units) {
+        out += static_cast<char>(unit >> 8);
+        out += static_cast<char>(unit & 0xFF);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(EncodingTest, resolves_labels)
+{
+    EXPECT_EQ(encoding_for_label("utf-8"), Encoding::Utf8);
+    EXPECT_EQ(encoding_for_label(" UTF8\t"), Encoding::Utf8);
+    EXPECT_EQ(encoding_for_label("ISO-8859-1"), Encoding::Windows1252);
+    EXPECT_EQ(encoding_for_label("us-ascii"), Encoding::Windows1252);
+    EXPECT_EQ(encoding_for_label("utf-16"), Encoding::Utf16LE);
+    EXPECT_EQ(encoding_for_label("UTF-16BE"), Encoding::Utf16BE);
+    EXPECT_EQ(encoding_for_label("shift_jis"), std::nullopt);
+    EXPECT_EQ(encoding_for_label(""), std::nullopt);
+    EXPECT_EQ(name_of(Encoding::Windows1252), "windows-1252");
+}
+
+TEST(EncodingTest, prescans_meta)
+{
+    EXPECT_EQ(prescan_for_encoding("<meta charset=utf-8>"), Encoding::Utf8);
+    EXPECT_EQ(prescan_for_encoding("<!doctype html><META CHARSET='latin1'>"), Encoding::Windows1252);
+    EXPECT_EQ(prescan_for_encoding(
+                  "<meta http-equiv=\"Content-Type\" content=\"text/html; charset=ISO-8859-1\">"),
+        Encoding::Windows1252);
+    // Without the pragma, content is ignored.
+    EXPECT_EQ(prescan_for_encoding("<meta content=\"text/html; charset=utf-8\">"), std::nullopt);
+    // UTF-16 can't be declared in a document that the prescan could read.
+    EXPECT_EQ(prescan_for_encoding("<meta charset=utf-16le>"), Encoding::Utf8);
+    // Comments, other tags and their attributes are skipped.
+    EXPECT_EQ(prescan_for_encoding("<!-- <meta charset=latin1> --><meta charset=utf-8>"), Encoding::Utf8);
+    EXPECT_EQ(prescan_for_encoding("<div title='<meta charset=latin1>'><meta charset=utf-8>"), Encoding::Utf8);
+    // Unsupported encodings and anything past the first 1024 bytes don't count.
+    EXPECT_EQ(prescan_for_encoding("<meta charset=shift_jis>"), std::nullopt);
+    EXPECT_EQ(prescan_for_encoding(std::string(1024, ' ') + "<meta charset=utf-8>"), std::nullopt);
+}
+
+TEST(EncodingTest, sniffs_in_spec_order)
+{
+    auto bom = sniff_encoding("\xFF\xFE<\0", Encoding::Utf8);
+    EXPECT_EQ(bom.encoding, Encoding::Utf16LE);
+    EXPECT_EQ(bom.confidence, EncodingConfidence::Certain);
+
+    auto hint = sniff_encoding("<meta charset=utf-8>", Encoding::Windows1252);
+    EXPECT_EQ(hint.encoding, Encoding::Windows1252);
+    EXPECT_EQ(hint.confidence, EncodingConfidence::Certain);
+
+    auto meta = sniff_encoding("<meta charset=utf-8>");
+    EXPECT_EQ(meta.encoding, Encoding::Utf8);
+    EXPECT_EQ(meta.confidence, EncodingConfidence::Tentative);
+
+    EXPECT_EQ(sniff_encoding("<p>caf\xC3\xA9").encoding, Encoding::Utf8);
+    EXPECT_EQ(sniff_encoding("<p>caf\xE9").encoding, Encoding::Windows1252);
+    EXPECT_EQ(sniff_encoding("<p>plain").encoding, Encoding::Windows1252);
+    EXPECT_EQ(sniff_encoding("<p>plain", std::nullopt, Encoding::Utf8).encoding, Encoding::Utf8);
+
+    // A character cut off by the end of the sniffed window is still UTF-8.
+    std::string long_text = std::string(1022, 'a') + "\xE2\x82\xAC";
+    EXPECT_EQ(sniff_encoding(long_text).encoding, Encoding::Utf8);
+}
+
+TEST(EncodingTest, decodes_windows_1252)
+{
+    TextDecoder decoder(Encoding::Windows1252);
+    std::string_view ascii = "<p>plain</p>";
+    auto view = decoder.decode(ascii);
+    EXPECT_EQ(view, ascii);
+    EXPECT_EQ(view.data(), ascii.data());
+
+    EXPECT_EQ(decoder.decode("caf\xE9 \x80\x93\x81 \xFF"),
+        "caf\xC3\xA9 \xE2\x82\xAC\xE2\x80\x9C\xC2\x81 \xC3\xBF");
+}
+
+TEST(EncodingTest, decodes_utf16)
+{
+    std::u16string text = u"<p>café € \U0001F600</p>";
+    std::string expected = "<p>caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80</p>";
+    EXPECT_EQ(decode(Encoding::Utf16LE, { utf16le(text) }), expected);
+    EXPECT_EQ(decode(Encoding::Utf16BE, { utf16be(text) }), expected);
+
+    // Split at every byte, through code units and surrogate pairs.
+    auto bytes = utf16le(text);
+    TextDecoder decoder(Encoding::Utf16LE);
+    std::string out;
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+        out += decoder.decode(std::string_view(bytes).substr(i, 1), i + 1 == bytes.size());
+    }
+    EXPECT_EQ(out, expected);
+}
+
+TEST(EncodingTest, replaces_invalid_utf16)
+{
+    // A lone trail, a lead followed by something else, and a lead at the end.
+    EXPECT_EQ(decode(Encoding::Utf16LE, { utf16le(u"a\xDC00" "b\xD800" "c\xD800") }),
+        "a\xEF\xBF\xBD" "b\xEF\xBF\xBD" "c\xEF\xBF\xBD");
+    // An odd byte at the end.
+    EXPECT_EQ(decode(Encoding::Utf16BE, { utf16be(u"a") + std::string(1, '\0') }), std::string("a\xEF\xBF\xBD"));
+    // A lead surrogate still waits for the next chunk unless it was the last.
+    EXPECT_EQ(decode(Encoding::Utf16LE, { utf16le(u"\xD83D"), utf16le(u"\xDE00") }), "\xF0\x9F\x98\x80");
+}
+
+TEST(EncodingTest, strips_byte_order_mark)
+{
+    EXPECT_EQ(decode(Encoding::Utf8, { "\xEF\xBB\xBFok" }), "ok");
+    EXPECT_EQ(decode(Encoding::Utf8, { "\xEF", "\xBB", "\xBFok" }), "ok");
+    EXPECT_EQ(decode(Encoding::Utf8, { "\xEF", "\xBBx" }), "\xEF\xBBx");
+    EXPECT_EQ(decode(Encoding::Utf8, { "o", "k" }), "ok");
+    EXPECT_EQ(decode(Encoding::Utf16LE, { "\xFF", "\xFEo", std::string_view("\0k\0", 3) }), "ok");
+    EXPECT_EQ(decode(Encoding::Utf16BE, { "\xFE\xFF" + utf16be(u"ok") }), "ok");
+    // Only at the start of the stream.
+    EXPECT_EQ(decode(Encoding::Utf8, { "ok", "\xEF\xBB\xBF" }), "ok\xEF\xBB\xBF");
+}
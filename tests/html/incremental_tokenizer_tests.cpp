@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "describing_sink.h"
+#include "html/incremental_tokenizer.h"
+#include "html/tokenizer.h"
+
+namespace {
+
+std::vector<std::string> describe(const IncrementalTokenizer& tokenizer)
+{
+    DescribingSink sink;
+    tokenizer.run(sink);
+    return sink.out;
+}
+
+void expect_matches_serial(const IncrementalTokenizer& tokenizer, TextMode mode = TextMode::Run)
+{
+    Tokenizer serial(tokenizer.document(), mode);
+    DescribingSink sink;
+    serial.run(sink);
+    EXPECT_EQ(describe(tokenizer), sink.out) << "document " << tokenizer.document();
+}
+
+std::string rows(int count)
+{
+    std::string input;
+    for (int i = 0; i < count; i++) {
+        input += "<div class=\"row r" + std::to_string(i) + "\"><td>cell &amp; "
+            + std::to_string(i) + "</td><!-- note --></div>\n";
+    }
+    return input;
+}
+
+} // namespace
+
+TEST(IncrementalTokenizerTest, matches_serial_tokenizer)
+{
+    IncrementalTokenizer tokenizer(rows(50), 64);
+    expect_matches_serial(tokenizer);
+    EXPECT_GT(tokenizer.checkpoint_count(), 1u);
+    EXPECT_EQ(tokenizer.last_tokenized_bytes(), tokenizer.document().size());
+}
+
+TEST(IncrementalTokenizerTest, small_edit_retokenizes_near_the_edit)
+{
+    IncrementalTokenizer tokenizer(rows(2000), 256);
+    auto size = tokenizer.document().size();
+    auto middle = tokenizer.document().find("cell", size / 2);
+
+    tokenizer.edit(middle, middle + 4, "changed <b>cell</b>");
+    expect_matches_serial(tokenizer);
+    EXPECT_LT(tokenizer.last_tokenized_bytes(), 1024u);
+
+    // Undo it.
+    tokenizer.edit(middle, middle + 19, "cell");
+    expect_matches_serial(tokenizer);
+    EXPECT_LT(tokenizer.last_tokenized_bytes(), 1024u);
+    EXPECT_EQ(tokenizer.document().size(), size);
+}
+
+TEST(IncrementalTokenizerTest, edit_that_changes_the_state_after_it)
+{
+    // An unclosed quote turns the rest of the document into an attribute
+    // value, leaving nothing but errors and the end of file, and taking it out
+    // again brings the tags back.
+    IncrementalTokenizer tokenizer(rows(100), 64);
+    tokenizer.edit(10, 10, "<a title='");
+    expect_matches_serial(tokenizer);
+    EXPECT_EQ(tokenizer.last_tokenized_bytes(), tokenizer.document().size());
+    for (const auto& token : describe(tokenizer)) {
+        EXPECT_TRUE(token.rfind("error@", 0) == 0 || token == "eof") << token;
+    }
+
+    tokenizer.edit(10, 20, "");
+    expect_matches_serial(tokenizer);
+    EXPECT_EQ(tokenizer.document(), rows(100));
+}
+
+TEST(IncrementalTokenizerTest, appends)
+{
+    IncrementalTokenizer tokenizer("", 32);
+    std::string document;
+    auto input = rows(40);
+    for (std::size_t pos = 0; pos < input.size(); pos += 37) {
+        auto bytes = input.substr(pos, 37);
+        tokenizer.append(bytes);
+        document += bytes;
+        expect_matches_serial(tokenizer);
+        // Everything up to the last checkpoint is kept.
+        EXPECT_LT(tokenizer.last_tokenized_bytes(), 200u);
+    }
+    EXPECT_EQ(tokenizer.document(), document);
+}
+
+TEST(IncrementalTokenizerTest, keeps_unknown_names_and_character_references)
+{
+    IncrementalTokenizer tokenizer("<my-tag data-x=1>a&lt;b</my-tag><p>x</p>", 4);
+    tokenizer.edit(33, 34, "pre");
+    expect_matches_serial(tokenizer);
+    tokenizer.edit(0, 0, "<i>");
+    expect_matches_serial(tokenizer);
+}
+
+TEST(IncrementalTokenizerTest, matches_serial_tokenizer_after_random_edits)
+{
+    const char alphabet[] = "<<<>/=\"'` \t\n!?aZ-9&#;xX\0";
+    std::mt19937 rng(18);
+    auto random_text = [&](std::size_t size) {
+        std::string text(size, ' ');
+        for (auto& ch : text) {
+            ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        }
+        return text;
+    };
+
+    for (int round = 0; round < 100; round++) {
+        auto mode = round % 3 == 0 ? TextMode::Character : TextMode::Run;
+        auto engine = round % 2 == 0 ? Engine::Switch : Engine::Table;
+        IncrementalTokenizer tokenizer(random_text(rng() % 400), 1 + rng() % 40, mode, engine);
+        expect_matches_serial(tokenizer, mode);
+        for (int edit = 0; edit < 10; edit++) {
+            auto size = tokenizer.document().size();
+            auto begin = size == 0 ? 0 : rng() % (size + 1);
+            auto end = begin + rng() % 10;
+            tokenizer.edit(begin, end, random_text(rng() % 10));
+            expect_matches_serial(tokenizer, mode);
+        }
+    }
+}
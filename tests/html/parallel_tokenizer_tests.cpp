@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "describing_sink.h"
+#include "html/parallel_tokenizer.h"
+#include "html/tokenizer.h"
+
+namespace {
+
+std::vector<std::string> tokenize_serial(std::string_view input, TextMode mode = TextMode::Run)
+{
+    Tokenizer tokenizer(input, mode);
+    DescribingSink sink;
+    tokenizer.run(sink);
+    return sink.out;
+}
+
+std::vector<std::string> tokenize_parallel(std::string_view input, std::size_t threads,
+    std::size_t chunk_size, TextMode mode = TextMode::Run, Engine engine = Engine::Switch)
+{
+    ParallelTokenizer tokenizer(input, threads, chunk_size, mode, engine);
+    DescribingSink sink;
+    tokenizer.run(sink);
+    return sink.out;
+}
+
+} // namespace
+
+TEST(ParallelTokenizerTest, matches_serial_tokenizer)
+{
+    std::string input;
+    for (int i = 0; i < 200; i++) {
+        input += "<div class=\"row r" + std::to_string(i) + "\"><td>cell &amp; "
+            + std::to_string(i) + "</td><!-- note --></div>\n";
+    }
+
+    for (std::size_t chunk_size : { 1, 16, 100, 4096 }) {
+        ParallelTokenizer tokenizer(input, 4, chunk_size);
+        DescribingSink sink;
+        tokenizer.run(sink);
+        EXPECT_EQ(sink.out, tokenize_serial(input)) << chunk_size;
+        EXPECT_GT(tokenizer.chunk_count(), 1u);
+    }
+}
+
+TEST(ParallelTokenizerTest, retokenizes_chunks_that_start_inside_markup)
+{
+    // The '<' that would start the second chunk is inside a comment, the one
+    // for the third inside an attribute value, so both speculations are wrong.
+    std::string input = "<!--" + std::string(20, 'x') + "<b> --><i title='" + std::string(20, 'y')
+        + "<x>'>z</i><u>&lt;</u>";
+    ParallelTokenizer tokenizer(input, 2, 10);
+    DescribingSink sink;
+    tokenizer.run(sink);
+    EXPECT_EQ(sink.out, tokenize_serial(input));
+    EXPECT_GT(tokenizer.retokenized_chunks(), 0u);
+}
+
+TEST(ParallelTokenizerTest, small_documents_use_one_chunk)
+{
+    ParallelTokenizer tokenizer("<p>short</p>", 8);
+    DescribingSink sink;
+    tokenizer.run(sink);
+    EXPECT_EQ(tokenizer.chunk_count(), 1u);
+    EXPECT_EQ(sink.out, tokenize_serial("<p>short</p>"));
+}
+
+TEST(ParallelTokenizerTest, matches_serial_tokenizer_on_random_markup)
+{
+    const char alphabet[] = "<<<>/=\"'` \t\n!?aZ-9&#;xX\0";
+    std::mt19937 rng(19);
+    for (int round = 0; round < 300; round++) {
+        std::string input(rng() % 400, ' ');
+        for (auto& ch : input) {
+            ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        }
+        auto expected = tokenize_serial(input);
+        auto threads = 2 + rng() % 3;
+        auto chunk_size = 1 + rng() % 50;
+        EXPECT_EQ(tokenize_parallel(input, threads, chunk_size), expected) << "input " << input;
+        EXPECT_EQ(tokenize_parallel(input, threads, chunk_size, TextMode::Run, Engine::Table), expected);
+        EXPECT_EQ(tokenize_parallel(input, threads, chunk_size, TextMode::Character),
+            tokenize_serial(input, TextMode::Character));
+    }
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "html/parse_error.h"
+#include "html/tokenizer.h"
+
+namespace {
+
+/// Sink that ignores tokens; parse errors go to a separate error sink.
+struct TokenSink {
+    void on_start_tag(const TagView&) { }
+    void on_end_tag(const TagView&) { }
+    void on_text(std::string_view, std::uint32_t) { }
+    void on_char(char, std::uint32_t) { }
+    void on_eof() { }
+};
+
+std::vector<ParseError> pull_errors(std::string_view input, Engine engine)
+{
+    Tokenizer tokenizer(input, TextMode::Run, engine);
+    while (tokenizer.next_view().kind != Token::Kind::EndOfFile) {
+    }
+    return { tokenizer.parse_errors().begin(), tokenizer.parse_errors().end() };
+}
+
+} // namespace
+
+TEST(ParseErrorTest, pull_api_records_codes_and_offsets)
+{
+    for (auto engine : { Engine::Switch, Engine::Table, Engine::Verify }) {
+        auto errors = pull_errors("a <?x> <p =x><a b=\"x\"c><div", engine);
+        std::vector<ParseError> expected {
+            { ParseErrorCode::UnexpectedQuestionMarkInsteadOfTagName, 3 },
+            { ParseErrorCode::UnexpectedEqualsSignBeforeAttributeName, 10 },
+            { ParseErrorCode::MissingWhitespaceBetweenAttributes, 21 },
+            { ParseErrorCode::EofInTag, 27 },
+        };
+        EXPECT_EQ(errors, expected) << static_cast<int>(engine);
+    }
+}
+
+TEST(ParseErrorTest, offsets_count_from_the_start_of_a_chunked_document)
+{
+    std::string_view input = "<p>text</>more<br/x>";
+    Tokenizer tokenizer;
+    for (char ch : input) {
+        tokenizer.feed(std::string_view(&ch, 1));
+        while (tokenizer.try_next_view()) {
+        }
+    }
+    tokenizer.finish();
+    while (tokenizer.next_view().kind != Token::Kind::EndOfFile) {
+    }
+
+    std::vector<ParseError> errors(tokenizer.parse_errors().begin(), tokenizer.parse_errors().end());
+    std::vector<ParseError> expected {
+        { ParseErrorCode::MissingEndTagName, 9 },
+        { ParseErrorCode::UnexpectedSolidusInTag, 18 },
+    };
+    EXPECT_EQ(errors, expected);
+}
+
+TEST(ParseErrorTest, run_reports_to_a_separate_error_sink)
+{
+    std::string_view input = "<a b='1'c='2'd></ ><e";
+    TokenSink tokens;
+
+    CountingErrorSink counts;
+    Tokenizer counted(input);
+    EXPECT_TRUE(counted.run(tokens, counts));
+    EXPECT_EQ(counts.total(), 4u);
+    EXPECT_EQ(counts.count(ParseErrorCode::MissingWhitespaceBetweenAttributes), 2u);
+    EXPECT_EQ(counts.count(ParseErrorCode::InvalidFirstCharacterOfTagName), 1u);
+    EXPECT_EQ(counts.count(ParseErrorCode::EofInTag), 1u);
+
+    // A sink without a handler drops them, as does the NullErrorSink.
+    Tokenizer dropped(input);
+    EXPECT_TRUE(dropped.run(tokens));
+    NullErrorSink none;
+    Tokenizer ignored(input);
+    EXPECT_TRUE(ignored.run(tokens, none));
+}
+
+TEST(ParseErrorTest, buffer_keeps_its_capacity_and_counts_the_rest)
+{
+    ParseErrorBuffer buffer(2);
+    Tokenizer tokenizer("</></></></>");
+    TokenSink tokens;
+    tokenizer.run(tokens, buffer);
+
+    ASSERT_EQ(buffer.size(), 2u);
+    EXPECT_EQ(buffer.dropped(), 2u);
+    EXPECT_EQ(to_string(buffer[1]), "missing-end-tag-name at offset 5");
+}
+
+TEST(ParseErrorTest, formats_with_line_and_column_on_demand)
+{
+    std::string_view input = "<p>\n<a b='x'c>\n</>";
+    ParseErrorBuffer errors;
+    Tokenizer tokenizer(input);
+    TokenSink tokens;
+    tokenizer.run(tokens, errors);
+
+    LineIndex lines(input);
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_EQ(to_string(errors[0], lines), "missing-whitespace-between-attributes at 2:9");
+    EXPECT_EQ(to_string(errors[1], lines), "missing-end-tag-name at 3:3");
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../dom/dump.h"
+#include "dom/element.h"
+#include "dom/text.h"
+#include "html/parser.h"
+#include "html/tokenizer.h"
+#include "util/line_index.h"
+#include "util/thread_pool.h"
+
+TEST(HTMLParserTest, builds_nested_elements)
+{
+    auto document = HTMLParser::parse(
+        "<html><body class=main><p>Hello <b>world</b>!</p><br><img src=\"a.png\"/></body></html>");
+
+    EXPECT_EQ(dump(*document),
+        "(#document (html (body class=main (p \"Hello \" (b \"world\") \"!\") (br) (img src=a.png))))");
+}
+
+TEST(HTMLParserTest, end_tag_closes_up_to_matching_element)
+{
+    auto document = HTMLParser::parse("<div><p><span>a</p>b</div></nope>c");
+
+    EXPECT_EQ(dump(*document), "(#document (div (p (span \"a\")) \"b\") \"c\")");
+
+    // Names without an atom are compared as strings.
+    document = HTMLParser::parse("<x-a><x-b><b>a</x-a>b</x-b>c");
+    EXPECT_EQ(dump(*document), "(#document (x-a (x-b (b \"a\"))) \"bc\")");
+}
+
+TEST(HTMLParserTest, merges_character_tokens_into_one_text_node)
+{
+    auto document = HTMLParser::parse("a<4 b");
+
+    EXPECT_EQ(dump(*document), "(#document \"a<4 b\")");
+}
+
+TEST(HTMLParserTest, text_refers_to_the_shared_source)
+{
+    auto input = std::make_shared<const std::string>("<p>plain <b>bold</b> a &amp; b</p>");
+    auto document = HTMLParser::parse(input);
+    EXPECT_EQ(document->source().data(), input->data());
+
+    auto* p = document->first_child();
+    auto* plain = static_cast<Text*>(p->first_child());
+    auto* bold = static_cast<Text*>(p->first_child()->next_sibling()->first_child());
+    auto* decoded = static_cast<Text*>(p->last_child());
+    EXPECT_TRUE(plain->shares_source());
+    EXPECT_EQ(plain->data().data(), input->data() + 3);
+    EXPECT_TRUE(bold->shares_source());
+    // The reference decodes to other bytes than the source has.
+    EXPECT_FALSE(decoded->shares_source());
+    EXPECT_EQ(decoded->data(), " a & b");
+
+    // Changed data is copied rather than written over the source.
+    plain->append_data("more");
+    EXPECT_FALSE(plain->shares_source());
+    EXPECT_EQ(plain->data(), "plain more");
+    EXPECT_EQ(*input, "<p>plain <b>bold</b> a &amp; b</p>");
+
+    // Text spread over several tokens stays one slice.
+    document = HTMLParser::parse("a<4 b");
+    auto* merged = static_cast<Text*>(document->first_child());
+    EXPECT_TRUE(merged->shares_source());
+    EXPECT_EQ(merged->data().data(), document->source().data());
+
+    // Preprocessing changes the input, so the document keeps its own copy.
+    input = std::make_shared<const std::string>("a\r\nb");
+    document = HTMLParser::parse(input);
+    EXPECT_NE(document->source().data(), input->data());
+    EXPECT_EQ(document->source(), "a\nb");
+    EXPECT_TRUE(static_cast<Text*>(document->first_child())->shares_source());
+
+    // A later source keeps the earlier ones alive for the text taken from
+    // them, and a slice of one does not grow into another.
+    input = std::make_shared<const std::string>("ab");
+    document = HTMLParser::parse(input);
+    std::weak_ptr<const std::string> earlier = input;
+    input.reset();
+    auto later = std::make_shared<const std::string>("c");
+    document->set_source(later);
+    EXPECT_FALSE(earlier.expired());
+    auto* text = static_cast<Text*>(document->first_child());
+    EXPECT_EQ(text->data(), "ab");
+    text->append_data(*later);
+    EXPECT_FALSE(text->shares_source());
+    EXPECT_EQ(text->data(), "abc");
+}
+
+TEST(HTMLParserTest, runs_as_sink_of_chunked_tokenizer)
+{
+    std::string_view input = "<ul><li>one<li>two</ul>";
+    Document document;
+    HTMLParser parser(document);
+    Tokenizer tokenizer;
+    for (std::size_t pos = 0; pos < input.size(); pos += 3) {
+        tokenizer.feed(input.substr(pos, 3));
+        EXPECT_FALSE(tokenizer.run(parser));
+    }
+    tokenizer.finish();
+    EXPECT_TRUE(tokenizer.run(parser));
+    EXPECT_TRUE(parser.done());
+
+    EXPECT_EQ(dump(document), "(#document (ul (li \"one\" (li \"two\"))))");
+}
+
+TEST(HTMLParserTest, nodes_remember_where_they_start)
+{
+    std::string_view input = "<p>\n  <b class=x>bold</b> tail</p>";
+    auto document = HTMLParser::parse(input);
+    LineIndex lines(input);
+
+    auto* p = document->first_child();
+    auto* indent = p->first_child();
+    auto* b = indent->next_sibling();
+    auto* tail = b->next_sibling();
+
+    EXPECT_EQ(p->source_offset(), 0u);
+    EXPECT_EQ(indent->source_offset(), 3u);
+    EXPECT_EQ(b->source_offset(), 6u);
+    EXPECT_EQ(b->first_child()->source_offset(), 17u);
+    EXPECT_EQ(tail->source_offset(), 25u);
+
+    auto position = lines.position(b->source_offset());
+    EXPECT_EQ(position.line, 2u);
+    EXPECT_EQ(position.column, 3u);
+}
+
+TEST(HTMLParserTest, parse_batch_matches_parse)
+{
+    std::vector<std::string> sources;
+    for (int i = 0; i < 50; i++) {
+        sources.push_back("<ul id=l" + std::to_string(i) + ">" + std::string(i % 7, 'x')
+            + "<li>a\r\nb<x-" + std::to_string(i) + ">&amp;</ul>" + (i % 2 ? "\r" : ""));
+    }
+    std::vector<std::string_view> inputs(sources.begin(), sources.end());
+
+    ThreadPool pool(3);
+    auto documents = HTMLParser::parse_batch(inputs, pool);
+    ASSERT_EQ(documents.size(), inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); i++) {
+        EXPECT_EQ(dump(*documents[i]), dump(*HTMLParser::parse(inputs[i]))) << i;
+    }
+
+    std::vector<std::atomic<int>> delivered(inputs.size());
+    HTMLParser::parse_batch(inputs, pool, [&](std::size_t index, std::unique_ptr<Document> document) {
+        if (document) {
+            delivered[index]++;
+        }
+    });
+    for (const auto& count : delivered) {
+        EXPECT_EQ(count, 1);
+    }
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+
+#include "html/parse_error.h"
+#include "html/preprocessor.h"
+#include "html/tokenizer.h"
+
+namespace {
+
+/// Preprocesses `chunks` in order and concatenates the output.
+std::string preprocess(std::initializer_list<std::string_view> chunks)
+{
+    InputPreprocessor preprocessor;
+    std::string out;
+    for (auto chunk : chunks) {
+        out += preprocessor.process(chunk).text;
+    }
+    out += preprocessor.finish().text;
+    return out;
+}
+
+} // namespace
+
+TEST(InputPreprocessorTest, passes_clean_chunks_through)
+{
+    InputPreprocessor preprocessor;
+    std::string_view ascii = "<p class=x>plain text\n</p>";
+    auto chunk = preprocessor.process(ascii);
+    EXPECT_EQ(chunk.text, ascii);
+    EXPECT_TRUE(chunk.passed_through(ascii));
+
+    std::string_view utf8 = "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80";
+    auto valid = preprocessor.process(utf8);
+    EXPECT_EQ(valid.text, utf8);
+    EXPECT_TRUE(valid.passed_through(utf8));
+}
+
+TEST(InputPreprocessorTest, normalizes_newlines)
+{
+    EXPECT_EQ(preprocess({ "a\r\nb\rc\n\rd\r\r\ne" }), "a\nb\nc\n\nd\n\ne");
+    EXPECT_EQ(preprocess({ "a\r", "\nb" }), "a\nb");
+    EXPECT_EQ(preprocess({ "a\r", "", "\nb" }), "a\nb");
+    EXPECT_EQ(preprocess({ "a\r", "\n", "\nb" }), "a\n\nb");
+    EXPECT_EQ(preprocess({ "\xC3\xA9\r\n\xC3\xA9" }), "\xC3\xA9\n\xC3\xA9");
+
+    InputPreprocessor preprocessor;
+    auto first = preprocessor.process("x\r");
+    EXPECT_EQ(first.text, "x\n");
+    // The LF that completes the pair is dropped without copying the rest.
+    std::string_view next = "\ny";
+    auto second = preprocessor.process(next);
+    EXPECT_EQ(second.text, "y");
+    EXPECT_EQ(second.text.data(), next.data() + 1);
+}
+
+TEST(InputPreprocessorTest, replaces_invalid_utf8)
+{
+    // One U+FFFD per maximal subpart, as the Encoding Standard decoder does.
+    EXPECT_EQ(preprocess({ "a\xFF" "b" }), "a\xEF\xBF\xBD" "b");
+    EXPECT_EQ(preprocess({ "\xE2\x82" "x" }), "\xEF\xBF\xBD" "x");
+    EXPECT_EQ(preprocess({ "\xC0\xAF" }), "\xEF\xBF\xBD\xEF\xBF\xBD");
+    // Encoded surrogates are invalid.
+    EXPECT_EQ(preprocess({ "\xED\xA0\x80" }), "\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD");
+    // A sequence still open at the end of the stream.
+    EXPECT_EQ(preprocess({ "ok\xF0\x9F\x98" }), "ok\xEF\xBF\xBD");
+
+    InputPreprocessor preprocessor;
+    auto chunk = preprocessor.process("\xF5");
+    EXPECT_EQ(chunk.text, "\xEF\xBF\xBD");
+}
+
+TEST(InputPreprocessorTest, holds_back_sequences_split_across_chunks)
+{
+    InputPreprocessor preprocessor;
+    std::string_view first = "ab\xE2\x82";
+    auto a = preprocessor.process(first);
+    EXPECT_EQ(a.text, "ab");
+    EXPECT_TRUE(a.passed_through(first));
+
+    auto b = preprocessor.process("\xAC" "cd");
+    EXPECT_EQ(b.text, "\xE2\x82\xAC" "cd");
+
+    EXPECT_EQ(preprocess({ "\xF0", "\x9F", "\x98", "\x80" }), "\xF0\x9F\x98\x80");
+    EXPECT_EQ(preprocess({ "\xF0\x9F", "x" }), "\xEF\xBF\xBD" "x");
+}
+
+TEST(InputPreprocessorTest, passes_nul_through)
+{
+    InputPreprocessor preprocessor;
+    std::string_view input("a\0b", 3);
+    auto chunk = preprocessor.process(input);
+    // NUL is left to the tokenizer, which handles it differently per state.
+    EXPECT_EQ(chunk.text, input);
+    EXPECT_TRUE(chunk.passed_through(input));
+}
+
+TEST(InputPreprocessorTest, tokenizer_handles_nul_per_state)
+{
+    const char raw[] = "a\0<t\0g x\0=\"\0\" y=\0><!-\0->";
+    std::string_view input(raw, sizeof(raw) - 1);
+    for (auto engine : { Engine::Switch, Engine::Table, Engine::Verify }) {
+        Tokenizer tokenizer(input, TextMode::Run, engine);
+        std::string text;
+        std::string tag;
+        std::string attributes;
+        while (true) {
+            auto token = tokenizer.next_view();
+            if (token.kind == Token::Kind::EndOfFile) {
+                break;
+            }
+            if (token.kind == Token::Kind::TextRun) {
+                text += token.text;
+            } else if (token.kind == Token::Kind::StartTag) {
+                tag = token.tag.name;
+                for (const auto& attr : token.tag.attributes) {
+                    attributes += std::string(attr.name) + "=" + std::string(attr.value) + ";";
+                }
+            }
+        }
+
+        // Text keeps the NUL, names and values get U+FFFD.
+        EXPECT_EQ(text, std::string("a\0", 2));
+        EXPECT_EQ(tag, "t\xEF\xBF\xBDg");
+        EXPECT_EQ(attributes, "x\xEF\xBF\xBD=\xEF\xBF\xBD;y=\xEF\xBF\xBD;");
+        EXPECT_EQ(tokenizer.parse_errors().size(), 6u) << static_cast<int>(engine);
+        for (const auto& error : tokenizer.parse_errors()) {
+            EXPECT_EQ(error.code, ParseErrorCode::UnexpectedNullCharacter);
+        }
+    }
+}
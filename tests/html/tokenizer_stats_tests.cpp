@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
+
+#include "html/state.h"
+#include "html/token.h"
+#include "html/tokenizer.h"
+#include "html/tokenizer_stats.h"
+
+namespace {
+
+std::size_t index(State state) { return static_cast<std::size_t>(state); }
+std::size_t index(Token::Kind kind) { return static_cast<std::size_t>(kind); }
+
+#ifdef EVEN_TOKENIZER_STATS
+struct NullSink {
+    void on_start_tag(const TagView&) { }
+    void on_end_tag(const TagView&) { }
+    void on_text(std::string_view, std::uint32_t) { }
+    void on_char(char, std::uint32_t) { }
+    void on_eof() { }
+};
+#endif
+
+} // namespace
+
+TEST(TokenizerStatsTest, buckets_tags_by_attribute_count_and_runs_by_size)
+{
+    TokenizerStats stats;
+    AttributeView attributes[20] {};
+    stats.count_tag({ TokenTag::Kind::Start, TagId::Unknown, "x", false, { attributes, 2 }, 0 });
+    stats.count_tag({ TokenTag::Kind::Start, TagId::Unknown, "x", false, { attributes, 20 }, 0 });
+    stats.count_tag({ TokenTag::Kind::End, TagId::Unknown, "x", false, {}, 0 });
+    for (std::size_t bytes : { 1u, 2u, 3u, 4u, 1000u, 1u << 30 }) {
+        stats.count_text_run(bytes);
+    }
+
+    EXPECT_EQ(stats.tokens[index(Token::Kind::StartTag)], 2u);
+    EXPECT_EQ(stats.tokens[index(Token::Kind::EndTag)], 1u);
+    EXPECT_EQ(stats.tokens[index(Token::Kind::TextRun)], 6u);
+    EXPECT_EQ(stats.attributes_per_tag[0], 1u);
+    EXPECT_EQ(stats.attributes_per_tag[2], 1u);
+    EXPECT_EQ(stats.attributes_per_tag[TokenizerStats::kAttributeBuckets - 1], 1u);
+    EXPECT_EQ(stats.text_run_bytes[0], 1u);
+    EXPECT_EQ(stats.text_run_bytes[1], 2u);
+    EXPECT_EQ(stats.text_run_bytes[2], 1u);
+    EXPECT_EQ(stats.text_run_bytes[9], 1u);
+    EXPECT_EQ(stats.text_run_bytes[TokenizerStats::kTextRunBuckets - 1], 1u);
+}
+
+TEST(TokenizerStatsTest, merges_and_dumps_json)
+{
+    TokenizerStats stats;
+    stats.state_bytes[index(State::Data)] = 5;
+    stats.transitions[index(State::Data)][index(State::TagOpen)] = 2;
+    stats.count_token(Token::Kind::EndOfFile);
+
+    auto total = stats;
+    total += stats;
+    EXPECT_EQ(total.state_bytes[index(State::Data)], 10u);
+    EXPECT_EQ(total.transitions[index(State::Data)][index(State::TagOpen)], 4u);
+    EXPECT_EQ(total.tokens[index(Token::Kind::EndOfFile)], 2u);
+
+    auto json = total.to_json();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"state_bytes\":{\"data\":10,\"tag-open\":0,"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"transitions\":[{\"from\":\"data\",\"to\":\"tag-open\",\"count\":4}]"), std::string::npos)
+        << json;
+    EXPECT_NE(json.find("\"end-of-file\":2}"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"attributes_per_tag\":[0,"), std::string::npos) << json;
+}
+
+#ifdef EVEN_TOKENIZER_STATS
+
+TEST(TokenizerStatsTest, counts_what_the_tokenizer_does)
+{
+    std::string_view input = "<p a=1 b='two'>hello &amp; world<!-- x --></p>";
+    for (auto engine : { Engine::Switch, Engine::Table, Engine::Verify }) {
+        Tokenizer tokenizer(input, TextMode::Run, engine);
+        NullSink sink;
+        tokenizer.run(sink);
+        const auto& stats = tokenizer.stats();
+
+        EXPECT_EQ(stats.tokens[index(Token::Kind::StartTag)], 1u);
+        EXPECT_EQ(stats.tokens[index(Token::Kind::EndTag)], 1u);
+        EXPECT_EQ(stats.tokens[index(Token::Kind::EndOfFile)], 1u);
+        EXPECT_EQ(stats.attributes_per_tag[2], 1u);
+        EXPECT_EQ(stats.attributes_per_tag[0], 1u);
+        // Every byte is looked at at least once, reconsumed ones again.
+        auto bytes = std::accumulate(stats.state_bytes.begin(), stats.state_bytes.end(), std::uint64_t { 0 });
+        EXPECT_GE(bytes, input.size());
+        EXPECT_GT(stats.state_bytes[index(State::Comment)], 0u);
+        EXPECT_GT(stats.state_bytes[index(State::AttributeValueSingleQuoted)], 0u);
+        EXPECT_EQ(stats.transitions[index(State::Data)][index(State::TagOpen)], 3u);
+        EXPECT_EQ(stats.transitions[index(State::TagOpen)][index(State::EndTagOpen)], 1u);
+        EXPECT_GT(stats.reconsumes, 0u);
+    }
+}
+
+TEST(TokenizerStatsTest, pull_api_counts_the_same_tokens)
+{
+    std::string_view input = "<a href=x>&copy;</a>";
+    Tokenizer pushed(input, TextMode::Character);
+    NullSink sink;
+    pushed.run(sink);
+
+    Tokenizer pulled(input, TextMode::Character);
+    while (pulled.next_view().kind != Token::Kind::EndOfFile) {
+    }
+    EXPECT_EQ(pulled.stats().tokens, pushed.stats().tokens);
+    EXPECT_EQ(pulled.stats().state_bytes, pushed.stats().state_bytes);
+    // Both bytes of U+00A9 come out of one step.
+    EXPECT_EQ(pulled.stats().pending_tokens, 1u);
+}
+
+TEST(TokenizerStatsTest, accumulates_across_reset)
+{
+    Tokenizer tokenizer("<p>");
+    NullSink sink;
+    tokenizer.run(sink);
+    tokenizer.reset("<p>");
+    tokenizer.run(sink);
+
+    EXPECT_EQ(tokenizer.stats().tokens[index(Token::Kind::StartTag)], 2u);
+    EXPECT_EQ(tokenizer.stats().transitions[index(State::Data)][index(State::TagOpen)], 2u);
+}
+
+#endif
@@ -3,43 +3,145 @@
 #include "../../src/html/tokenizer.h"
 #include "html/token.h"
 
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Renders tokens as one string per token, joining neighbouring text so that
+/// the result does not depend on where text runs were split.
+std::vector<std::string> describe(const std::vector<Token>& tokens)
+{
+    std::vector<std::string> out;
+    bool in_text = false;
+    for (const auto& token : tokens) {
+        std::string text;
+        if (auto* ch = std::get_if<Token::Character>(&token.data)) {
+            text = std::string(1, ch->value);
+        } else if (auto* run = std::get_if<Token::TextRun>(&token.data)) {
+            text = std::string(run->value);
+        } else {
+            in_text = false;
+        }
+
+        if (!text.empty()) {
+            if (!in_text) {
+                out.push_back("text:");
+                in_text = true;
+            }
+            out.back() += text;
+            continue;
+        }
+
+        std::string tag;
+        if (auto* start = std::get_if<Token::StartTag>(&token.data)) {
+            tag = "start:" + std::string(start->tag.name);
+            for (const auto& attr : start->tag.attributes) {
+                tag += " " + std::string(attr.name) + "=" + attr.value;
+            }
+            if (start->tag.self_closing) {
+                tag += " /";
+            }
+        } else if (auto* end = std::get_if<Token::EndTag>(&token.data)) {
+            tag = "end:" + std::string(end->tag.name);
+        } else {
+            tag = "eof";
+        }
+        out.push_back(tag);
+    }
+    return out;
+}
+
+template <typename Policy>
+std::vector<std::string> tokenize_whole(std::string_view input,
+    Engine engine = Engine::Switch)
+{
+    BasicTokenizer<Policy> tokenizer(input, TextMode::Run, engine);
+    std::vector<Token> tokens;
+    do {
+        tokens.push_back(tokenizer.next());
+    } while (tokens.back().kind != Token::Kind::EndOfFile);
+    return describe(tokens);
+}
+
+/// Feeds `input` in chunks of `chunk_size` bytes. Text is copied out as soon
+/// as it is emitted since feed() invalidates earlier text runs.
+template <typename Policy>
+std::vector<std::string> tokenize_chunked(std::string_view input,
+    std::size_t chunk_size)
+{
+    BasicTokenizer<Policy> tokenizer;
+    std::vector<Token> tokens;
+    auto drain = [&] {
+        while (auto token = tokenizer.try_next()) {
+            if (auto* run = std::get_if<Token::TextRun>(&token->data)) {
+                for (char ch : run->value) {
+                    tokens.push_back(Token::new_char(ch));
+                }
+            } else {
+                tokens.push_back(std::move(*token));
+            }
+            if (tokens.back().kind == Token::Kind::EndOfFile) {
+                return;
+            }
+        }
+    };
+
+    for (std::size_t pos = 0; pos < input.size(); pos += chunk_size) {
+        tokenizer.feed(input.substr(pos, chunk_size));
+        drain();
+    }
+    tokenizer.finish();
+    drain();
+    return describe(tokens);
+}
+
+} // namespace
+
+/// Every test runs with both policies. Tests of offsets and parse errors check
+/// the policy for what to expect.
+template <typename Policy>
 class TokenizerTest : public ::testing::Test {
 protected:
-    std::unique_ptr<Tokenizer> tokenizer;
+    std::unique_ptr<BasicTokenizer<Policy>> tokenizer;
 
-    void SetUp() override { tokenizer = std::make_unique<Tokenizer>(""); }
+    void SetUp() override { tokenizer = std::make_unique<BasicTokenizer<Policy>>(""); }
 
     void TearDown() override { tokenizer.reset(); }
 };
 
-TEST_F(TokenizerTest, basic_text)
+using TokenizerPolicies = ::testing::Types<SpecPolicy, TrustedInput>;
+TYPED_TEST_SUITE(TokenizerTest, TokenizerPolicies);
+
+TYPED_TEST(TokenizerTest, basic_text)
 {
-    tokenizer = std::make_unique<Tokenizer>("abc");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("abc", TextMode::Character);
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     auto& ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, 'a');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, 'b');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, 'c');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, basic_tags)
+TYPED_TEST(TokenizerTest, basic_tags)
 {
-    tokenizer = std::make_unique<Tokenizer>("<div></div>");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<div></div>");
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
     auto& startTag = std::get<Token::StartTag>(t.data);
     EXPECT_EQ(startTag.tag.kind, TokenTag::Kind::Start);
@@ -47,22 +149,22 @@ TEST_F(TokenizerTest, basic_tags)
     EXPECT_FALSE(startTag.tag.self_closing);
     EXPECT_EQ(startTag.tag.attributes.size(), 0);
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndTag>(t.data));
     auto& endTag = std::get<Token::EndTag>(t.data);
     EXPECT_EQ(endTag.tag.kind, TokenTag::Kind::End);
     EXPECT_EQ(endTag.tag.name, "div");
     EXPECT_EQ(endTag.tag.attributes.size(), 0);
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, tag_case_insensitivity)
+TYPED_TEST(TokenizerTest, tag_case_insensitivity)
 {
-    tokenizer = std::make_unique<Tokenizer>("<DIV></div >");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<DIV></div >");
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
     auto& startTag = std::get<Token::StartTag>(t.data);
     EXPECT_EQ(startTag.tag.kind, TokenTag::Kind::Start);
@@ -70,23 +172,23 @@ TEST_F(TokenizerTest, tag_case_insensitivity)
     EXPECT_FALSE(startTag.tag.self_closing);
     EXPECT_EQ(startTag.tag.attributes.size(), 0);
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndTag>(t.data));
     auto& endTag = std::get<Token::EndTag>(t.data);
     EXPECT_EQ(endTag.tag.kind, TokenTag::Kind::End);
     EXPECT_EQ(endTag.tag.name, "div");
     EXPECT_EQ(endTag.tag.attributes.size(), 0);
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, attributes_mixed)
+TYPED_TEST(TokenizerTest, attributes_mixed)
 {
-    tokenizer = std::make_unique<Tokenizer>(
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>(
         "<div id=\"test\" v-data='v1' class=foo checked></div>");
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
     auto& startTag = std::get<Token::StartTag>(t.data);
     EXPECT_EQ(startTag.tag.kind, TokenTag::Kind::Start);
@@ -102,22 +204,22 @@ TEST_F(TokenizerTest, attributes_mixed)
     EXPECT_EQ(startTag.tag.attributes[3].name, "checked");
     EXPECT_EQ(startTag.tag.attributes[3].value, "");
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndTag>(t.data));
     auto& endTag = std::get<Token::EndTag>(t.data);
     EXPECT_EQ(endTag.tag.kind, TokenTag::Kind::End);
     EXPECT_EQ(endTag.tag.name, "div");
     EXPECT_EQ(endTag.tag.attributes.size(), 0);
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, self_closing_tag)
+TYPED_TEST(TokenizerTest, self_closing_tag)
 {
-    tokenizer = std::make_unique<Tokenizer>("<br/>");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<br/>");
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
     auto& tag = std::get<Token::StartTag>(t.data);
     EXPECT_EQ(tag.tag.kind, TokenTag::Kind::Start);
@@ -125,51 +227,51 @@ TEST_F(TokenizerTest, self_closing_tag)
     EXPECT_TRUE(tag.tag.self_closing);
     EXPECT_EQ(tag.tag.attributes.size(), 0);
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, eof_in_tag)
+TYPED_TEST(TokenizerTest, eof_in_tag)
 {
-    tokenizer = std::make_unique<Tokenizer>("</");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("</");
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     auto& ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, '<');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, '/');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, invalid_tag_name_start)
+TYPED_TEST(TokenizerTest, invalid_tag_name_start)
 {
-    tokenizer = std::make_unique<Tokenizer>("<4");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<4", TextMode::Character);
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     auto& ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, '<');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
     ch = std::get<Token::Character>(t.data);
     EXPECT_EQ(ch.value, '4');
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
 
-TEST_F(TokenizerTest, attribute_value_with_illegal_chars)
+TYPED_TEST(TokenizerTest, attribute_value_with_illegal_chars)
 {
-    tokenizer = std::make_unique<Tokenizer>("<div data=foo\"bar>");
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<div data=foo\"bar>");
 
-    Token t = tokenizer->next();
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
     auto& tag = std::get<Token::StartTag>(t.data);
     EXPECT_EQ(tag.tag.kind, TokenTag::Kind::Start);
@@ -179,6 +281,414 @@ TEST_F(TokenizerTest, attribute_value_with_illegal_chars)
     EXPECT_EQ(tag.tag.attributes[0].name, "data");
     EXPECT_EQ(tag.tag.attributes[0].value, "foo\"bar");
 
-    t = tokenizer->next();
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
+}
+
+
+TYPED_TEST(TokenizerTest, text_run)
+{
+    std::string_view input = "hello <b>world</b>!";
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>(input);
+
+    Token t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::TextRun>(t.data));
+    auto run = std::get<Token::TextRun>(t.data);
+    EXPECT_EQ(run.value, "hello ");
+    EXPECT_EQ(run.value.data(), input.data());
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
+    EXPECT_EQ(std::get<Token::StartTag>(t.data).tag.name, "b");
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::TextRun>(t.data));
+    run = std::get<Token::TextRun>(t.data);
+    EXPECT_EQ(run.value, "world");
+    EXPECT_EQ(run.value.data(), input.data() + 9);
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::EndTag>(t.data));
+    EXPECT_EQ(std::get<Token::EndTag>(t.data).tag.name, "b");
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::TextRun>(t.data));
+    EXPECT_EQ(std::get<Token::TextRun>(t.data).value, "!");
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
+}
+
+TYPED_TEST(TokenizerTest, text_run_after_invalid_tag_name_start)
+{
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<4 < 5");
+
+    Token t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
+    EXPECT_EQ(std::get<Token::Character>(t.data).value, '<');
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::TextRun>(t.data));
+    EXPECT_EQ(std::get<Token::TextRun>(t.data).value, "4 ");
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::Character>(t.data));
+    EXPECT_EQ(std::get<Token::Character>(t.data).value, '<');
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::TextRun>(t.data));
+    EXPECT_EQ(std::get<Token::TextRun>(t.data).value, " 5");
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
+}
+
+TYPED_TEST(TokenizerTest, long_attribute_values_and_comments)
+{
+    std::string value(1000, 'v');
+    std::string input = "<!--" + std::string(500, '-') + " c --><a title=\"" + value
+        + "\" alt='" + value + "x'>" + std::string(777, 't');
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>(input);
+
+    Token t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t.data));
+    auto& tag = std::get<Token::StartTag>(t.data).tag;
+    EXPECT_EQ(tag.name, "a");
+    ASSERT_EQ(tag.attributes.size(), 2);
+    EXPECT_EQ(tag.attributes[0].value, value);
+    EXPECT_EQ(tag.attributes[1].value, value + "x");
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::TextRun>(t.data));
+    EXPECT_EQ(std::get<Token::TextRun>(t.data).value.size(), 777);
+
+    t = this->tokenizer->next();
+    ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
+}
+
+TYPED_TEST(TokenizerTest, chunked_input_matches_whole_input)
+{
+    std::string_view input = "<!DOCTYPE html><html lang=en><head><title>Title</title>"
+                             "</head><body class=\"main page\" data-x='1'>"
+                             "<p>Some <b>bold</b> text.<br/><img src=a.png alt=\"\">"
+                             "<!-- a comment --></p><4 </body></html>";
+    auto expected = tokenize_whole<TypeParam>(input);
+
+    for (std::size_t chunk_size = 1; chunk_size <= input.size(); chunk_size++) {
+        EXPECT_EQ(tokenize_chunked<TypeParam>(input, chunk_size), expected)
+            << "chunk size " << chunk_size;
+    }
+}
+
+TYPED_TEST(TokenizerTest, chunked_input_pauses_inside_tag)
+{
+    BasicTokenizer<TypeParam> chunked;
+    chunked.feed("<di");
+    EXPECT_FALSE(chunked.try_next().has_value());
+    chunked.feed("v cla");
+    EXPECT_FALSE(chunked.try_next().has_value());
+    chunked.feed("ss=\"a b");
+    EXPECT_FALSE(chunked.try_next().has_value());
+    chunked.feed("\">");
+
+    auto t = chunked.try_next();
+    ASSERT_TRUE(t.has_value());
+    ASSERT_TRUE(std::holds_alternative<Token::StartTag>(t->data));
+    auto& tag = std::get<Token::StartTag>(t->data).tag;
+    EXPECT_EQ(tag.name, "div");
+    ASSERT_EQ(tag.attributes.size(), 1);
+    EXPECT_EQ(tag.attributes[0].name, "class");
+    EXPECT_EQ(tag.attributes[0].value, "a b");
+
+    EXPECT_FALSE(chunked.try_next().has_value());
+    chunked.finish();
+    t = chunked.try_next();
+    ASSERT_TRUE(t.has_value());
+    EXPECT_TRUE(std::holds_alternative<Token::EndOfFile>(t->data));
+}
+
+TYPED_TEST(TokenizerTest, chunked_input_eof_inside_tag)
+{
+    BasicTokenizer<TypeParam> chunked;
+    chunked.feed("<");
+    EXPECT_FALSE(chunked.try_next().has_value());
+    chunked.feed("/");
+    EXPECT_FALSE(chunked.try_next().has_value());
+    chunked.finish();
+
+    auto t = chunked.try_next();
+    ASSERT_TRUE(t.has_value());
+    ASSERT_TRUE(std::holds_alternative<Token::Character>(t->data));
+    EXPECT_EQ(std::get<Token::Character>(t->data).value, '<');
+    t = chunked.try_next();
+    ASSERT_TRUE(t.has_value());
+    ASSERT_TRUE(std::holds_alternative<Token::Character>(t->data));
+    EXPECT_EQ(std::get<Token::Character>(t->data).value, '/');
+    t = chunked.try_next();
+    ASSERT_TRUE(t.has_value());
+    EXPECT_TRUE(std::holds_alternative<Token::EndOfFile>(t->data));
+}
+
+TYPED_TEST(TokenizerTest, feeding_between_tokens_keeps_the_character_to_reconsume)
+{
+    std::vector<Token> tokens;
+    // Copies text out, since feed() invalidates earlier text runs.
+    auto take = [&](Token token) {
+        if (auto* run = std::get_if<Token::TextRun>(&token.data)) {
+            for (char ch : run->value) {
+                tokens.push_back(Token::new_char(ch));
+            }
+        } else {
+            tokens.push_back(std::move(token));
+        }
+    };
+    auto ends_with = [&](char ch) {
+        auto* last = tokens.empty() ? nullptr : std::get_if<Token::Character>(&tokens.back().data);
+        return last && last->value == ch;
+    };
+
+    // TagOpen emits the `<` of "<1" and reconsumes the `1`, which feed()
+    // must not drop.
+    for (auto mode : { TextMode::Run, TextMode::Character }) {
+        tokens.clear();
+        BasicTokenizer<TypeParam> chunked(mode);
+        chunked.feed("a<1");
+        while (!ends_with('<')) {
+            auto token = chunked.try_next();
+            ASSERT_TRUE(token.has_value());
+            take(std::move(*token));
+        }
+        chunked.feed("b");
+        chunked.finish();
+        while (tokens.back().kind != Token::Kind::EndOfFile) {
+            auto token = chunked.try_next();
+            ASSERT_TRUE(token.has_value());
+            take(std::move(*token));
+        }
+        EXPECT_EQ(describe(tokens), (std::vector<std::string> { "text:a<1b", "eof" }));
+    }
+
+    // A byte fed after every token pulled, rather than only once drained.
+    std::string_view input = "a<1 b</ 2><p<q x=1 / y>c&amp;d<!--e--><</x y=2>f<";
+    tokens.clear();
+    BasicTokenizer<TypeParam> chunked;
+    std::size_t pos = 0;
+    while (tokens.empty() || tokens.back().kind != Token::Kind::EndOfFile) {
+        if (pos < input.size()) {
+            chunked.feed(input.substr(pos++, 1));
+        } else {
+            chunked.finish();
+        }
+        if (auto token = chunked.try_next()) {
+            take(std::move(*token));
+        }
+    }
+    EXPECT_EQ(describe(tokens), tokenize_whole<TypeParam>(input));
+}
+
+TYPED_TEST(TokenizerTest, raw_chunks_are_preprocessed)
+{
+    // CR LF split between chunks, a UTF-8 sequence split between chunks and
+    // one cut off by the end of the stream.
+    std::string_view input = "<p title='a\r\nb'>x\r\ny \xE2\x82\xAC\r</p>z\xF0\x9F";
+    auto expected = tokenize_whole<TypeParam>("<p title='a\nb'>x\ny \xE2\x82\xAC\n</p>z\xEF\xBF\xBD");
+
+    for (std::size_t chunk_size = 1; chunk_size <= input.size(); chunk_size++) {
+        BasicTokenizer<TypeParam> chunked;
+        std::vector<Token> tokens;
+        auto drain = [&] {
+            while (auto token = chunked.try_next()) {
+                if (auto* run = std::get_if<Token::TextRun>(&token->data)) {
+                    for (char ch : run->value) {
+                        tokens.push_back(Token::new_char(ch));
+                    }
+                } else {
+                    tokens.push_back(std::move(*token));
+                }
+                if (tokens.back().kind == Token::Kind::EndOfFile) {
+                    return;
+                }
+            }
+        };
+        for (std::size_t pos = 0; pos < input.size(); pos += chunk_size) {
+            chunked.feed_raw(input.substr(pos, chunk_size));
+            drain();
+        }
+        chunked.finish();
+        drain();
+        EXPECT_EQ(describe(tokens), expected) << "chunk size " << chunk_size;
+    }
+}
+
+TYPED_TEST(TokenizerTest, eof_in_attribute_name)
+{
+    this->tokenizer = std::make_unique<BasicTokenizer<TypeParam>>("<a b");
+
+    Token t = this->tokenizer->next();
     ASSERT_TRUE(std::holds_alternative<Token::EndOfFile>(t.data));
 }
+
+TYPED_TEST(TokenizerTest, table_engine_matches_switch_engine)
+{
+    const char* inputs[] = {
+        "",
+        "abc",
+        "<div></div >",
+        "<DIV id=\"test\" v-data='v1' class=foo checked></div>",
+        "<br/><br / ><img src=x/>",
+        "</",
+        "<",
+        "<4",
+        "</>",
+        "</4>",
+        "<?xml?>",
+        "<!-- c -->",
+        "<a b",
+        "<a b=",
+        "<a b='",
+        "<a b=\"c\"d>",
+        "<a =b \"c<=`>",
+        "<a b=c\"d'e<f=g`>",
+        "<a/ b>",
+    };
+    for (auto input : inputs) {
+        EXPECT_EQ(tokenize_whole<TypeParam>(input, Engine::Table), tokenize_whole<TypeParam>(input))
+            << "input " << input;
+        tokenize_whole<TypeParam>(input, Engine::Verify);
+    }
+}
+
+TYPED_TEST(TokenizerTest, table_engine_matches_switch_engine_on_random_markup)
+{
+    const char alphabet[] = "<>/=\"'` \t\n!?aZ-9&#;xX\0";
+    std::mt19937 rng(7);
+    for (int round = 0; round < 500; round++) {
+        std::string input(rng() % 64, ' ');
+        for (auto& ch : input) {
+            ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        }
+        EXPECT_EQ(tokenize_whole<TypeParam>(input, Engine::Table), tokenize_whole<TypeParam>(input))
+            << "input " << input;
+        tokenize_whole<TypeParam>(input, Engine::Verify);
+    }
+}
+
+TYPED_TEST(TokenizerTest, tokens_carry_their_byte_offset)
+{
+    if constexpr (!TypeParam::kTrackOffsets) {
+        GTEST_SKIP() << "offsets are not tracked";
+    }
+    std::string_view input = "ab<p id=x>c\nd</p><4</";
+    std::vector<std::uint32_t> expected_runs { 0, 2, 10, 13, 17, 18, 19, 20, 21 };
+    std::vector<std::uint32_t> expected_chars { 0, 1, 2, 10, 11, 12, 13, 17, 18, 19, 20, 21 };
+
+    for (auto engine : { Engine::Switch, Engine::Table, Engine::Verify }) {
+        for (auto mode : { TextMode::Run, TextMode::Character }) {
+            BasicTokenizer<TypeParam> t(input, mode, engine);
+            std::vector<std::uint32_t> offsets;
+            while (true) {
+                auto token = t.next();
+                offsets.push_back(token.offset);
+                if (token.kind == Token::Kind::EndOfFile) {
+                    break;
+                }
+            }
+            EXPECT_EQ(offsets, mode == TextMode::Run ? expected_runs : expected_chars);
+        }
+    }
+}
+
+TYPED_TEST(TokenizerTest, chunked_offsets_count_from_the_start_of_the_document)
+{
+    if constexpr (!TypeParam::kTrackOffsets) {
+        GTEST_SKIP() << "offsets are not tracked";
+    }
+    std::string_view input = "<a>xy</a>z";
+    BasicTokenizer<TypeParam> chunked;
+    std::vector<std::uint32_t> offsets;
+    for (char ch : input) {
+        chunked.feed(std::string_view(&ch, 1));
+        while (auto token = chunked.try_next_view()) {
+            offsets.push_back(token->offset);
+        }
+    }
+    chunked.finish();
+    offsets.push_back(chunked.next_view().offset);
+
+    std::vector<std::uint32_t> expected { 0, 3, 4, 5, 9, 10 };
+    EXPECT_EQ(offsets, expected);
+}
+
+TYPED_TEST(TokenizerTest, verify_engine_accepts_chunked_input)
+{
+    std::string_view input = "<p class=\"a\">text<!-- x --></p>";
+    BasicTokenizer<TypeParam> chunked(TextMode::Run, Engine::Verify);
+    std::size_t tokens = 0;
+    for (char ch : input) {
+        chunked.feed(std::string_view(&ch, 1));
+        while (chunked.try_next_view()) {
+            tokens++;
+        }
+    }
+    chunked.finish();
+    while (chunked.try_next_view()->kind != Token::Kind::EndOfFile) {
+        tokens++;
+    }
+    EXPECT_GT(tokens, 0);
+}
+
+TYPED_TEST(TokenizerTest, reset_starts_over_on_another_document)
+{
+    BasicTokenizer<TypeParam> tokenizer(TextMode::Run, Engine::Verify);
+    tokenizer.feed("<x-custom a='1");
+    while (tokenizer.try_next_view()) {
+    }
+
+    std::string_view input = "<x-other b=2>text";
+    tokenizer.reset(input);
+    std::vector<Token> tokens;
+    do {
+        tokens.push_back(tokenizer.next());
+    } while (tokens.back().kind != Token::Kind::EndOfFile);
+    EXPECT_EQ(describe(tokens), tokenize_whole<TypeParam>(input));
+    EXPECT_EQ(tokens[0].offset, 0u);
+}
+
+TYPED_TEST(TokenizerTest, policy_picks_nul_handling_and_error_reporting)
+{
+    using namespace std::literals;
+    BasicTokenizer<TypeParam> t("<a\0b c=\"\0\"d>x\0y"sv);
+    std::vector<Token> tokens;
+    do {
+        tokens.push_back(t.next());
+    } while (tokens.back().kind != Token::Kind::EndOfFile);
+
+    std::vector<std::string> expected;
+    if constexpr (TypeParam::kHandleNul) {
+        // The NUL is replaced in the names and values of tags, and kept in
+        // text, each time with an unexpected-null-character parse error.
+        expected = { "start:a\xEF\xBF\xBD" "b c=\xEF\xBF\xBD d=", "text:x\0y"s, "eof" };
+    } else {
+        expected = { "start:a\0b c=\0 d="s, "text:x\0y"s, "eof" };
+    }
+    EXPECT_EQ(describe(tokens), expected);
+
+    auto codes = [&] {
+        std::vector<ParseErrorCode> codes;
+        for (const auto& error : t.parse_errors()) {
+            codes.push_back(error.code);
+        }
+        return codes;
+    }();
+    if constexpr (TypeParam::kReportErrors) {
+        std::vector<ParseErrorCode> expected_codes {
+            ParseErrorCode::UnexpectedNullCharacter,
+            ParseErrorCode::UnexpectedNullCharacter,
+            ParseErrorCode::MissingWhitespaceBetweenAttributes,
+            ParseErrorCode::UnexpectedNullCharacter,
+        };
+        EXPECT_EQ(codes, expected_codes);
+    } else {
+        EXPECT_TRUE(codes.empty());
+    }
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "util/arena.h"
+
+TEST(ArenaTest, allocations_are_aligned_and_disjoint)
+{
+    Arena arena;
+    char* previous_end = nullptr;
+    for (std::size_t align : { 1, 2, 4, 8, 16, 32, 64 }) {
+        auto* p = static_cast<char*>(arena.allocate(24, align));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % align, 0u);
+        if (previous_end) {
+            // All of these fit in the first block, so they are bumped in order.
+            EXPECT_GE(p, previous_end);
+        }
+        previous_end = p + 24;
+    }
+}
+
+TEST(ArenaTest, grows_past_one_block_and_serves_oversized_requests)
+{
+    Arena arena;
+    std::size_t total = 0;
+    for (int i = 0; i < 10000; i++) {
+        auto* value = arena.make<std::uint64_t>(i);
+        EXPECT_EQ(*value, static_cast<std::uint64_t>(i));
+        total += sizeof(std::uint64_t);
+    }
+    EXPECT_GE(arena.bytes_allocated(), total);
+
+    auto* big = arena.allocate_array<char>(4 * Arena::kMaxBlockSize);
+    big[0] = 'a';
+    big[4 * Arena::kMaxBlockSize - 1] = 'z';
+    EXPECT_GE(arena.bytes_allocated(), total + 4 * Arena::kMaxBlockSize);
+
+    arena.reset();
+    EXPECT_EQ(arena.bytes_allocated(), 0u);
+}
+
+TEST(ArenaTest, copies_strings)
+{
+    Arena arena;
+    std::string source = "hello";
+    auto copy = arena.copy(source);
+    source[0] = 'j';
+
+    EXPECT_EQ(copy, "hello");
+    EXPECT_TRUE(arena.copy("").empty());
+}
+
+TEST(ArenaTest, reserve_sizes_the_next_block)
+{
+    Arena arena;
+    arena.reserve(64 * 1024);
+    arena.allocate(16, 1);
+    auto first = arena.bytes_allocated();
+    EXPECT_GE(first, 64u * 1024);
+
+    // The reserved block takes the rest without growing.
+    arena.allocate(32 * 1024, 1);
+    EXPECT_EQ(arena.bytes_allocated(), first);
+}
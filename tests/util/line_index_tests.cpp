@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "util/line_index.h"
+
+namespace {
+
+std::string at(const LineIndex& lines, std::uint32_t offset)
+{
+    auto position = lines.position(offset);
+    return std::to_string(position.line) + ":" + std::to_string(position.column);
+}
+
+} // namespace
+
+TEST(LineIndexTest, resolves_offsets_to_lines_and_columns)
+{
+    LineIndex lines("ab\ncd\n\nefg");
+
+    EXPECT_EQ(lines.line_count(), 4u);
+    EXPECT_EQ(at(lines, 0), "1:1");
+    EXPECT_EQ(at(lines, 2), "1:3");
+    EXPECT_EQ(at(lines, 3), "2:1");
+    EXPECT_EQ(at(lines, 5), "2:3");
+    EXPECT_EQ(at(lines, 6), "3:1");
+    EXPECT_EQ(at(lines, 7), "4:1");
+    EXPECT_EQ(at(lines, 10), "4:4");
+}
+
+TEST(LineIndexTest, handles_inputs_without_newlines)
+{
+    LineIndex empty("");
+    EXPECT_EQ(empty.line_count(), 1u);
+    EXPECT_EQ(at(empty, 0), "1:1");
+
+    std::string long_line(1000, 'x');
+    LineIndex lines(long_line);
+    EXPECT_EQ(at(lines, 999), "1:1000");
+}
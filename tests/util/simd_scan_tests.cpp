@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "util/simd_scan.h"
+
+namespace {
+
+std::size_t naive_find_any(std::string_view input, std::size_t pos,
+    const SimdScan::Needles& needles)
+{
+    while (pos < input.size() && !needles.contains(input[pos])) {
+        pos++;
+    }
+    return pos;
+}
+
+const SimdScan::Isa kAllIsas[] = {
+    SimdScan::Isa::Scalar,
+    SimdScan::Isa::Sse2,
+    SimdScan::Isa::Avx2,
+};
+
+} // namespace
+
+TEST(SimdScanTest, finds_first_needle)
+{
+    SimdScan::Needles needles { '<', '&' };
+    std::string input(100, 'a');
+    input[70] = '&';
+    input[90] = '<';
+
+    for (auto isa : kAllIsas) {
+        if (!SimdScan::is_supported(isa)) {
+            continue;
+        }
+        EXPECT_EQ(SimdScan::find_any(input, 0, needles, isa), 70);
+        EXPECT_EQ(SimdScan::find_any(input, 71, needles, isa), 90);
+        EXPECT_EQ(SimdScan::find_any(input, 91, needles, isa), input.size());
+        EXPECT_EQ(SimdScan::find_any(input, input.size(), needles, isa),
+            input.size());
+    }
+}
+
+TEST(SimdScanTest, matches_naive_scan)
+{
+    SimdScan::Needles needles { '<', '&', '\0', '\r' };
+    std::mt19937 rng(42);
+    const char alphabet[] = { 'a', 'b', ' ', '<', '&', '\0', '\r', '\x80', '\xff' };
+
+    for (int round = 0; round < 200; round++) {
+        std::string input(rng() % 300, 'x');
+        for (auto& ch : input) {
+            // Mostly plain bytes so that long needle-free spans occur.
+            ch = rng() % 16 == 0 ? alphabet[rng() % sizeof(alphabet)] : 'x';
+        }
+
+        for (std::size_t pos = 0; pos <= input.size(); pos += 7) {
+            auto expected = naive_find_any(input, pos, needles);
+            EXPECT_EQ(SimdScan::find_any(input, pos, needles), expected);
+            for (auto isa : kAllIsas) {
+                if (SimdScan::is_supported(isa)) {
+                    EXPECT_EQ(SimdScan::find_any(input, pos, needles, isa), expected);
+                }
+            }
+        }
+    }
+}
+
+TEST(SimdScanTest, count_matches_naive_count)
+{
+    std::mt19937 rng(3);
+    for (int round = 0; round < 200; round++) {
+        std::string input(rng() % 300, 'x');
+        for (auto& ch : input) {
+            ch = rng() % 8 == 0 ? '\n' : static_cast<char>(rng() % 256);
+        }
+
+        for (char byte : { '\n', '\xff', '\0' }) {
+            std::size_t expected = 0;
+            for (char ch : input) {
+                expected += ch == byte;
+            }
+            EXPECT_EQ(SimdScan::count(input, byte), expected);
+            for (auto isa : kAllIsas) {
+                if (SimdScan::is_supported(isa)) {
+                    EXPECT_EQ(SimdScan::count(input, byte, isa), expected);
+                }
+            }
+        }
+    }
+}
+
+TEST(SimdScanTest, summarize_matches_naive_summary)
+{
+    std::mt19937 rng(11);
+    const char alphabet[] = { '\r', '\0', '\x80', '\xff' };
+    for (int round = 0; round < 300; round++) {
+        std::string input(rng() % 100, 'x');
+        // Few special bytes, at any position, so that each one is sometimes
+        // the only one and sometimes in the scalar tail.
+        for (int i = rng() % 3; i > 0 && !input.empty(); i--) {
+            input[rng() % input.size()] = alphabet[rng() % sizeof(alphabet)];
+        }
+
+        SimdScan::Summary expected;
+        for (char ch : input) {
+            expected.non_ascii |= (static_cast<unsigned char>(ch) & 0x80) != 0;
+            expected.carriage_return |= ch == '\r';
+        }
+
+        for (auto isa : kAllIsas) {
+            if (!SimdScan::is_supported(isa)) {
+                continue;
+            }
+            auto summary = SimdScan::summarize(input, isa);
+            EXPECT_EQ(summary.non_ascii, expected.non_ascii);
+            EXPECT_EQ(summary.carriage_return, expected.carriage_return);
+        }
+    }
+}
+
+TEST(SimdScanTest, ascii_prefix_matches_naive_prefix)
+{
+    std::mt19937 rng(13);
+    for (int round = 0; round < 300; round++) {
+        std::string input(rng() % 100, 'x');
+        if (!input.empty() && rng() % 4 != 0) {
+            input[rng() % input.size()] = static_cast<char>(0x80 + rng() % 0x80);
+        }
+
+        std::size_t expected = 0;
+        while (expected < input.size() && static_cast<unsigned char>(input[expected]) < 0x80) {
+            expected++;
+        }
+
+        for (auto isa : kAllIsas) {
+            if (!SimdScan::is_supported(isa)) {
+                continue;
+            }
+            EXPECT_EQ(SimdScan::ascii_prefix(input, isa), expected);
+        }
+    }
+}
+
+TEST(SimdScanTest, narrow_ascii_utf16_matches_naive_narrowing)
+{
+    std::mt19937 rng(17);
+    for (int round = 0; round < 300; round++) {
+        bool big_endian = round % 2 == 0;
+        std::string input;
+        std::size_t units = rng() % 60;
+        for (std::size_t i = 0; i < units; i++) {
+            // Mostly ASCII, sometimes a unit with either byte non-zero above
+            // the ASCII range.
+            std::uint16_t unit = 'a' + i % 26;
+            switch (rng() % 40) {
+            case 0:
+                unit = 0x00E9;
+                break;
+            case 1:
+                unit = 0x0141;
+                break;
+            case 2:
+                unit = 0xD83D;
+                break;
+            }
+            char high = static_cast<char>(unit >> 8);
+            char low = static_cast<char>(unit & 0xFF);
+            input += big_endian ? high : low;
+            input += big_endian ? low : high;
+        }
+        // A trailing odd byte is never narrowed.
+        if (rng() % 3 == 0) {
+            input += 'z';
+        }
+
+        std::string expected;
+        for (std::size_t i = 0; i + 2 <= input.size(); i += 2) {
+            auto first = static_cast<unsigned char>(input[i]);
+            auto second = static_cast<unsigned char>(input[i + 1]);
+            unsigned unit = big_endian ? (first << 8) | second : (second << 8) | first;
+            if (unit >= 0x80) {
+                break;
+            }
+            expected += static_cast<char>(unit);
+        }
+
+        for (auto isa : kAllIsas) {
+            if (!SimdScan::is_supported(isa)) {
+                continue;
+            }
+            std::string out(input.size() / 2, '?');
+            auto narrowed = SimdScan::narrow_ascii_utf16(input, big_endian, out.data(), isa);
+            EXPECT_EQ(out.substr(0, narrowed), expected);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "util/thread_pool.h"
+
+TEST(ThreadPoolTest, runs_every_index_once)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.thread_count(), 4u);
+
+    for (std::size_t count : { 0, 1, 3, 4, 1000 }) {
+        std::vector<std::atomic<int>> calls(count);
+        std::atomic<bool> bad_worker { false };
+        pool.for_each_index(count, [&](std::size_t index, std::size_t worker) {
+            calls[index]++;
+            if (worker >= pool.thread_count()) {
+                bad_worker = true;
+            }
+        });
+        for (std::size_t i = 0; i < count; i++) {
+            EXPECT_EQ(calls[i], 1) << i;
+        }
+        EXPECT_FALSE(bad_worker);
+    }
+}
+
+TEST(ThreadPoolTest, idle_workers_steal_from_busy_ones)
+{
+    // All the slow items are in the first worker's share. The others run out
+    // right away and have to take them over for the loop to end quickly.
+    ThreadPool pool(4);
+    std::vector<std::size_t> ran_on(64);
+    pool.for_each_index(ran_on.size(), [&](std::size_t index, std::size_t worker) {
+        ran_on[index] = worker;
+        if (index < 16) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+
+    bool stolen = false;
+    for (std::size_t i = 0; i < 16; i++) {
+        stolen |= ran_on[i] != ran_on[0];
+    }
+    EXPECT_TRUE(stolen);
+}